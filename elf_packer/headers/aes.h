@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aes.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/12/27 14:10:33 by insub             #+#    #+#             */
+/*   Updated: 2025/12/28 11:47:05 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AES_H
+# define AES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+# define AES_BLOCK_SIZE 16
+# define AES_MAX_ROUNDS 14
+
+typedef struct s_aes
+{
+    int         rounds;     // 10 (AES-128) or 14 (AES-256)
+    uint8_t     round_keys[(AES_MAX_ROUNDS + 1) * AES_BLOCK_SIZE];
+}   t_aes;
+
+void    aes_expand_key(t_aes *aes, const uint8_t *key, int key_bits);
+// counter block = nonce (12 bytes) || big endian 32bit counter
+void    aes_ctr_xor(const t_aes *aes, const uint8_t nonce[12],
+                    uint32_t counter, uint8_t *buffer, size_t size);
+
+#endif
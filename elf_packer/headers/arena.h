@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 11:26:50 by insub             #+#    #+#             */
+/*   Updated: 2026/02/04 11:26:50 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARENA_H
+# define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// job 하나의 allocation 을 모두 slab 에서 bump 로 나눠 주고, job 이 끝나면 free 대신 reset.
+// slab 은 2 MB 단위 mmap (hugetlbfs 가 있으면 MAP_HUGETLB, 없으면 THP 를 권함) 이고
+// reset 때 버리지 않고 다음 job 이 다시 쓰므로 page fault 도 job 마다 다시 나지 않음
+# define ARENA_SLAB_SIZE (2UL << 20)    // x86-64 huge page
+# define ARENA_LARGE (256UL << 10)      // 이 이상은 slab 하나를 통째로 (realloc 은 mremap)
+# define ARENA_KEEP (256UL << 20)       // reset 뒤 남겨 둘 slab 크기 합 상한
+# define ARENA_ALIGN 16
+
+// mmap 한 영역 앞에 둠
+typedef struct s_slab
+{
+    size_t  size;       // mapping 크기 (ARENA_SLAB_SIZE 배수)
+    size_t  used;       // 다음 allocation 위치
+    size_t  last;       // 마지막 allocation 의 헤더 위치 (LIFO free / 제자리 realloc)
+    int     huge;       // MAP_HUGETLB
+}   t_slab;
+
+typedef struct s_arena
+{
+    t_slab  *current;   // 작은 allocation 을 bump 하는 slab
+    t_slab  **slabs;    // 이번 job 이 쓰는 slab 들 (current 포함)
+    size_t  count;
+    size_t  cap;
+    t_slab  **spare;    // reset 으로 돌려받아 다음 job 이 다시 쓰는 slab
+    size_t  spare_count;
+    size_t  spare_cap;
+    size_t  spare_bytes;
+}   t_arena;
+
+t_arena *arena_use(t_arena *arena);
+t_arena *arena_current(void);
+void    arena_reset(t_arena *arena);
+void    arena_destroy(t_arena *arena);
+void    *arena_alloc(size_t size);
+void    *arena_calloc(size_t count, size_t size);
+void    *arena_realloc(void *ptr, size_t size);
+void    arena_free(void *ptr);
+
+#endif
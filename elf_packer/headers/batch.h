@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/16 11:20:37 by insub             #+#    #+#             */
+/*   Updated: 2026/01/16 19:05:12 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BATCH_H
+# define BATCH_H
+
+#include <stddef.h>
+#include <pthread.h>
+#include "payload.h"
+
+# define BATCH_MAX_WORKERS 256
+# define WARM_MMAP_THRESHOLD (32 << 20)     // glibc 가 허용하는 최대값
+# define WARM_TRIM_THRESHOLD (256 << 20)
+
+typedef struct s_batch
+{
+    const char  **inputs;   // 명령행의 입력 파일들
+    size_t      count;
+    const char  *manifest;  // --manifest: 한 줄에 "입력 [출력]"
+    const char  *out_dir;   // --out-dir: 출력 = out_dir/basename(입력), 없으면 입력.woody
+    int         workers;    // -j, 0 이면 쓸 수 있는 CPU 수
+    int         no_uring;   // --no-uring: io_uring 이 있어도 blocking I/O
+}   t_batch;
+
+typedef struct s_job
+{
+    const char  *input;
+    char        *output;
+    uint64_t    size;       // 입력 크기 (처리량 통계)
+    int         result;
+}   t_job;
+
+// worker 하나의 job 번호 덱. 주인은 tail 에서 꺼내고 남은 worker 는 head 에서 훔침
+// (job 하나가 파일 하나라 잠금 비용은 무시할 만함)
+typedef struct s_deque
+{
+    pthread_mutex_t lock;
+    size_t          *items;
+    size_t          head;
+    size_t          tail;
+}   t_deque;
+
+typedef struct s_pool
+{
+    t_job               *jobs;
+    t_deque             *deques;
+    int                 workers;
+    int                 no_uring;
+    int                 uring_workers;  // io_uring 을 띄운 worker 수 (통계)
+    uint64_t            uring_buffer;   // io_uring slot 하나의 등록 buffer 크기
+    const t_pack_config *config;
+}   t_pool;
+
+int     run_batch(const t_batch *batch, const t_pack_config *config);
+char    *default_output(const char *input, const char *out_dir);
+int     cpu_count(void);
+void    warm_heap(void);
+int     next_job(t_pool *pool, int id, size_t *job);
+void    report_job(const t_job *job);
+int     run_uring_worker(t_pool *pool, int id);
+uint64_t uring_buffer_size(const t_job *jobs, size_t count);
+
+#endif
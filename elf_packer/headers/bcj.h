@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bcj.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/14 10:26:08 by insub             #+#    #+#             */
+/*   Updated: 2026/01/14 22:51:40 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BCJ_H
+# define BCJ_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// x86 CALL/JMP rel32 (E8/E9) 필터. 압축 전에 상대 주소를 region 기준 절대 주소로 바꿔서
+// 같은 함수를 부르는 call 들이 같은 byte 열이 되게 함. stub.s 의 bcj_unfilter 가 역변환
+//
+// ±16MB (25bit 부호 있는 값) 안의 displacement 만 mod 2^25 로 바꾸므로 역변환이 항상 가능
+# define BCJ_RANGE 0x1000000
+# define BCJ_MASK  0x1ffffff
+
+void    bcj_x86_encode(uint8_t *buffer, size_t size);
+
+#endif
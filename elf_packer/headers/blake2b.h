@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   blake2b.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/25 14:20:07 by insub             #+#    #+#             */
+/*   Updated: 2026/01/25 14:20:07 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BLAKE2B_H
+# define BLAKE2B_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+# define BLAKE2B_BLOCK_SIZE 128
+# define BLAKE2B_MAX_SIZE 64
+
+// RFC 7693 BLAKE2b (key 없음, 출력 1..64 bytes)
+typedef struct s_blake2b
+{
+    uint64_t    h[8];
+    uint64_t    count[2];   // 지금까지 넣은 bytes (128-bit)
+    uint8_t     block[BLAKE2B_BLOCK_SIZE];
+    size_t      used;       // block 에 쌓인 bytes
+    size_t      out_size;
+}   t_blake2b;
+
+void    blake2b_init(t_blake2b *ctx, size_t out_size);
+void    blake2b_update(t_blake2b *ctx, const void *data, size_t size);
+void    blake2b_final(t_blake2b *ctx, uint8_t *out);
+void    blake2b(uint8_t *out, size_t out_size, const void *data, size_t size);
+
+#endif
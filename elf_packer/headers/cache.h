@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/25 14:20:07 by insub             #+#    #+#             */
+/*   Updated: 2026/01/25 14:20:07 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CACHE_H
+# define CACHE_H
+
+#include <stdint.h>
+#include "file.h"
+#include "payload.h"
+#include "blake2b.h"
+
+// --cache: 출력 디렉터리에 <cache key hex> 이름으로 packing 결과를 보관.
+// cache key = BLAKE2b(CACHE_VERSION, 입력 bytes, stub variant 코드, 출력에 영향을 주는 옵션)
+// 출력 레이아웃이나 key 유도 방식이 바뀌면 CACHE_VERSION 을 올릴 것
+# define CACHE_VERSION "woody cache 1"
+# define CACHE_KEY_SIZE 32
+# define CACHE_DEFAULT_SIZE (1ULL << 30)
+# define CACHE_EVICT_PERCENT 90     // 상한을 넘으면 이만큼까지 지움
+
+void    hash_config(t_blake2b *ctx, const t_pack_config *config);
+void    cache_key(const t_file *file, const t_pack_config *config, uint8_t *key);
+int     cache_fetch(const t_pack_config *config, const uint8_t *key, const char *output);
+void    cache_store(const t_pack_config *config, const uint8_t *key, const char *output);
+
+#endif
@@ -0,0 +1,23 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   chacha20.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/12/20 13:24:51 by insub             #+#    #+#             */
+/*   Updated: 2025/12/20 17:11:02 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CHACHA20_H
+# define CHACHA20_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// RFC 8439 ChaCha20 (32-bit block counter, 96-bit nonce)
+void    chacha20_xor(const uint32_t key[8], const uint32_t nonce[3],
+                     uint32_t counter, uint8_t *buffer, size_t size);
+
+#endif
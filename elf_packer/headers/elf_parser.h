@@ -21,8 +21,9 @@ typedef struct s_elf
     char          *section_strtab;
 }   t_elf;
 
+int   check_elf(const char *file_buffer, size_t size);
 t_elf parse_elf(char *file_buffer);
-int   check_pt_note(t_elf elf);
+int   find_exec_range(t_elf elf, Elf64_Phdr *phdr, uint64_t *start, uint64_t *end);
 
 const static char *ph_types[10] = 
 {
@@ -17,6 +17,18 @@
 #include <unistd.h>
 #include <stdlib.h>
 
-size_t read_file(const char *filename, char **file_buffer);
+// read() 한 번에 요청할 최대 크기 (Linux 는 0x7ffff000 이상을 잘라서 돌려줌)
+# define READ_CHUNK_SIZE (1UL << 30)
+
+typedef struct s_file
+{
+    int     fd;
+    char    *buffer;
+    size_t  size;
+    int     mapped;     // TRUE: MAP_PRIVATE view, FALSE: malloc + read
+}   t_file;
+
+int     open_file(const char *filename, t_file *file);
+void    close_file(t_file *file);
 
 #endif
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   layout.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/16 10:42:18 by insub             #+#    #+#             */
+/*   Updated: 2026/02/16 10:42:18 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LAYOUT_H
+# define LAYOUT_H
+
+#include <stdint.h>
+#include "payload.h"
+
+// stub 을 실을 자리. PT_LOAD 하나가 늘 때마다 exec 할 때마다 mmap + VMA 가 하나씩 늘어나므로
+// plan_layout 은 늘어나는 mapping 수, 그 다음 늘어나는 출력 bytes 가 가장 적은 것을 고름
+typedef struct s_layout
+{
+    t_layout_kind   kind;
+    int             phdr;       // 고칠 program header (PHDR 은 새 PT_LOAD 를 넣을 자리)
+    uint64_t        offset;     // stub 의 파일 오프셋
+    uint64_t        vaddr;      // stub 의 가상 주소 (= 새 entry)
+    uint32_t        mappings;   // 늘어나는 PT_LOAD 수
+    uint64_t        bytes;      // stub 앞에 늘어나는 출력 bytes (padding, 옮긴 표)
+    uint32_t        table;      // PHDR: stub 안에 옮긴 program header 표 위치
+    uint64_t        trailer;    // EXTEND: stub 뒤로 옮길 원본 끝 (section 들) 의 시작, 없으면 0
+}   t_layout;
+
+int         plan_layout(t_elf elf, uint64_t file_size, t_layout_kind want, t_layout *layout);
+int         refine_layout(t_elf elf, uint64_t file_size, t_layout_kind want,
+                          const t_stub_image *stub, t_layout *layout);
+int         reserve_layout(t_elf elf, t_layout *layout, t_stub_image *stub);
+int         apply_layout(t_elf elf, const t_layout *layout, const t_file *file,
+                         t_output *out, t_stub_image *stub);
+int         align_huge(t_elf elf, const t_file *file, t_output *out);
+const char  *layout_name(t_layout_kind kind);
+int         parse_layout(const char *name, t_layout_kind *kind);
+
+#endif
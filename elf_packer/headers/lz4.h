@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lz4.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/10 14:02:51 by insub             #+#    #+#             */
+/*   Updated: 2026/01/11 20:37:19 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LZ4_H
+# define LZ4_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// LZ4 block format (frame 헤더 없음). stub.s 의 lz4_decompress 가 푼다
+# define LZ4_MIN_MATCH      4
+# define LZ4_LAST_LITERALS  5       // 마지막 5 bytes 는 항상 literal
+# define LZ4_MF_LIMIT       12      // match 는 끝에서 12 bytes 전까지만 시작
+# define LZ4_MAX_OFFSET     65535
+
+# define LZ4_COMPRESS_BOUND(n) ((n) + (n) / 255 + 16)
+
+// dst 는 LZ4_COMPRESS_BOUND(size) 이상. 압축된 크기를 반환 (0 이면 메모리 부족)
+size_t  lz4_compress(const uint8_t *src, size_t size, uint8_t *dst);
+
+#endif
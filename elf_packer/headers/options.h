@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/31 10:14:22 by insub             #+#    #+#             */
+/*   Updated: 2026/01/31 10:14:22 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef OPTIONS_H
+# define OPTIONS_H
+
+#include <stdint.h>
+#include "payload.h"
+#include "batch.h"
+#include "cache.h"
+
+// 명령줄 (--serve 는 요청마다 받은 명령줄도 같은 방식으로 읽음)
+typedef struct s_options
+{
+    const char      *output;    // -o, 기본값 "woody"
+    const char      *profile;   // woody_profile 의 출력
+    t_pack_config   pack;
+    t_batch         batch;      // 입력 목록 + batch 옵션
+    uint8_t         key[CACHE_KEY_SIZE];    // --key
+    const char      *watch;     // --watch: 이 디렉터리에 새로 써지는 ELF 를 계속 pack
+    int             debounce;   // --debounce (ms)
+    const char      *serve;     // --serve: 이 Unix socket 으로 pack 요청을 받음
+    const char      *stats;     // --stats: 끝날 때 단계별 통계를 JSON 으로 (- 면 stdout)
+    int             stats_counters; // --stats-counters: perf_event_open counter 도 같이
+}   t_options;
+
+int parse_pack_option(const char *name, const char *value, t_pack_config *pack, uint8_t *key);
+int parse_args(int argc, char *argv[], t_options *opt);
+
+#endif
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/12/14 15:02:11 by insub             #+#    #+#             */
+/*   Updated: 2025/12/14 16:40:27 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef OUTPUT_H
+# define OUTPUT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "file.h"
+
+# define MAX_REGIONS 8
+// 원본에서 바뀌는 범위: region 마다 하나, --huge-pages 가 고치는 실행 PT_LOAD 헤더 (region 수 이하),
+// layout 이 고치는 ELF 헤더와 program header 하나
+# define MAX_PATCHES (MAX_REGIONS * 2 + 2)
+
+// 원본 버퍼에서 수정된 바이트 범위 (파일 오프셋 기준)
+typedef struct s_patch
+{
+    uint64_t    offset;
+    uint64_t    size;
+}   t_patch;
+
+typedef struct s_output
+{
+    t_patch     patches[MAX_PATCHES];
+    int         patch_count;
+    uint64_t    stub_offset;    // 스텁이 놓일 파일 오프셋 (앞은 hole)
+    const void  *stub;
+    size_t      stub_size;      // 메모리에 있는 부분 (--stream 의 chunk 는 이미 써 둠)
+    int         fd;             // --stream: 미리 열어 둔 출력 (region 을 바로 씀), 아니면 -1
+    uint64_t    trailer;        // --layout extend: 원본 [trailer, 끝) 을 trailer_to 로 옮기고
+    uint64_t    trailer_to;     // [trailer, stub_offset) 와 [stub_end, trailer_to) 는 0 (0 이면 안 옮김)
+    uint64_t    stub_end;       // stub 끝 (--stream 의 chunk 포함)
+}   t_output;
+
+int add_patch(t_output *out, const t_file *file, const void *ptr, size_t size);
+int write_all(int fd, const char *buffer, size_t size, uint64_t offset);
+int clone_file(int fd_out, int fd_in, uint64_t size);
+int zero_range(int fd_out, uint64_t offset, uint64_t size);
+int begin_output(const char *out_name, const t_file *file, int *fd_out);
+int finish_output(int fd_out, const t_file *file, const t_output *out);
+int write_output(const char *out_name, const t_file *file, const t_output *out);
+
+#endif
@@ -0,0 +1,26 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pack.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/16 11:20:37 by insub             #+#    #+#             */
+/*   Updated: 2026/01/16 19:05:12 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PACK_H
+# define PACK_H
+
+#include <stdint.h>
+#include "payload.h"
+
+# define PACK_CACHED 1  // pack_file: --cache 에서 꺼냄
+
+uint64_t    align_up(uint64_t val, uint64_t align);
+int         pack_image(t_file *file, const t_pack_config *config,
+                       t_output *out, t_stub_image *stub);
+int         pack_file(const char *input, const char *output, const t_pack_config *config);
+
+#endif
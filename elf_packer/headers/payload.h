@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   payload.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/12/20 13:24:51 by insub             #+#    #+#             */
+/*   Updated: 2025/12/21 18:02:36 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PAYLOAD_H
+# define PAYLOAD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "elf_parser.h"
+#include "file.h"
+#include "output.h"
+#include "aes.h"
+#include "profile.h"
+
+# define PLACEHOLDER 0x1122334455667788
+# define MAX_KERNELS 4
+# define CHACHA_BLOCK_SIZE 64
+# define PACKED_ALIGN 16
+# define LAZY_MIN_SHIFT 12     // 한 페이지
+# define LAZY_MAX_SHIFT 24
+# define LAZY_DEFAULT_SHIFT 16 // 64 KB
+# define MAX_THREADS 64         // stub.inc 와 같은 값
+# define PARALLEL_SHIFT 20      // 여러 thread 로 풀 때의 block (1 MB)
+# define PARALLEL_MIN_SIZE (16UL << 20) // --threads 없이도 나눠 푸는 실행 region 크기
+# define PARALLEL_DEFAULT_THREADS 16
+# define HOT_BLOCK_BITS 24     // hot 목록 항목의 block 번호 bit 수
+# define HUGE_PAGE_SIZE 0x200000    // --huge-pages (stub.inc 와 같은 값)
+
+// kernel 이 요구하는 CPU 기능 (stub.inc 의 FEAT_* 와 같은 값)
+# define FEAT_AESNI  1
+# define FEAT_AVX2   2
+# define FEAT_AVX512 4   // AVX512F + AVX512BW
+# define FEAT_VAES   8
+
+// stub.s 의 CIPHER_* 와 같은 값
+typedef enum e_cipher
+{
+    CIPHER_CHACHA20,
+    CIPHER_AES128_CTR,
+    CIPHER_AES256_CTR,
+}   t_cipher;
+
+// stub.inc 의 FILTER_* 와 같은 값
+typedef enum e_filter
+{
+    FILTER_NONE,
+    FILTER_BCJ,
+}   t_filter;
+
+// --layout: stub 을 실을 자리 (AUTO 는 plan_layout 이 비용으로 고름, 같으면 앞의 것)
+typedef enum e_layout_kind
+{
+    LAYOUT_AUTO,
+    LAYOUT_CAVE,    // segment 사이 padding 에 그대로
+    LAYOUT_EXTEND,  // 마지막 PT_LOAD 를 늘림
+    LAYOUT_NOTE,    // PT_NOTE -> PT_LOAD
+    LAYOUT_STACK,   // PT_GNU_STACK -> PT_LOAD (stack 이 실행 가능해짐, AUTO 는 안 고름)
+    LAYOUT_PHDR,    // program header 표를 stub 옆으로 옮기고 PT_LOAD 를 하나 더함
+}   t_layout_kind;
+
+// stub.s 의 region 레이아웃과 반드시 같아야 함 (32 bytes)
+typedef struct s_region
+{
+    uint64_t    vaddr;      // 링크 시점 주소 (PIE 는 stub 이 load bias 를 더함)
+    uint64_t    size;
+    uint32_t    counter;        // 이 region 의 첫 block counter
+    uint32_t    packed_offset;  // --compress: stub 시작 기준 LZ4 blob 위치
+    uint32_t    prot;           // 복호화 후 되돌릴 PROT_*
+    uint32_t    packed_size;    // 0 이면 압축 안 함 (제자리 복호화)
+}   t_region;
+
+// stub 이 순서대로 보고 features 를 모두 갖춘 첫 kernel 을 씀
+typedef struct s_kernel
+{
+    uint32_t    offset;     // stub 시작 기준 진입점
+    uint32_t    features;   // FEAT_*
+}   t_kernel;
+
+// stub.s 의 params 레이블 위치에 그대로 덮어씀. 첫 필드가 PLACEHOLDER 자리
+typedef struct s_stub_params
+{
+    uint64_t    oep;
+    uint64_t    stub_vaddr;
+    uint32_t    key[8];
+    uint32_t    nonce[4];       // [0] 은 counter 자리 (항상 0)
+    uint32_t    region_count;
+    uint32_t    cipher;         // t_cipher
+    uint32_t    aes_rounds;
+    uint32_t    filter;         // t_filter, 압축된 region 에만 적용
+    uint8_t     round_keys[(AES_MAX_ROUNDS + 1) * AES_BLOCK_SIZE]; // pack 시점에 확장
+    uint32_t    kernel_count;
+    uint32_t    pad2;
+    t_kernel    kernels[MAX_KERNELS];
+    t_region    regions[MAX_REGIONS];
+    uint32_t    block_shift;    // log2(block 크기), 0 이면 region 을 통째로 복호화
+    uint32_t    state_offset;   // --lazy: stub 시작 기준 block 상태 byte 들 (bss)
+    uint32_t    hot_offset;     // --profile: stub 시작 기준 미리 풀 block 목록
+    uint32_t    hot_count;      // 항목 = region << 24 | block, 처음 건드린 순서
+    uint32_t    lazy;           // TRUE: block 을 처음 건드릴 때, FALSE: 시작할 때 여러 thread 로
+    uint32_t    max_threads;    // stub 이 CPU 수 (sched_getaffinity) 와 비교해 작은 쪽을 씀
+    uint32_t    huge_pages;     // --huge-pages: region 안의 2MB 정렬 범위를 THP 익명 mapping 으로
+    uint32_t    pad3;
+}   t_stub_params;
+
+_Static_assert(sizeof(t_region) == 32, "t_region must match stub.inc");
+_Static_assert(offsetof(t_stub_params, kernel_count) == 320, "t_stub_params must match stub.inc");
+_Static_assert(offsetof(t_stub_params, regions) == 360, "t_stub_params must match stub.inc");
+_Static_assert(offsetof(t_stub_params, block_shift) == 616, "t_stub_params must match stub.inc");
+_Static_assert(offsetof(t_stub_params, hot_offset) == 624, "t_stub_params must match stub.inc");
+_Static_assert(offsetof(t_stub_params, lazy) == 632, "t_stub_params must match stub.inc");
+_Static_assert(offsetof(t_stub_params, huge_pages) == 640, "t_stub_params must match stub.inc");
+
+typedef struct s_repack t_repack;
+
+// 실행 region 을 어떻게 감쌀지 (main 의 옵션)
+typedef struct s_pack_config
+{
+    t_cipher    cipher;
+    const char  *kernel;    // --kernel, NULL 이면 CPUID 로 stub 이 고름
+    int         compress;
+    t_filter    filter;     // 압축 전 필터 (--bcj)
+    uint32_t    lazy_shift; // --lazy: log2(block 크기), 0 이면 끔
+    uint32_t    threads;    // --threads: 시작할 때 풀 thread 수 상한, 0 이면 크기 보고 자동
+    t_profile   *profile;   // --profile: 시작할 때 건드리는 페이지 (NULL 이면 없음)
+    int         quiet;      // batch: key / 압축률을 파일마다 찍지 않음
+    int         stream;     // --stream: 실행 region 을 메모리에 올리지 않고 chunk 로 흘려 보냄
+    const char  *cache_dir; // --cache: 출력을 cache key 로 보관하고 같은 요청이면 꺼내 씀
+    uint64_t    cache_size; // --cache-size: 넘으면 오래 안 쓴 entry 부터 지움
+    const uint8_t *key;     // --key: 32 bytes, NULL 이면 임의 key (--cache 면 seed 에서 유도)
+    const uint8_t *seed;    // pack_file 이 채우는 cache key. 있으면 key / nonce 를 여기서 유도
+    const char  *incremental;   // --incremental: 이전 출력 (옆의 .manifest 와 같이 읽음)
+    t_repack    *repack;        // pack_file 이 채움: 이전 출력에서 가져올 chunk 와 이번 manifest
+    int         telemetry;      // --telemetry: stub 이 시작 단계별 TSC 를 record 로 남김 (WOODY_TELEMETRY)
+    t_layout_kind   layout;     // --layout
+    int         huge_pages;     // --huge-pages: 실행 PT_LOAD 를 2MB 정렬, stub 이 text 를 THP 에 풂
+}   t_pack_config;
+
+typedef struct s_stub_image t_stub_image;
+
+t_stub_params   *find_stub_params(unsigned char *stub, size_t stub_len);
+int             encrypt_payload(t_elf elf, t_file *file, t_output *out,
+                                t_stub_image *stub, const t_pack_config *config);
+
+#endif
@@ -25,10 +25,24 @@ typedef enum e_error
     FILE_NOT_FOUND,
     INVALID_ELF,
     MEMORY_ALLOCATION_FAILED,
+    INVALID_PROFILE,
+    NO_LAYOUT,
+    TOO_MANY_REGIONS,
     // Add more error types as needed
-} error_t;
+} t_error;
 
-int print_error(error_t error, int use_errno);
+// capture_errors 로 넘긴 곳에 남는 print_error
+typedef struct s_last_error
+{
+    int     set;
+    t_error error;
+    int     err_no;     // use_errno 였으면 그때의 errno, 아니면 0
+}   t_last_error;
+
+int print_error(t_error error, int use_errno);
 int print_debug(const char *format, ...);
+void set_debug(int enabled);
+const char *error_message(t_error error);
+void capture_errors(t_last_error *last);
 
 #endif
\ No newline at end of file
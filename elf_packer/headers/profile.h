@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/14 10:12:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/14 16:48:05 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PROFILE_H
+# define PROFILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// woody_profile 이 쓰고 --profile 이 읽는 텍스트 파일
+//   # 주석
+//   entry 0x<e_entry>          (다른 binary 의 profile 을 막음)
+//   0x<페이지 link 주소>       (처음 건드린 순서대로 한 줄씩)
+# define PROFILE_MAGIC "# woody page profile"
+
+typedef struct s_profile
+{
+    uint64_t    entry;
+    uint64_t    *pages;
+    size_t      count;
+}   t_profile;
+
+int     load_profile(const char *path, t_profile *profile);
+int     save_profile(const char *path, const t_profile *profile);
+void    free_profile(t_profile *profile);
+
+#endif
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   repack.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/27 16:41:19 by insub             #+#    #+#             */
+/*   Updated: 2026/01/27 16:41:19 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef REPACK_H
+# define REPACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "payload.h"
+#include "cache.h"
+
+// --incremental: 출력 옆에 chunk 마다 "plain hash -> 출력의 인코딩된 bytes" 를 남겨 두고,
+// 다음 pack 에서 hash 가 같은 chunk 는 압축 / 암호화 없이 이전 출력에서 가져옴
+//   # woody repack manifest
+//   config <옵션 + stub variant 의 BLAKE2b>   (다르면 전부 새로)
+//   key <hex> / nonce <hex>                    (이어 써야 이전 암호문이 맞음)
+//   chunk <vaddr> <size> <hash> <offset> <encoded size> <encoded hash> <counter> <c|p>
+# define REPACK_MAGIC "# woody repack manifest"
+# define REPACK_VERSION "woody repack 1"
+# define REPACK_SUFFIX ".manifest"
+
+typedef struct s_chunk_record
+{
+    uint64_t    vaddr;          // plain 의 link 주소
+    uint64_t    size;
+    uint64_t    hash;           // xxh64(plain)
+    uint64_t    offset;         // 출력 파일에서 인코딩된 bytes 위치
+    uint64_t    encoded_size;
+    uint64_t    encoded_hash;   // xxh64(인코딩된 bytes): 이전 출력이 manifest 와 다르면 안 씀
+    uint32_t    counter;        // 인코딩할 때 쓴 첫 cipher block counter
+    int         compressed;     // TRUE: 압축한 block (stub 뒤), FALSE: 제자리 암호화
+}   t_chunk_record;
+
+struct s_repack
+{
+    int             fd;         // 이전 출력, 없으면 -1
+    uint8_t         config[CACHE_KEY_SIZE];
+    int             valid;      // 이전 manifest 를 쓸 수 있음 (key / nonce 를 이어 씀)
+    uint32_t        key[8];
+    uint32_t        nonce[3];
+    t_chunk_record  *old;       // 이전 manifest (vaddr 순)
+    size_t          old_count;
+    t_chunk_record  *records;   // 이번 출력의 manifest
+    size_t          count;
+    size_t          cap;
+    uint8_t         *scratch;   // 이전 출력에서 읽어 검사하는 자리
+    size_t          scratch_size;
+    uint64_t        stub_offset;    // 이번 출력에서 stub 위치 (encrypt_payload 가 채움)
+    size_t          reused;
+    uint64_t        encoded;        // 새로 인코딩한 plain bytes
+};
+
+void    open_repack(t_repack *repack, const char *previous, const t_pack_config *config);
+int     repack_reuse(t_repack *repack, const t_chunk_record *want, uint8_t *dst,
+                     size_t capacity, t_chunk_record *found);
+int     repack_add(t_repack *repack, const t_chunk_record *record);
+int     save_repack(const t_repack *repack, const char *output);
+void    close_repack(t_repack *repack);
+
+#endif
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   serve.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/31 10:14:22 by insub             #+#    #+#             */
+/*   Updated: 2026/01/31 10:14:22 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SERVE_H
+# define SERVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "options.h"
+#include "profile.h"
+
+// --serve 와 woody_client 사이의 약속 (SOCK_STREAM, 연결 하나에 요청 하나)
+//   client -> server: t_serve_request (+ SCM_RIGHTS: [cwd, 입력 fd...]),
+//                     argv 문자열 argc 개 (NUL 로 끝남), fd 마다 argv 번호 (uint32_t)
+//   server -> client: 입력마다 t_serve_reply (끝난 순서), 마지막에 index == SERVE_DONE
+# define SERVE_MAGIC 0x31594457         // "WDY1"
+# define SERVE_MAX_FDS 250              // SCM_MAX_FD (253) 안쪽. 넘는 입력은 경로로
+# define SERVE_MAX_REQUEST (16 << 20)   // argv + fd 번호
+# define SERVE_DONE UINT32_MAX
+# define SERVE_TIMEOUT_MS 5000          // 요청 읽기 / 답 쓰기가 이보다 오래 막히면 연결을 버림
+# define SERVE_BACKLOG 128
+
+typedef struct s_serve_request
+{
+    uint32_t    magic;
+    uint32_t    argc;       // argv[0] 포함
+    uint32_t    size;       // 뒤따르는 bytes (argv 문자열 + fd 번호)
+    uint32_t    fd_count;   // SCM_RIGHTS 로 보낸 fd 수 (0 이면 경로만, 상대 경로는 못 씀)
+}   t_serve_request;
+
+typedef struct s_serve_reply
+{
+    uint32_t    index;      // 이 입력의 argv 번호, SERVE_DONE 이면 요청 끝
+    int32_t     result;     // pack_file 결과 (SERVE_DONE 이면 요청을 받았는지)
+    uint64_t    queued_us;  // 요청을 받고 worker 가 집을 때까지
+    uint64_t    packed_us;  // pack_file 시간
+}   t_serve_reply;
+
+typedef struct s_serve_job
+{
+    const char  *input;     // 받은 fd 가 있으면 /proc/self/fd/N
+    const char  *output;
+    uint32_t    arg;        // argv 번호 (t_serve_reply.index)
+}   t_serve_job;
+
+// 연결 하나 (= 요청 하나). 마지막 job 을 끝낸 worker 가 SERVE_DONE 을 보내고 닫음
+typedef struct s_serve_conn
+{
+    int                 fd;
+    int                 fds[SERVE_MAX_FDS];     // 받은 fd ([0] 은 client 의 cwd)
+    uint32_t            fd_args[SERVE_MAX_FDS]; // fd 마다 argv 번호
+    size_t              fd_count;
+    char                *body;
+    char                **argv;
+    int                 argc;
+    t_options           opt;
+    t_profile           profile;
+    t_pack_config       config;
+    char                **owned;        // 경로를 바꾸며 만든 문자열
+    size_t              owned_count;
+    t_serve_job         *jobs;
+    size_t              job_count;
+    size_t              next;           // 아직 worker 에게 안 준 첫 job
+    size_t              done;
+    int                 broken;         // 답을 못 보냈으면 더 보내지 않음
+    uint64_t            received;       // CLOCK_MONOTONIC us
+    pthread_mutex_t     send_lock;
+    struct s_serve_conn *link;          // 아직 줄 job 이 남은 연결의 고리
+}   t_serve_conn;
+
+typedef struct s_serve
+{
+    int             fd;         // listen socket
+    pthread_mutex_t lock;
+    pthread_cond_t  ready;
+    t_serve_conn    *head;      // 연결마다 job 하나씩 돌아가며 줌 (큰 요청이 작은 요청을 막지 않도록)
+    t_serve_conn    *tail;
+    int             stop;
+    size_t          requests;
+    size_t          packed;
+    size_t          failed;
+}   t_serve;
+
+int     run_serve(const char *path, int workers);
+
+#endif
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 16:08:31 by insub             #+#    #+#             */
+/*   Updated: 2026/02/06 16:08:31 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATS_H
+# define STATS_H
+
+#include <stdint.h>
+
+// --stats: 단계마다 시간 / bytes (+ --stats-counters 면 perf_event_open counter) 를 모아 JSON 으로.
+// 꺼져 있으면 stats_begin / stats_end 는 flag 하나만 봄
+# define STATS_VERSION 1
+
+typedef enum e_phase
+{
+    PHASE_READ,     // 입력 열기 (mmap / read)
+    PHASE_PARSE,    // ELF 검사
+    PHASE_LAYOUT,   // stub 자리 고르기 (plan_layout)
+    PHASE_STUB,     // stub 조립과 params
+    PHASE_ENCODE,   // 실행 region 압축 / 암호화 (--stream 이면 쓰기 포함)
+    PHASE_WRITE,    // 출력 쓰기
+    PHASE_CACHE,    // --cache / --key 의 cache key 와 꺼내기 / 넣기
+    PHASE_COUNT,
+}   t_phase;
+
+typedef enum e_counter
+{
+    COUNTER_CYCLES,
+    COUNTER_INSTRUCTIONS,
+    COUNTER_CACHE_MISSES,
+    COUNTER_PAGE_FAULTS,
+    COUNTER_COUNT,
+}   t_counter;
+
+// 단계 하나를 잴 때 시작 값
+typedef struct s_stats_timer
+{
+    uint64_t    ns;
+    uint64_t    counters[COUNTER_COUNT];
+}   t_stats_timer;
+
+typedef struct s_phase_stats
+{
+    uint64_t    calls;
+    uint64_t    ns;
+    uint64_t    bytes;
+    uint64_t    counters[COUNTER_COUNT];
+}   t_phase_stats;
+
+void    stats_enable(int counters);
+void    stats_begin(t_stats_timer *timer);
+void    stats_end(const t_stats_timer *timer, t_phase phase, uint64_t bytes);
+void    stats_file(int result);
+int     stats_write(const char *path);
+// woody_kbench 처럼 직접 재는 쪽: 이 thread 의 counter 현재 값 (못 연 counter 는 0)
+void    stats_read(uint64_t counters[COUNTER_COUNT]);
+int     stats_available(t_counter counter);
+
+#endif
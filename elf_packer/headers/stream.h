@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stream.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/22 09:48:13 by insub             #+#    #+#             */
+/*   Updated: 2026/01/22 18:12:40 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STREAM_H
+# define STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "output.h"
+
+# define STREAM_DEPTH 4             // 읽기 / 변환 / 쓰기가 서로를 기다리지 않도록 돌리는 chunk 수
+# define STREAM_CHUNK (4UL << 20)   // 통째로 암호화하는 region 을 나누는 크기
+
+// 입력에서 읽은 구간 하나. transform 이 data / write_offset 을 정하면 그대로 출력에 씀
+typedef struct s_chunk
+{
+    uint8_t         *in;            // 읽은 원본 (제자리 변환 가능)
+    uint8_t         *out;           // 다른 크기로 바꿀 때 쓰는 buffer (stream_spans 의 out_size)
+    uint64_t        offset;         // 입력 파일 위치
+    size_t          size;
+    const uint8_t   *data;          // 쓸 내용, 기본값은 in
+    size_t          data_size;
+    uint64_t        write_offset;   // 출력 파일 위치, 기본값은 offset
+    int             state;
+}   t_chunk;
+
+typedef int (*t_transform)(t_chunk *chunk, size_t index, void *arg);
+
+int stream_spans(int in_fd, int out_fd, const t_patch *spans, size_t count,
+                 size_t out_size, t_transform transform, void *arg);
+
+#endif
@@ -1,9 +1,1258 @@
+unsigned char kernel_aes_ni_bin[] = {
+  0x48, 0x85, 0xf6, 0x0f, 0x84, 0x5c, 0x02, 0x00, 0x00, 0x41, 0x89, 0xd0,
+  0x44, 0x8b, 0x49, 0x48, 0x4c, 0x8d, 0x59, 0x50, 0xf3, 0x44, 0x0f, 0x6f,
+  0x79, 0x30, 0x66, 0x45, 0x0f, 0x70, 0xff, 0x39, 0x48, 0x81, 0xfe, 0x80,
+  0x00, 0x00, 0x00, 0x0f, 0x82, 0xc4, 0x01, 0x00, 0x00, 0x66, 0x41, 0x0f,
+  0x6f, 0xc7, 0x41, 0x8b, 0xc0, 0x0f, 0xc8, 0x66, 0x0f, 0x3a, 0x22, 0xc0,
+  0x03, 0x66, 0x41, 0x0f, 0x6f, 0xcf, 0x41, 0x8d, 0x40, 0x01, 0x0f, 0xc8,
+  0x66, 0x0f, 0x3a, 0x22, 0xc8, 0x03, 0x66, 0x41, 0x0f, 0x6f, 0xd7, 0x41,
+  0x8d, 0x40, 0x02, 0x0f, 0xc8, 0x66, 0x0f, 0x3a, 0x22, 0xd0, 0x03, 0x66,
+  0x41, 0x0f, 0x6f, 0xdf, 0x41, 0x8d, 0x40, 0x03, 0x0f, 0xc8, 0x66, 0x0f,
+  0x3a, 0x22, 0xd8, 0x03, 0x66, 0x41, 0x0f, 0x6f, 0xe7, 0x41, 0x8d, 0x40,
+  0x04, 0x0f, 0xc8, 0x66, 0x0f, 0x3a, 0x22, 0xe0, 0x03, 0x66, 0x41, 0x0f,
+  0x6f, 0xef, 0x41, 0x8d, 0x40, 0x05, 0x0f, 0xc8, 0x66, 0x0f, 0x3a, 0x22,
+  0xe8, 0x03, 0x66, 0x41, 0x0f, 0x6f, 0xf7, 0x41, 0x8d, 0x40, 0x06, 0x0f,
+  0xc8, 0x66, 0x0f, 0x3a, 0x22, 0xf0, 0x03, 0x66, 0x41, 0x0f, 0x6f, 0xff,
+  0x41, 0x8d, 0x40, 0x07, 0x0f, 0xc8, 0x66, 0x0f, 0x3a, 0x22, 0xf8, 0x03,
+  0x4d, 0x89, 0xda, 0xf3, 0x45, 0x0f, 0x6f, 0x02, 0x66, 0x41, 0x0f, 0xef,
+  0xc0, 0x66, 0x41, 0x0f, 0xef, 0xc8, 0x66, 0x41, 0x0f, 0xef, 0xd0, 0x66,
+  0x41, 0x0f, 0xef, 0xd8, 0x66, 0x41, 0x0f, 0xef, 0xe0, 0x66, 0x41, 0x0f,
+  0xef, 0xe8, 0x66, 0x41, 0x0f, 0xef, 0xf0, 0x66, 0x41, 0x0f, 0xef, 0xf8,
+  0x44, 0x89, 0xc9, 0xff, 0xc9, 0x49, 0x83, 0xc2, 0x10, 0xf3, 0x45, 0x0f,
+  0x6f, 0x02, 0x66, 0x41, 0x0f, 0x38, 0xdc, 0xc0, 0x66, 0x41, 0x0f, 0x38,
+  0xdc, 0xc8, 0x66, 0x41, 0x0f, 0x38, 0xdc, 0xd0, 0x66, 0x41, 0x0f, 0x38,
+  0xdc, 0xd8, 0x66, 0x41, 0x0f, 0x38, 0xdc, 0xe0, 0x66, 0x41, 0x0f, 0x38,
+  0xdc, 0xe8, 0x66, 0x41, 0x0f, 0x38, 0xdc, 0xf0, 0x66, 0x41, 0x0f, 0x38,
+  0xdc, 0xf8, 0xff, 0xc9, 0x75, 0xc3, 0xf3, 0x45, 0x0f, 0x6f, 0x42, 0x10,
+  0x66, 0x41, 0x0f, 0x38, 0xdd, 0xc0, 0x66, 0x41, 0x0f, 0x38, 0xdd, 0xc8,
+  0x66, 0x41, 0x0f, 0x38, 0xdd, 0xd0, 0x66, 0x41, 0x0f, 0x38, 0xdd, 0xd8,
+  0x66, 0x41, 0x0f, 0x38, 0xdd, 0xe0, 0x66, 0x41, 0x0f, 0x38, 0xdd, 0xe8,
+  0x66, 0x41, 0x0f, 0x38, 0xdd, 0xf0, 0x66, 0x41, 0x0f, 0x38, 0xdd, 0xf8,
+  0xf3, 0x44, 0x0f, 0x6f, 0x07, 0x66, 0x41, 0x0f, 0xef, 0xc0, 0xf3, 0x0f,
+  0x7f, 0x07, 0xf3, 0x44, 0x0f, 0x6f, 0x47, 0x10, 0x66, 0x41, 0x0f, 0xef,
+  0xc8, 0xf3, 0x0f, 0x7f, 0x4f, 0x10, 0xf3, 0x44, 0x0f, 0x6f, 0x47, 0x20,
+  0x66, 0x41, 0x0f, 0xef, 0xd0, 0xf3, 0x0f, 0x7f, 0x57, 0x20, 0xf3, 0x44,
+  0x0f, 0x6f, 0x47, 0x30, 0x66, 0x41, 0x0f, 0xef, 0xd8, 0xf3, 0x0f, 0x7f,
+  0x5f, 0x30, 0xf3, 0x44, 0x0f, 0x6f, 0x47, 0x40, 0x66, 0x41, 0x0f, 0xef,
+  0xe0, 0xf3, 0x0f, 0x7f, 0x67, 0x40, 0xf3, 0x44, 0x0f, 0x6f, 0x47, 0x50,
+  0x66, 0x41, 0x0f, 0xef, 0xe8, 0xf3, 0x0f, 0x7f, 0x6f, 0x50, 0xf3, 0x44,
+  0x0f, 0x6f, 0x47, 0x60, 0x66, 0x41, 0x0f, 0xef, 0xf0, 0xf3, 0x0f, 0x7f,
+  0x77, 0x60, 0xf3, 0x44, 0x0f, 0x6f, 0x47, 0x70, 0x66, 0x41, 0x0f, 0xef,
+  0xf8, 0xf3, 0x0f, 0x7f, 0x7f, 0x70, 0x41, 0x83, 0xc0, 0x08, 0x48, 0x81,
+  0xc7, 0x80, 0x00, 0x00, 0x00, 0x48, 0x81, 0xee, 0x80, 0x00, 0x00, 0x00,
+  0xe9, 0x2f, 0xfe, 0xff, 0xff, 0x48, 0x85, 0xf6, 0x74, 0x6f, 0x66, 0x41,
+  0x0f, 0x6f, 0xc7, 0x41, 0x8b, 0xc0, 0x0f, 0xc8, 0x66, 0x0f, 0x3a, 0x22,
+  0xc0, 0x03, 0x4d, 0x89, 0xda, 0xf3, 0x45, 0x0f, 0x6f, 0x02, 0x66, 0x41,
+  0x0f, 0xef, 0xc0, 0x44, 0x89, 0xc9, 0xff, 0xc9, 0x49, 0x83, 0xc2, 0x10,
+  0xf3, 0x45, 0x0f, 0x6f, 0x02, 0x66, 0x41, 0x0f, 0x38, 0xdc, 0xc0, 0xff,
+  0xc9, 0x75, 0xed, 0xf3, 0x45, 0x0f, 0x6f, 0x42, 0x10, 0x66, 0x41, 0x0f,
+  0x38, 0xdd, 0xc0, 0x48, 0x83, 0xec, 0x10, 0xf3, 0x0f, 0x7f, 0x04, 0x24,
+  0x31, 0xc9, 0x8a, 0x04, 0x0c, 0x30, 0x04, 0x0f, 0x48, 0xff, 0xc1, 0x48,
+  0x39, 0xf1, 0x73, 0x06, 0x48, 0x83, 0xf9, 0x10, 0x72, 0xec, 0x48, 0x83,
+  0xc4, 0x10, 0x48, 0x01, 0xcf, 0x48, 0x29, 0xce, 0x41, 0xff, 0xc0, 0xeb,
+  0x8c, 0xc3
+};
+unsigned int kernel_aes_ni_bin_len = 614;
+unsigned char kernel_aes_soft_bin[] = {
+  0x48, 0x85, 0xf6, 0x74, 0x70, 0x53, 0x41, 0x57, 0x48, 0x83, 0xec, 0x30,
+  0x41, 0x89, 0xd0, 0x44, 0x8b, 0x49, 0x48, 0x4c, 0x8d, 0x59, 0x50, 0x48,
+  0x8b, 0x41, 0x34, 0x48, 0x89, 0x44, 0x24, 0x20, 0x8b, 0x41, 0x3c, 0x89,
+  0x44, 0x24, 0x28, 0xf3, 0x0f, 0x6f, 0x44, 0x24, 0x20, 0xf3, 0x0f, 0x7f,
+  0x04, 0x24, 0x44, 0x89, 0xc0, 0x0f, 0xc8, 0x89, 0x44, 0x24, 0x0c, 0xf3,
+  0x0f, 0x6f, 0x04, 0x24, 0xe8, 0x31, 0x00, 0x00, 0x00, 0xf3, 0x0f, 0x7f,
+  0x04, 0x24, 0x31, 0xc9, 0x8a, 0x04, 0x0c, 0x30, 0x04, 0x0f, 0x48, 0xff,
+  0xc1, 0x48, 0x39, 0xf1, 0x73, 0x06, 0x48, 0x83, 0xf9, 0x10, 0x72, 0xec,
+  0x48, 0x01, 0xcf, 0x48, 0x29, 0xce, 0x41, 0xff, 0xc0, 0x48, 0x85, 0xf6,
+  0x75, 0xb9, 0x48, 0x83, 0xc4, 0x30, 0x41, 0x5f, 0x5b, 0xc3, 0x56, 0x57,
+  0x41, 0x50, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8d, 0x1d, 0xbb, 0x00, 0x00,
+  0x00, 0x4c, 0x8d, 0x3d, 0xa4, 0x00, 0x00, 0x00, 0x4d, 0x89, 0xda, 0x44,
+  0x89, 0xca, 0xf3, 0x45, 0x0f, 0x6f, 0x02, 0x66, 0x41, 0x0f, 0xef, 0xc0,
+  0xf3, 0x0f, 0x7f, 0x04, 0x24, 0x31, 0xc9, 0x41, 0x0f, 0xb6, 0x04, 0x0f,
+  0x0f, 0xb6, 0x04, 0x04, 0x8a, 0x04, 0x03, 0x88, 0x44, 0x0c, 0x10, 0xff,
+  0xc1, 0x83, 0xf9, 0x10, 0x72, 0xe9, 0x49, 0x83, 0xc2, 0x10, 0xff, 0xca,
+  0x74, 0x55, 0x31, 0xc9, 0x8b, 0x44, 0x8c, 0x10, 0x89, 0xc6, 0xc1, 0xce,
+  0x08, 0x31, 0xc6, 0x89, 0xf7, 0xc1, 0xcf, 0x10, 0x31, 0xf7, 0x41, 0x89,
+  0xf0, 0x41, 0x81, 0xe0, 0x80, 0x80, 0x80, 0x80, 0x41, 0xc1, 0xe8, 0x07,
+  0x45, 0x6b, 0xc0, 0x1b, 0x81, 0xe6, 0x7f, 0x7f, 0x7f, 0x7f, 0x01, 0xf6,
+  0x44, 0x31, 0xc6, 0x31, 0xf8, 0x31, 0xf0, 0x89, 0x04, 0x8c, 0xff, 0xc1,
+  0x83, 0xf9, 0x04, 0x72, 0xc3, 0xf3, 0x0f, 0x6f, 0x04, 0x24, 0xf3, 0x45,
+  0x0f, 0x6f, 0x02, 0x66, 0x41, 0x0f, 0xef, 0xc0, 0xf3, 0x0f, 0x7f, 0x04,
+  0x24, 0xeb, 0x8a, 0xf3, 0x0f, 0x6f, 0x44, 0x24, 0x10, 0xf3, 0x45, 0x0f,
+  0x6f, 0x02, 0x66, 0x41, 0x0f, 0xef, 0xc0, 0x48, 0x83, 0xc4, 0x20, 0x41,
+  0x58, 0x5f, 0x5e, 0xc3, 0x00, 0x05, 0x0a, 0x0f, 0x04, 0x09, 0x0e, 0x03,
+  0x08, 0x0d, 0x02, 0x07, 0x0c, 0x01, 0x06, 0x0b, 0x63, 0x7c, 0x77, 0x7b,
+  0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+  0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf,
+  0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc,
+  0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15, 0x04, 0xc7, 0x23, 0xc3,
+  0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+  0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3,
+  0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b,
+  0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf, 0xd0, 0xef, 0xaa, 0xfb,
+  0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+  0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21,
+  0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17,
+  0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73, 0x60, 0x81, 0x4f, 0xdc,
+  0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+  0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62,
+  0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9,
+  0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08, 0xba, 0x78, 0x25, 0x2e,
+  0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+  0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9,
+  0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94,
+  0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf, 0x8c, 0xa1, 0x89, 0x0d,
+  0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+unsigned int kernel_aes_soft_bin_len = 576;
+unsigned char kernel_aes_vaes_avx2_bin[] = {
+  0x48, 0x85, 0xf6, 0x0f, 0x84, 0x1b, 0x02, 0x00, 0x00, 0x44, 0x8b, 0x41,
+  0x48, 0x4c, 0x8d, 0x59, 0x50, 0xc5, 0x79, 0x70, 0x79, 0x30, 0x39, 0xc5,
+  0x79, 0x6e, 0xe2, 0xc4, 0xc1, 0x19, 0x73, 0xfc, 0x0c, 0xc4, 0x41, 0x01,
+  0xfe, 0xfc, 0xc4, 0x43, 0xfd, 0x00, 0xff, 0x44, 0xc5, 0x05, 0xfe, 0x3d,
+  0x0c, 0x02, 0x00, 0x00, 0xc4, 0x62, 0x7d, 0x5a, 0x35, 0x23, 0x02, 0x00,
+  0x00, 0xc4, 0x62, 0x7d, 0x5a, 0x2d, 0x2a, 0x02, 0x00, 0x00, 0xc4, 0xc2,
+  0x05, 0x00, 0xc5, 0xc4, 0x41, 0x05, 0xfe, 0xfe, 0xc4, 0xc2, 0x05, 0x00,
+  0xcd, 0xc4, 0x41, 0x05, 0xfe, 0xfe, 0xc4, 0xc2, 0x05, 0x00, 0xd5, 0xc4,
+  0x41, 0x05, 0xfe, 0xfe, 0xc4, 0xc2, 0x05, 0x00, 0xdd, 0xc4, 0x41, 0x05,
+  0xfe, 0xfe, 0xc4, 0xc2, 0x05, 0x00, 0xe5, 0xc4, 0x41, 0x05, 0xfe, 0xfe,
+  0xc4, 0xc2, 0x05, 0x00, 0xed, 0xc4, 0x41, 0x05, 0xfe, 0xfe, 0xc4, 0xc2,
+  0x05, 0x00, 0xf5, 0xc4, 0x41, 0x05, 0xfe, 0xfe, 0xc4, 0xc2, 0x05, 0x00,
+  0xfd, 0xc4, 0x41, 0x05, 0xfe, 0xfe, 0x4d, 0x89, 0xda, 0xc4, 0x42, 0x7d,
+  0x5a, 0x22, 0xc5, 0x9d, 0xef, 0xc0, 0xc5, 0x9d, 0xef, 0xc9, 0xc5, 0x9d,
+  0xef, 0xd2, 0xc5, 0x9d, 0xef, 0xdb, 0xc5, 0x9d, 0xef, 0xe4, 0xc5, 0x9d,
+  0xef, 0xed, 0xc5, 0x9d, 0xef, 0xf6, 0xc5, 0x9d, 0xef, 0xff, 0x44, 0x89,
+  0xc1, 0xff, 0xc9, 0x49, 0x83, 0xc2, 0x10, 0xc4, 0x42, 0x7d, 0x5a, 0x22,
+  0xc4, 0xc2, 0x7d, 0xdc, 0xc4, 0xc4, 0xc2, 0x75, 0xdc, 0xcc, 0xc4, 0xc2,
+  0x6d, 0xdc, 0xd4, 0xc4, 0xc2, 0x65, 0xdc, 0xdc, 0xc4, 0xc2, 0x5d, 0xdc,
+  0xe4, 0xc4, 0xc2, 0x55, 0xdc, 0xec, 0xc4, 0xc2, 0x4d, 0xdc, 0xf4, 0xc4,
+  0xc2, 0x45, 0xdc, 0xfc, 0xff, 0xc9, 0x75, 0xcb, 0xc4, 0x42, 0x7d, 0x5a,
+  0x62, 0x10, 0xc4, 0xc2, 0x7d, 0xdd, 0xc4, 0xc4, 0xc2, 0x75, 0xdd, 0xcc,
+  0xc4, 0xc2, 0x6d, 0xdd, 0xd4, 0xc4, 0xc2, 0x65, 0xdd, 0xdc, 0xc4, 0xc2,
+  0x5d, 0xdd, 0xe4, 0xc4, 0xc2, 0x55, 0xdd, 0xec, 0xc4, 0xc2, 0x4d, 0xdd,
+  0xf4, 0xc4, 0xc2, 0x45, 0xdd, 0xfc, 0x49, 0x89, 0xf9, 0x48, 0x81, 0xfe,
+  0x00, 0x01, 0x00, 0x00, 0x73, 0x4a, 0x48, 0x81, 0xec, 0x00, 0x01, 0x00,
+  0x00, 0x49, 0x89, 0xe1, 0xc4, 0x41, 0x19, 0xef, 0xe4, 0xc5, 0x7e, 0x7f,
+  0x24, 0x24, 0xc5, 0x7e, 0x7f, 0x64, 0x24, 0x20, 0xc5, 0x7e, 0x7f, 0x64,
+  0x24, 0x40, 0xc5, 0x7e, 0x7f, 0x64, 0x24, 0x60, 0xc5, 0x7e, 0x7f, 0xa4,
+  0x24, 0x80, 0x00, 0x00, 0x00, 0xc5, 0x7e, 0x7f, 0xa4, 0x24, 0xa0, 0x00,
+  0x00, 0x00, 0xc5, 0x7e, 0x7f, 0xa4, 0x24, 0xc0, 0x00, 0x00, 0x00, 0xc5,
+  0x7e, 0x7f, 0xa4, 0x24, 0xe0, 0x00, 0x00, 0x00, 0xc4, 0xc1, 0x7d, 0xef,
+  0x01, 0xc4, 0xc1, 0x7e, 0x7f, 0x01, 0xc4, 0xc1, 0x75, 0xef, 0x49, 0x20,
+  0xc4, 0xc1, 0x7e, 0x7f, 0x49, 0x20, 0xc4, 0xc1, 0x6d, 0xef, 0x51, 0x40,
+  0xc4, 0xc1, 0x7e, 0x7f, 0x51, 0x40, 0xc4, 0xc1, 0x65, 0xef, 0x59, 0x60,
+  0xc4, 0xc1, 0x7e, 0x7f, 0x59, 0x60, 0xc4, 0xc1, 0x5d, 0xef, 0xa1, 0x80,
+  0x00, 0x00, 0x00, 0xc4, 0xc1, 0x7e, 0x7f, 0xa1, 0x80, 0x00, 0x00, 0x00,
+  0xc4, 0xc1, 0x55, 0xef, 0xa9, 0xa0, 0x00, 0x00, 0x00, 0xc4, 0xc1, 0x7e,
+  0x7f, 0xa9, 0xa0, 0x00, 0x00, 0x00, 0xc4, 0xc1, 0x4d, 0xef, 0xb1, 0xc0,
+  0x00, 0x00, 0x00, 0xc4, 0xc1, 0x7e, 0x7f, 0xb1, 0xc0, 0x00, 0x00, 0x00,
+  0xc4, 0xc1, 0x45, 0xef, 0xb9, 0xe0, 0x00, 0x00, 0x00, 0xc4, 0xc1, 0x7e,
+  0x7f, 0xb9, 0xe0, 0x00, 0x00, 0x00, 0x49, 0x39, 0xf9, 0x75, 0x16, 0x48,
+  0x81, 0xc7, 0x00, 0x01, 0x00, 0x00, 0x48, 0x81, 0xee, 0x00, 0x01, 0x00,
+  0x00, 0x0f, 0x85, 0x3b, 0xfe, 0xff, 0xff, 0xeb, 0x17, 0x31, 0xc9, 0x8a,
+  0x04, 0x0c, 0x30, 0x04, 0x0f, 0x48, 0xff, 0xc1, 0x48, 0x39, 0xf1, 0x72,
+  0xf2, 0x48, 0x81, 0xc4, 0x00, 0x01, 0x00, 0x00, 0xc5, 0xf8, 0x77, 0xc3,
+  0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+  0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+  0x0f, 0x0e, 0x0d, 0x0c
+};
+unsigned int kernel_aes_vaes_avx2_bin_len = 640;
+unsigned char kernel_aes_vaes_avx512_bin[] = {
+  0x48, 0x85, 0xf6, 0x0f, 0x84, 0x4f, 0x02, 0x00, 0x00, 0x44, 0x8b, 0x41,
+  0x48, 0x4c, 0x8d, 0x59, 0x50, 0xc5, 0x79, 0x70, 0x79, 0x30, 0x39, 0xc5,
+  0x79, 0x6e, 0xe2, 0xc4, 0xc1, 0x19, 0x73, 0xfc, 0x0c, 0xc4, 0x41, 0x01,
+  0xfe, 0xfc, 0x62, 0x53, 0x05, 0x48, 0x43, 0xff, 0x00, 0x62, 0x71, 0x05,
+  0x48, 0xfe, 0x3d, 0x49, 0x02, 0x00, 0x00, 0x62, 0x72, 0x7d, 0x48, 0x5a,
+  0x35, 0x7f, 0x02, 0x00, 0x00, 0x62, 0x72, 0x7d, 0x48, 0x5a, 0x2d, 0x85,
+  0x02, 0x00, 0x00, 0x62, 0xd2, 0x05, 0x48, 0x00, 0xc5, 0x62, 0x51, 0x05,
+  0x48, 0xfe, 0xfe, 0x62, 0xd2, 0x05, 0x48, 0x00, 0xcd, 0x62, 0x51, 0x05,
+  0x48, 0xfe, 0xfe, 0x62, 0xd2, 0x05, 0x48, 0x00, 0xd5, 0x62, 0x51, 0x05,
+  0x48, 0xfe, 0xfe, 0x62, 0xd2, 0x05, 0x48, 0x00, 0xdd, 0x62, 0x51, 0x05,
+  0x48, 0xfe, 0xfe, 0x62, 0xd2, 0x05, 0x48, 0x00, 0xe5, 0x62, 0x51, 0x05,
+  0x48, 0xfe, 0xfe, 0x62, 0xd2, 0x05, 0x48, 0x00, 0xed, 0x62, 0x51, 0x05,
+  0x48, 0xfe, 0xfe, 0x62, 0xd2, 0x05, 0x48, 0x00, 0xf5, 0x62, 0x51, 0x05,
+  0x48, 0xfe, 0xfe, 0x62, 0xd2, 0x05, 0x48, 0x00, 0xfd, 0x62, 0x51, 0x05,
+  0x48, 0xfe, 0xfe, 0x4d, 0x89, 0xda, 0x62, 0x52, 0x7d, 0x48, 0x5a, 0x22,
+  0x62, 0xd1, 0x7d, 0x48, 0xef, 0xc4, 0x62, 0xd1, 0x75, 0x48, 0xef, 0xcc,
+  0x62, 0xd1, 0x6d, 0x48, 0xef, 0xd4, 0x62, 0xd1, 0x65, 0x48, 0xef, 0xdc,
+  0x62, 0xd1, 0x5d, 0x48, 0xef, 0xe4, 0x62, 0xd1, 0x55, 0x48, 0xef, 0xec,
+  0x62, 0xd1, 0x4d, 0x48, 0xef, 0xf4, 0x62, 0xd1, 0x45, 0x48, 0xef, 0xfc,
+  0x44, 0x89, 0xc1, 0xff, 0xc9, 0x49, 0x83, 0xc2, 0x10, 0x62, 0x52, 0x7d,
+  0x48, 0x5a, 0x22, 0x62, 0xd2, 0x7d, 0x48, 0xdc, 0xc4, 0x62, 0xd2, 0x75,
+  0x48, 0xdc, 0xcc, 0x62, 0xd2, 0x6d, 0x48, 0xdc, 0xd4, 0x62, 0xd2, 0x65,
+  0x48, 0xdc, 0xdc, 0x62, 0xd2, 0x5d, 0x48, 0xdc, 0xe4, 0x62, 0xd2, 0x55,
+  0x48, 0xdc, 0xec, 0x62, 0xd2, 0x4d, 0x48, 0xdc, 0xf4, 0x62, 0xd2, 0x45,
+  0x48, 0xdc, 0xfc, 0xff, 0xc9, 0x75, 0xc2, 0x62, 0x52, 0x7d, 0x48, 0x5a,
+  0x62, 0x01, 0x62, 0xd2, 0x7d, 0x48, 0xdd, 0xc4, 0x62, 0xd2, 0x75, 0x48,
+  0xdd, 0xcc, 0x62, 0xd2, 0x6d, 0x48, 0xdd, 0xd4, 0x62, 0xd2, 0x65, 0x48,
+  0xdd, 0xdc, 0x62, 0xd2, 0x5d, 0x48, 0xdd, 0xe4, 0x62, 0xd2, 0x55, 0x48,
+  0xdd, 0xec, 0x62, 0xd2, 0x4d, 0x48, 0xdd, 0xf4, 0x62, 0xd2, 0x45, 0x48,
+  0xdd, 0xfc, 0x49, 0x89, 0xf9, 0x48, 0x81, 0xfe, 0x00, 0x02, 0x00, 0x00,
+  0x73, 0x4e, 0x48, 0x81, 0xec, 0x00, 0x02, 0x00, 0x00, 0x49, 0x89, 0xe1,
+  0xc4, 0x41, 0x19, 0xef, 0xe4, 0x62, 0x71, 0x7e, 0x48, 0x7f, 0x24, 0x24,
+  0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x01, 0x62, 0x71, 0x7e, 0x48,
+  0x7f, 0x64, 0x24, 0x02, 0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x03,
+  0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x04, 0x62, 0x71, 0x7e, 0x48,
+  0x7f, 0x64, 0x24, 0x05, 0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x06,
+  0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x07, 0x62, 0xd1, 0x7d, 0x48,
+  0xef, 0x01, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x01, 0x62, 0xd1, 0x75, 0x48,
+  0xef, 0x49, 0x01, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x49, 0x01, 0x62, 0xd1,
+  0x6d, 0x48, 0xef, 0x51, 0x02, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x51, 0x02,
+  0x62, 0xd1, 0x65, 0x48, 0xef, 0x59, 0x03, 0x62, 0xd1, 0x7e, 0x48, 0x7f,
+  0x59, 0x03, 0x62, 0xd1, 0x5d, 0x48, 0xef, 0x61, 0x04, 0x62, 0xd1, 0x7e,
+  0x48, 0x7f, 0x61, 0x04, 0x62, 0xd1, 0x55, 0x48, 0xef, 0x69, 0x05, 0x62,
+  0xd1, 0x7e, 0x48, 0x7f, 0x69, 0x05, 0x62, 0xd1, 0x4d, 0x48, 0xef, 0x71,
+  0x06, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x71, 0x06, 0x62, 0xd1, 0x45, 0x48,
+  0xef, 0x79, 0x07, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x79, 0x07, 0x49, 0x39,
+  0xf9, 0x75, 0x16, 0x48, 0x81, 0xc7, 0x00, 0x02, 0x00, 0x00, 0x48, 0x81,
+  0xee, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x85, 0x0c, 0xfe, 0xff, 0xff, 0xeb,
+  0x17, 0x31, 0xc9, 0x8a, 0x04, 0x0c, 0x30, 0x04, 0x0f, 0x48, 0xff, 0xc1,
+  0x48, 0x39, 0xf1, 0x72, 0xf2, 0x48, 0x81, 0xc4, 0x00, 0x02, 0x00, 0x00,
+  0xc5, 0xf8, 0x77, 0xc3, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+  0x0f, 0x0e, 0x0d, 0x0c
+};
+unsigned int kernel_aes_vaes_avx512_bin_len = 736;
+unsigned char kernel_chacha20_avx2_bin[] = {
+  0x48, 0x85, 0xf6, 0x0f, 0x84, 0x25, 0x03, 0x00, 0x00, 0xc4, 0x62, 0x7d,
+  0x5a, 0x05, 0xce, 0x03, 0x00, 0x00, 0xc4, 0x62, 0x7d, 0x5a, 0x49, 0x10,
+  0xc4, 0x62, 0x7d, 0x5a, 0x51, 0x20, 0xc4, 0x62, 0x7d, 0x5a, 0x59, 0x30,
+  0xc5, 0x79, 0x6e, 0xe2, 0xc4, 0x43, 0xfd, 0x00, 0xe4, 0x44, 0xc4, 0x41,
+  0x25, 0xfe, 0xdc, 0xc5, 0x25, 0xfe, 0x1d, 0x45, 0x03, 0x00, 0x00, 0xc5,
+  0x7e, 0x6f, 0x35, 0xfd, 0x02, 0x00, 0x00, 0xc5, 0x7e, 0x6f, 0x3d, 0x15,
+  0x03, 0x00, 0x00, 0xc5, 0x7d, 0x7f, 0xc0, 0xc5, 0x7d, 0x7f, 0xc9, 0xc5,
+  0x7d, 0x7f, 0xd2, 0xc5, 0x7d, 0x7f, 0xdb, 0xc5, 0x7d, 0x7f, 0xc4, 0xc5,
+  0x7d, 0x7f, 0xcd, 0xc5, 0x7d, 0x7f, 0xd6, 0xc5, 0xa5, 0xfe, 0x3d, 0x31,
+  0x03, 0x00, 0x00, 0xb9, 0x0a, 0x00, 0x00, 0x00, 0xc5, 0xfd, 0xfe, 0xc1,
+  0xc5, 0xe5, 0xef, 0xd8, 0xc4, 0xc2, 0x65, 0x00, 0xde, 0xc5, 0xed, 0xfe,
+  0xd3, 0xc5, 0xf5, 0xef, 0xca, 0xc5, 0x9d, 0x72, 0xd1, 0x14, 0xc5, 0xf5,
+  0x72, 0xf1, 0x0c, 0xc5, 0x9d, 0xeb, 0xc9, 0xc5, 0xfd, 0xfe, 0xc1, 0xc5,
+  0xe5, 0xef, 0xd8, 0xc4, 0xc2, 0x65, 0x00, 0xdf, 0xc5, 0xed, 0xfe, 0xd3,
+  0xc5, 0xf5, 0xef, 0xca, 0xc5, 0x9d, 0x72, 0xd1, 0x19, 0xc5, 0xf5, 0x72,
+  0xf1, 0x07, 0xc5, 0x9d, 0xeb, 0xc9, 0xc5, 0xdd, 0xfe, 0xe5, 0xc5, 0xc5,
+  0xef, 0xfc, 0xc4, 0xc2, 0x45, 0x00, 0xfe, 0xc5, 0xcd, 0xfe, 0xf7, 0xc5,
+  0xd5, 0xef, 0xee, 0xc5, 0x95, 0x72, 0xd5, 0x14, 0xc5, 0xd5, 0x72, 0xf5,
+  0x0c, 0xc5, 0x95, 0xeb, 0xed, 0xc5, 0xdd, 0xfe, 0xe5, 0xc5, 0xc5, 0xef,
+  0xfc, 0xc4, 0xc2, 0x45, 0x00, 0xff, 0xc5, 0xcd, 0xfe, 0xf7, 0xc5, 0xd5,
+  0xef, 0xee, 0xc5, 0x95, 0x72, 0xd5, 0x19, 0xc5, 0xd5, 0x72, 0xf5, 0x07,
+  0xc5, 0x95, 0xeb, 0xed, 0xc5, 0xfd, 0x70, 0xc9, 0x39, 0xc5, 0xfd, 0x70,
+  0xd2, 0x4e, 0xc5, 0xfd, 0x70, 0xdb, 0x93, 0xc5, 0xfd, 0x70, 0xed, 0x39,
+  0xc5, 0xfd, 0x70, 0xf6, 0x4e, 0xc5, 0xfd, 0x70, 0xff, 0x93, 0xc5, 0xfd,
+  0xfe, 0xc1, 0xc5, 0xe5, 0xef, 0xd8, 0xc4, 0xc2, 0x65, 0x00, 0xde, 0xc5,
+  0xed, 0xfe, 0xd3, 0xc5, 0xf5, 0xef, 0xca, 0xc5, 0x9d, 0x72, 0xd1, 0x14,
+  0xc5, 0xf5, 0x72, 0xf1, 0x0c, 0xc5, 0x9d, 0xeb, 0xc9, 0xc5, 0xfd, 0xfe,
+  0xc1, 0xc5, 0xe5, 0xef, 0xd8, 0xc4, 0xc2, 0x65, 0x00, 0xdf, 0xc5, 0xed,
+  0xfe, 0xd3, 0xc5, 0xf5, 0xef, 0xca, 0xc5, 0x9d, 0x72, 0xd1, 0x19, 0xc5,
+  0xf5, 0x72, 0xf1, 0x07, 0xc5, 0x9d, 0xeb, 0xc9, 0xc5, 0xdd, 0xfe, 0xe5,
+  0xc5, 0xc5, 0xef, 0xfc, 0xc4, 0xc2, 0x45, 0x00, 0xfe, 0xc5, 0xcd, 0xfe,
+  0xf7, 0xc5, 0xd5, 0xef, 0xee, 0xc5, 0x95, 0x72, 0xd5, 0x14, 0xc5, 0xd5,
+  0x72, 0xf5, 0x0c, 0xc5, 0x95, 0xeb, 0xed, 0xc5, 0xdd, 0xfe, 0xe5, 0xc5,
+  0xc5, 0xef, 0xfc, 0xc4, 0xc2, 0x45, 0x00, 0xff, 0xc5, 0xcd, 0xfe, 0xf7,
+  0xc5, 0xd5, 0xef, 0xee, 0xc5, 0x95, 0x72, 0xd5, 0x19, 0xc5, 0xd5, 0x72,
+  0xf5, 0x07, 0xc5, 0x95, 0xeb, 0xed, 0xc5, 0xfd, 0x70, 0xc9, 0x93, 0xc5,
+  0xfd, 0x70, 0xd2, 0x4e, 0xc5, 0xfd, 0x70, 0xdb, 0x39, 0xc5, 0xfd, 0x70,
+  0xed, 0x93, 0xc5, 0xfd, 0x70, 0xf6, 0x4e, 0xc5, 0xfd, 0x70, 0xff, 0x39,
+  0xff, 0xc9, 0x0f, 0x85, 0xa4, 0xfe, 0xff, 0xff, 0xc5, 0xbd, 0xfe, 0xc0,
+  0xc5, 0xb5, 0xfe, 0xc9, 0xc5, 0xad, 0xfe, 0xd2, 0xc5, 0xa5, 0xfe, 0xdb,
+  0xc5, 0xbd, 0xfe, 0xe4, 0xc5, 0xb5, 0xfe, 0xed, 0xc5, 0xad, 0xfe, 0xf6,
+  0xc5, 0xa5, 0xfe, 0xff, 0xc5, 0xc5, 0xfe, 0x3d, 0xa8, 0x01, 0x00, 0x00,
+  0x49, 0x89, 0xf9, 0x48, 0x81, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x73, 0x4a,
+  0x48, 0x81, 0xec, 0x00, 0x01, 0x00, 0x00, 0x49, 0x89, 0xe1, 0xc4, 0x41,
+  0x19, 0xef, 0xe4, 0xc5, 0x7e, 0x7f, 0x24, 0x24, 0xc5, 0x7e, 0x7f, 0x64,
+  0x24, 0x20, 0xc5, 0x7e, 0x7f, 0x64, 0x24, 0x40, 0xc5, 0x7e, 0x7f, 0x64,
+  0x24, 0x60, 0xc5, 0x7e, 0x7f, 0xa4, 0x24, 0x80, 0x00, 0x00, 0x00, 0xc5,
+  0x7e, 0x7f, 0xa4, 0x24, 0xa0, 0x00, 0x00, 0x00, 0xc5, 0x7e, 0x7f, 0xa4,
+  0x24, 0xc0, 0x00, 0x00, 0x00, 0xc5, 0x7e, 0x7f, 0xa4, 0x24, 0xe0, 0x00,
+  0x00, 0x00, 0xc4, 0x63, 0x7d, 0x46, 0xe1, 0x20, 0xc4, 0x41, 0x1d, 0xef,
+  0x21, 0xc4, 0x41, 0x7e, 0x7f, 0x21, 0xc4, 0x63, 0x6d, 0x46, 0xe3, 0x20,
+  0xc4, 0x41, 0x1d, 0xef, 0x61, 0x20, 0xc4, 0x41, 0x7e, 0x7f, 0x61, 0x20,
+  0xc4, 0x63, 0x7d, 0x46, 0xe1, 0x31, 0xc4, 0x41, 0x1d, 0xef, 0x61, 0x40,
+  0xc4, 0x41, 0x7e, 0x7f, 0x61, 0x40, 0xc4, 0x63, 0x6d, 0x46, 0xe3, 0x31,
+  0xc4, 0x41, 0x1d, 0xef, 0x61, 0x60, 0xc4, 0x41, 0x7e, 0x7f, 0x61, 0x60,
+  0xc4, 0x63, 0x5d, 0x46, 0xe5, 0x20, 0xc4, 0x41, 0x1d, 0xef, 0xa1, 0x80,
+  0x00, 0x00, 0x00, 0xc4, 0x41, 0x7e, 0x7f, 0xa1, 0x80, 0x00, 0x00, 0x00,
+  0xc4, 0x63, 0x4d, 0x46, 0xe7, 0x20, 0xc4, 0x41, 0x1d, 0xef, 0xa1, 0xa0,
+  0x00, 0x00, 0x00, 0xc4, 0x41, 0x7e, 0x7f, 0xa1, 0xa0, 0x00, 0x00, 0x00,
+  0xc4, 0x63, 0x5d, 0x46, 0xe5, 0x31, 0xc4, 0x41, 0x1d, 0xef, 0xa1, 0xc0,
+  0x00, 0x00, 0x00, 0xc4, 0x41, 0x7e, 0x7f, 0xa1, 0xc0, 0x00, 0x00, 0x00,
+  0xc4, 0x63, 0x4d, 0x46, 0xe7, 0x31, 0xc4, 0x41, 0x1d, 0xef, 0xa1, 0xe0,
+  0x00, 0x00, 0x00, 0xc4, 0x41, 0x7e, 0x7f, 0xa1, 0xe0, 0x00, 0x00, 0x00,
+  0x49, 0x39, 0xf9, 0x75, 0x1e, 0xc5, 0x25, 0xfe, 0x1d, 0xbf, 0x00, 0x00,
+  0x00, 0x48, 0x81, 0xc7, 0x00, 0x01, 0x00, 0x00, 0x48, 0x81, 0xee, 0x00,
+  0x01, 0x00, 0x00, 0x0f, 0x85, 0x36, 0xfd, 0xff, 0xff, 0xeb, 0x17, 0x31,
+  0xc9, 0x8a, 0x04, 0x0c, 0x30, 0x04, 0x0f, 0x48, 0xff, 0xc1, 0x48, 0x39,
+  0xf1, 0x72, 0xf2, 0x48, 0x81, 0xc4, 0x00, 0x01, 0x00, 0x00, 0xc5, 0xf8,
+  0x77, 0xc3, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x1f, 0x00, 0x02, 0x03, 0x00, 0x01, 0x06, 0x07, 0x04, 0x05,
+  0x0a, 0x0b, 0x08, 0x09, 0x0e, 0x0f, 0x0c, 0x0d, 0x02, 0x03, 0x00, 0x01,
+  0x06, 0x07, 0x04, 0x05, 0x0a, 0x0b, 0x08, 0x09, 0x0e, 0x0f, 0x0c, 0x0d,
+  0x03, 0x00, 0x01, 0x02, 0x07, 0x04, 0x05, 0x06, 0x0b, 0x08, 0x09, 0x0a,
+  0x0f, 0x0c, 0x0d, 0x0e, 0x03, 0x00, 0x01, 0x02, 0x07, 0x04, 0x05, 0x06,
+  0x0b, 0x08, 0x09, 0x0a, 0x0f, 0x0c, 0x0d, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x78, 0x70, 0x61,
+  0x6e, 0x64, 0x20, 0x33, 0x32, 0x2d, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6b
+};
+unsigned int kernel_chacha20_avx2_bin_len = 1008;
+unsigned char kernel_chacha20_avx512_bin[] = {
+  0x48, 0x85, 0xf6, 0x0f, 0x84, 0xad, 0x03, 0x00, 0x00, 0x62, 0x72, 0x7d,
+  0x48, 0x5a, 0x05, 0x6d, 0x04, 0x00, 0x00, 0x62, 0x72, 0x7d, 0x48, 0x5a,
+  0x49, 0x01, 0x62, 0x72, 0x7d, 0x48, 0x5a, 0x51, 0x02, 0x62, 0x72, 0x7d,
+  0x48, 0x5a, 0x59, 0x03, 0xc5, 0x79, 0x6e, 0xe2, 0x62, 0x53, 0x1d, 0x48,
+  0x43, 0xe4, 0x00, 0x62, 0x51, 0x25, 0x48, 0xfe, 0xdc, 0x62, 0x71, 0x25,
+  0x48, 0xfe, 0x1d, 0x7d, 0x03, 0x00, 0x00, 0x62, 0xd1, 0x7d, 0x48, 0x6f,
+  0xc0, 0x62, 0xd1, 0x7d, 0x48, 0x6f, 0xc9, 0x62, 0xd1, 0x7d, 0x48, 0x6f,
+  0xd2, 0x62, 0xd1, 0x7d, 0x48, 0x6f, 0xdb, 0x62, 0xd1, 0x7d, 0x48, 0x6f,
+  0xe0, 0x62, 0xd1, 0x7d, 0x48, 0x6f, 0xe9, 0x62, 0xd1, 0x7d, 0x48, 0x6f,
+  0xf2, 0x62, 0xf1, 0x25, 0x48, 0xfe, 0x3d, 0x89, 0x03, 0x00, 0x00, 0xb9,
+  0x0a, 0x00, 0x00, 0x00, 0x62, 0xf1, 0x7d, 0x48, 0xfe, 0xc1, 0x62, 0xf1,
+  0x65, 0x48, 0xef, 0xd8, 0x62, 0xf1, 0x65, 0x48, 0x72, 0xcb, 0x10, 0x62,
+  0xf1, 0x6d, 0x48, 0xfe, 0xd3, 0x62, 0xf1, 0x75, 0x48, 0xef, 0xca, 0x62,
+  0xf1, 0x75, 0x48, 0x72, 0xc9, 0x0c, 0x62, 0xf1, 0x7d, 0x48, 0xfe, 0xc1,
+  0x62, 0xf1, 0x65, 0x48, 0xef, 0xd8, 0x62, 0xf1, 0x65, 0x48, 0x72, 0xcb,
+  0x08, 0x62, 0xf1, 0x6d, 0x48, 0xfe, 0xd3, 0x62, 0xf1, 0x75, 0x48, 0xef,
+  0xca, 0x62, 0xf1, 0x75, 0x48, 0x72, 0xc9, 0x07, 0x62, 0xf1, 0x5d, 0x48,
+  0xfe, 0xe5, 0x62, 0xf1, 0x45, 0x48, 0xef, 0xfc, 0x62, 0xf1, 0x45, 0x48,
+  0x72, 0xcf, 0x10, 0x62, 0xf1, 0x4d, 0x48, 0xfe, 0xf7, 0x62, 0xf1, 0x55,
+  0x48, 0xef, 0xee, 0x62, 0xf1, 0x55, 0x48, 0x72, 0xcd, 0x0c, 0x62, 0xf1,
+  0x5d, 0x48, 0xfe, 0xe5, 0x62, 0xf1, 0x45, 0x48, 0xef, 0xfc, 0x62, 0xf1,
+  0x45, 0x48, 0x72, 0xcf, 0x08, 0x62, 0xf1, 0x4d, 0x48, 0xfe, 0xf7, 0x62,
+  0xf1, 0x55, 0x48, 0xef, 0xee, 0x62, 0xf1, 0x55, 0x48, 0x72, 0xcd, 0x07,
+  0x62, 0xf1, 0x7d, 0x48, 0x70, 0xc9, 0x39, 0x62, 0xf1, 0x7d, 0x48, 0x70,
+  0xd2, 0x4e, 0x62, 0xf1, 0x7d, 0x48, 0x70, 0xdb, 0x93, 0x62, 0xf1, 0x7d,
+  0x48, 0x70, 0xed, 0x39, 0x62, 0xf1, 0x7d, 0x48, 0x70, 0xf6, 0x4e, 0x62,
+  0xf1, 0x7d, 0x48, 0x70, 0xff, 0x93, 0x62, 0xf1, 0x7d, 0x48, 0xfe, 0xc1,
+  0x62, 0xf1, 0x65, 0x48, 0xef, 0xd8, 0x62, 0xf1, 0x65, 0x48, 0x72, 0xcb,
+  0x10, 0x62, 0xf1, 0x6d, 0x48, 0xfe, 0xd3, 0x62, 0xf1, 0x75, 0x48, 0xef,
+  0xca, 0x62, 0xf1, 0x75, 0x48, 0x72, 0xc9, 0x0c, 0x62, 0xf1, 0x7d, 0x48,
+  0xfe, 0xc1, 0x62, 0xf1, 0x65, 0x48, 0xef, 0xd8, 0x62, 0xf1, 0x65, 0x48,
+  0x72, 0xcb, 0x08, 0x62, 0xf1, 0x6d, 0x48, 0xfe, 0xd3, 0x62, 0xf1, 0x75,
+  0x48, 0xef, 0xca, 0x62, 0xf1, 0x75, 0x48, 0x72, 0xc9, 0x07, 0x62, 0xf1,
+  0x5d, 0x48, 0xfe, 0xe5, 0x62, 0xf1, 0x45, 0x48, 0xef, 0xfc, 0x62, 0xf1,
+  0x45, 0x48, 0x72, 0xcf, 0x10, 0x62, 0xf1, 0x4d, 0x48, 0xfe, 0xf7, 0x62,
+  0xf1, 0x55, 0x48, 0xef, 0xee, 0x62, 0xf1, 0x55, 0x48, 0x72, 0xcd, 0x0c,
+  0x62, 0xf1, 0x5d, 0x48, 0xfe, 0xe5, 0x62, 0xf1, 0x45, 0x48, 0xef, 0xfc,
+  0x62, 0xf1, 0x45, 0x48, 0x72, 0xcf, 0x08, 0x62, 0xf1, 0x4d, 0x48, 0xfe,
+  0xf7, 0x62, 0xf1, 0x55, 0x48, 0xef, 0xee, 0x62, 0xf1, 0x55, 0x48, 0x72,
+  0xcd, 0x07, 0x62, 0xf1, 0x7d, 0x48, 0x70, 0xc9, 0x93, 0x62, 0xf1, 0x7d,
+  0x48, 0x70, 0xd2, 0x4e, 0x62, 0xf1, 0x7d, 0x48, 0x70, 0xdb, 0x39, 0x62,
+  0xf1, 0x7d, 0x48, 0x70, 0xed, 0x93, 0x62, 0xf1, 0x7d, 0x48, 0x70, 0xf6,
+  0x4e, 0x62, 0xf1, 0x7d, 0x48, 0x70, 0xff, 0x39, 0xff, 0xc9, 0x0f, 0x85,
+  0x74, 0xfe, 0xff, 0xff, 0x62, 0xd1, 0x7d, 0x48, 0xfe, 0xc0, 0x62, 0xd1,
+  0x75, 0x48, 0xfe, 0xc9, 0x62, 0xd1, 0x6d, 0x48, 0xfe, 0xd2, 0x62, 0xd1,
+  0x65, 0x48, 0xfe, 0xdb, 0x62, 0xd1, 0x5d, 0x48, 0xfe, 0xe0, 0x62, 0xd1,
+  0x55, 0x48, 0xfe, 0xe9, 0x62, 0xd1, 0x4d, 0x48, 0xfe, 0xf2, 0x62, 0xd1,
+  0x45, 0x48, 0xfe, 0xfb, 0x62, 0xf1, 0x45, 0x48, 0xfe, 0x3d, 0xbe, 0x01,
+  0x00, 0x00, 0x49, 0x89, 0xf9, 0x48, 0x81, 0xfe, 0x00, 0x02, 0x00, 0x00,
+  0x73, 0x4e, 0x48, 0x81, 0xec, 0x00, 0x02, 0x00, 0x00, 0x49, 0x89, 0xe1,
+  0xc4, 0x41, 0x19, 0xef, 0xe4, 0x62, 0x71, 0x7e, 0x48, 0x7f, 0x24, 0x24,
+  0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x01, 0x62, 0x71, 0x7e, 0x48,
+  0x7f, 0x64, 0x24, 0x02, 0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x03,
+  0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x04, 0x62, 0x71, 0x7e, 0x48,
+  0x7f, 0x64, 0x24, 0x05, 0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x06,
+  0x62, 0x71, 0x7e, 0x48, 0x7f, 0x64, 0x24, 0x07, 0x62, 0x73, 0x7d, 0x48,
+  0x43, 0xe1, 0x44, 0x62, 0x73, 0x6d, 0x48, 0x43, 0xeb, 0x44, 0x62, 0x73,
+  0x7d, 0x48, 0x43, 0xf1, 0xee, 0x62, 0x73, 0x6d, 0x48, 0x43, 0xfb, 0xee,
+  0x62, 0xd3, 0x1d, 0x48, 0x43, 0xc5, 0x88, 0x62, 0xd3, 0x1d, 0x48, 0x43,
+  0xcd, 0xdd, 0x62, 0xd3, 0x0d, 0x48, 0x43, 0xd7, 0x88, 0x62, 0xd3, 0x0d,
+  0x48, 0x43, 0xdf, 0xdd, 0x62, 0xd1, 0x7d, 0x48, 0xef, 0x01, 0x62, 0xd1,
+  0x7e, 0x48, 0x7f, 0x01, 0x62, 0xd1, 0x75, 0x48, 0xef, 0x49, 0x01, 0x62,
+  0xd1, 0x7e, 0x48, 0x7f, 0x49, 0x01, 0x62, 0xd1, 0x6d, 0x48, 0xef, 0x51,
+  0x02, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x51, 0x02, 0x62, 0xd1, 0x65, 0x48,
+  0xef, 0x59, 0x03, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x59, 0x03, 0x62, 0x73,
+  0x5d, 0x48, 0x43, 0xe5, 0x44, 0x62, 0x73, 0x4d, 0x48, 0x43, 0xef, 0x44,
+  0x62, 0x73, 0x5d, 0x48, 0x43, 0xf5, 0xee, 0x62, 0x73, 0x4d, 0x48, 0x43,
+  0xff, 0xee, 0x62, 0xd3, 0x1d, 0x48, 0x43, 0xe5, 0x88, 0x62, 0xd3, 0x1d,
+  0x48, 0x43, 0xed, 0xdd, 0x62, 0xd3, 0x0d, 0x48, 0x43, 0xf7, 0x88, 0x62,
+  0xd3, 0x0d, 0x48, 0x43, 0xff, 0xdd, 0x62, 0xd1, 0x5d, 0x48, 0xef, 0x61,
+  0x04, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x61, 0x04, 0x62, 0xd1, 0x55, 0x48,
+  0xef, 0x69, 0x05, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x69, 0x05, 0x62, 0xd1,
+  0x4d, 0x48, 0xef, 0x71, 0x06, 0x62, 0xd1, 0x7e, 0x48, 0x7f, 0x71, 0x06,
+  0x62, 0xd1, 0x45, 0x48, 0xef, 0x79, 0x07, 0x62, 0xd1, 0x7e, 0x48, 0x7f,
+  0x79, 0x07, 0x49, 0x39, 0xf9, 0x75, 0x20, 0x62, 0x71, 0x25, 0x48, 0xfe,
+  0x1d, 0xb7, 0x00, 0x00, 0x00, 0x48, 0x81, 0xc7, 0x00, 0x02, 0x00, 0x00,
+  0x48, 0x81, 0xee, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x85, 0xa6, 0xfc, 0xff,
+  0xff, 0xeb, 0x17, 0x31, 0xc9, 0x8a, 0x04, 0x0c, 0x30, 0x04, 0x0f, 0x48,
+  0xff, 0xc1, 0x48, 0x39, 0xf1, 0x72, 0xf2, 0x48, 0x81, 0xc4, 0x00, 0x02,
+  0x00, 0x00, 0xc5, 0xf8, 0x77, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x20, 0x33, 0x32, 0x2d, 0x62, 0x79,
+  0x74, 0x65, 0x20, 0x6b
+};
+unsigned int kernel_chacha20_avx512_bin_len = 1168;
+unsigned char kernel_chacha20_sse2_bin[] = {
+  0x48, 0x85, 0xf6, 0x0f, 0x84, 0x22, 0x03, 0x00, 0x00, 0xf3, 0x44, 0x0f,
+  0x6f, 0x05, 0x68, 0x03, 0x00, 0x00, 0xf3, 0x44, 0x0f, 0x6f, 0x49, 0x10,
+  0xf3, 0x44, 0x0f, 0x6f, 0x51, 0x20, 0xf3, 0x44, 0x0f, 0x6f, 0x59, 0x30,
+  0x66, 0x44, 0x0f, 0x6e, 0xe2, 0x66, 0x45, 0x0f, 0xfe, 0xdc, 0xf3, 0x44,
+  0x0f, 0x6f, 0x35, 0x53, 0x03, 0x00, 0x00, 0xf3, 0x44, 0x0f, 0x6f, 0x3d,
+  0x5a, 0x03, 0x00, 0x00, 0x66, 0x41, 0x0f, 0x6f, 0xc0, 0x66, 0x41, 0x0f,
+  0x6f, 0xc9, 0x66, 0x41, 0x0f, 0x6f, 0xd2, 0x66, 0x41, 0x0f, 0x6f, 0xdb,
+  0x66, 0x41, 0x0f, 0x6f, 0xe0, 0x66, 0x41, 0x0f, 0x6f, 0xe9, 0x66, 0x41,
+  0x0f, 0x6f, 0xf2, 0x66, 0x41, 0x0f, 0x6f, 0xfb, 0x66, 0x41, 0x0f, 0xfe,
+  0xfe, 0xb9, 0x0a, 0x00, 0x00, 0x00, 0x66, 0x0f, 0xfe, 0xc1, 0x66, 0x0f,
+  0xef, 0xd8, 0xf2, 0x0f, 0x70, 0xdb, 0xb1, 0xf3, 0x0f, 0x70, 0xdb, 0xb1,
+  0x66, 0x0f, 0xfe, 0xd3, 0x66, 0x0f, 0xef, 0xca, 0x66, 0x44, 0x0f, 0x6f,
+  0xe1, 0x66, 0x0f, 0x72, 0xf1, 0x0c, 0x66, 0x41, 0x0f, 0x72, 0xd4, 0x14,
+  0x66, 0x41, 0x0f, 0xeb, 0xcc, 0x66, 0x0f, 0xfe, 0xc1, 0x66, 0x0f, 0xef,
+  0xd8, 0x66, 0x44, 0x0f, 0x6f, 0xe3, 0x66, 0x0f, 0x72, 0xf3, 0x08, 0x66,
+  0x41, 0x0f, 0x72, 0xd4, 0x18, 0x66, 0x41, 0x0f, 0xeb, 0xdc, 0x66, 0x0f,
+  0xfe, 0xd3, 0x66, 0x0f, 0xef, 0xca, 0x66, 0x44, 0x0f, 0x6f, 0xe1, 0x66,
+  0x0f, 0x72, 0xf1, 0x07, 0x66, 0x41, 0x0f, 0x72, 0xd4, 0x19, 0x66, 0x41,
+  0x0f, 0xeb, 0xcc, 0x66, 0x0f, 0xfe, 0xe5, 0x66, 0x0f, 0xef, 0xfc, 0xf2,
+  0x0f, 0x70, 0xff, 0xb1, 0xf3, 0x0f, 0x70, 0xff, 0xb1, 0x66, 0x0f, 0xfe,
+  0xf7, 0x66, 0x0f, 0xef, 0xee, 0x66, 0x44, 0x0f, 0x6f, 0xed, 0x66, 0x0f,
+  0x72, 0xf5, 0x0c, 0x66, 0x41, 0x0f, 0x72, 0xd5, 0x14, 0x66, 0x41, 0x0f,
+  0xeb, 0xed, 0x66, 0x0f, 0xfe, 0xe5, 0x66, 0x0f, 0xef, 0xfc, 0x66, 0x44,
+  0x0f, 0x6f, 0xef, 0x66, 0x0f, 0x72, 0xf7, 0x08, 0x66, 0x41, 0x0f, 0x72,
+  0xd5, 0x18, 0x66, 0x41, 0x0f, 0xeb, 0xfd, 0x66, 0x0f, 0xfe, 0xf7, 0x66,
+  0x0f, 0xef, 0xee, 0x66, 0x44, 0x0f, 0x6f, 0xed, 0x66, 0x0f, 0x72, 0xf5,
+  0x07, 0x66, 0x41, 0x0f, 0x72, 0xd5, 0x19, 0x66, 0x41, 0x0f, 0xeb, 0xed,
+  0x66, 0x0f, 0x70, 0xc9, 0x39, 0x66, 0x0f, 0x70, 0xd2, 0x4e, 0x66, 0x0f,
+  0x70, 0xdb, 0x93, 0x66, 0x0f, 0x70, 0xed, 0x39, 0x66, 0x0f, 0x70, 0xf6,
+  0x4e, 0x66, 0x0f, 0x70, 0xff, 0x93, 0x66, 0x0f, 0xfe, 0xc1, 0x66, 0x0f,
+  0xef, 0xd8, 0xf2, 0x0f, 0x70, 0xdb, 0xb1, 0xf3, 0x0f, 0x70, 0xdb, 0xb1,
+  0x66, 0x0f, 0xfe, 0xd3, 0x66, 0x0f, 0xef, 0xca, 0x66, 0x44, 0x0f, 0x6f,
+  0xe1, 0x66, 0x0f, 0x72, 0xf1, 0x0c, 0x66, 0x41, 0x0f, 0x72, 0xd4, 0x14,
+  0x66, 0x41, 0x0f, 0xeb, 0xcc, 0x66, 0x0f, 0xfe, 0xc1, 0x66, 0x0f, 0xef,
+  0xd8, 0x66, 0x44, 0x0f, 0x6f, 0xe3, 0x66, 0x0f, 0x72, 0xf3, 0x08, 0x66,
+  0x41, 0x0f, 0x72, 0xd4, 0x18, 0x66, 0x41, 0x0f, 0xeb, 0xdc, 0x66, 0x0f,
+  0xfe, 0xd3, 0x66, 0x0f, 0xef, 0xca, 0x66, 0x44, 0x0f, 0x6f, 0xe1, 0x66,
+  0x0f, 0x72, 0xf1, 0x07, 0x66, 0x41, 0x0f, 0x72, 0xd4, 0x19, 0x66, 0x41,
+  0x0f, 0xeb, 0xcc, 0x66, 0x0f, 0xfe, 0xe5, 0x66, 0x0f, 0xef, 0xfc, 0xf2,
+  0x0f, 0x70, 0xff, 0xb1, 0xf3, 0x0f, 0x70, 0xff, 0xb1, 0x66, 0x0f, 0xfe,
+  0xf7, 0x66, 0x0f, 0xef, 0xee, 0x66, 0x44, 0x0f, 0x6f, 0xed, 0x66, 0x0f,
+  0x72, 0xf5, 0x0c, 0x66, 0x41, 0x0f, 0x72, 0xd5, 0x14, 0x66, 0x41, 0x0f,
+  0xeb, 0xed, 0x66, 0x0f, 0xfe, 0xe5, 0x66, 0x0f, 0xef, 0xfc, 0x66, 0x44,
+  0x0f, 0x6f, 0xef, 0x66, 0x0f, 0x72, 0xf7, 0x08, 0x66, 0x41, 0x0f, 0x72,
+  0xd5, 0x18, 0x66, 0x41, 0x0f, 0xeb, 0xfd, 0x66, 0x0f, 0xfe, 0xf7, 0x66,
+  0x0f, 0xef, 0xee, 0x66, 0x44, 0x0f, 0x6f, 0xed, 0x66, 0x0f, 0x72, 0xf5,
+  0x07, 0x66, 0x41, 0x0f, 0x72, 0xd5, 0x19, 0x66, 0x41, 0x0f, 0xeb, 0xed,
+  0x66, 0x0f, 0x70, 0xc9, 0x93, 0x66, 0x0f, 0x70, 0xd2, 0x4e, 0x66, 0x0f,
+  0x70, 0xdb, 0x39, 0x66, 0x0f, 0x70, 0xed, 0x93, 0x66, 0x0f, 0x70, 0xf6,
+  0x4e, 0x66, 0x0f, 0x70, 0xff, 0x39, 0xff, 0xc9, 0x0f, 0x85, 0x18, 0xfe,
+  0xff, 0xff, 0x66, 0x41, 0x0f, 0xfe, 0xc0, 0x66, 0x41, 0x0f, 0xfe, 0xc9,
+  0x66, 0x41, 0x0f, 0xfe, 0xd2, 0x66, 0x41, 0x0f, 0xfe, 0xdb, 0x66, 0x41,
+  0x0f, 0xfe, 0xe0, 0x66, 0x41, 0x0f, 0xfe, 0xe9, 0x66, 0x41, 0x0f, 0xfe,
+  0xf2, 0x66, 0x41, 0x0f, 0xfe, 0xfb, 0x66, 0x41, 0x0f, 0xfe, 0xfe, 0x48,
+  0x81, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x0f, 0x82, 0x98, 0x00, 0x00, 0x00,
+  0xf3, 0x44, 0x0f, 0x6f, 0x27, 0x66, 0x41, 0x0f, 0xef, 0xc4, 0xf3, 0x0f,
+  0x7f, 0x07, 0xf3, 0x44, 0x0f, 0x6f, 0x67, 0x10, 0x66, 0x41, 0x0f, 0xef,
+  0xcc, 0xf3, 0x0f, 0x7f, 0x4f, 0x10, 0xf3, 0x44, 0x0f, 0x6f, 0x67, 0x20,
+  0x66, 0x41, 0x0f, 0xef, 0xd4, 0xf3, 0x0f, 0x7f, 0x57, 0x20, 0xf3, 0x44,
+  0x0f, 0x6f, 0x67, 0x30, 0x66, 0x41, 0x0f, 0xef, 0xdc, 0xf3, 0x0f, 0x7f,
+  0x5f, 0x30, 0xf3, 0x44, 0x0f, 0x6f, 0x67, 0x40, 0x66, 0x41, 0x0f, 0xef,
+  0xe4, 0xf3, 0x0f, 0x7f, 0x67, 0x40, 0xf3, 0x44, 0x0f, 0x6f, 0x67, 0x50,
+  0x66, 0x41, 0x0f, 0xef, 0xec, 0xf3, 0x0f, 0x7f, 0x6f, 0x50, 0xf3, 0x44,
+  0x0f, 0x6f, 0x67, 0x60, 0x66, 0x41, 0x0f, 0xef, 0xf4, 0xf3, 0x0f, 0x7f,
+  0x77, 0x60, 0xf3, 0x44, 0x0f, 0x6f, 0x67, 0x70, 0x66, 0x41, 0x0f, 0xef,
+  0xfc, 0xf3, 0x0f, 0x7f, 0x7f, 0x70, 0x66, 0x45, 0x0f, 0xfe, 0xdf, 0x48,
+  0x81, 0xc7, 0x80, 0x00, 0x00, 0x00, 0x48, 0x81, 0xee, 0x80, 0x00, 0x00,
+  0x00, 0x0f, 0x85, 0x15, 0xfd, 0xff, 0xff, 0xc3, 0x48, 0x81, 0xec, 0x80,
+  0x00, 0x00, 0x00, 0xf3, 0x0f, 0x7f, 0x04, 0x24, 0xf3, 0x0f, 0x7f, 0x4c,
+  0x24, 0x10, 0xf3, 0x0f, 0x7f, 0x54, 0x24, 0x20, 0xf3, 0x0f, 0x7f, 0x5c,
+  0x24, 0x30, 0xf3, 0x0f, 0x7f, 0x64, 0x24, 0x40, 0xf3, 0x0f, 0x7f, 0x6c,
+  0x24, 0x50, 0xf3, 0x0f, 0x7f, 0x74, 0x24, 0x60, 0xf3, 0x0f, 0x7f, 0x7c,
+  0x24, 0x70, 0x31, 0xc9, 0x8a, 0x04, 0x0c, 0x30, 0x04, 0x0f, 0x48, 0xff,
+  0xc1, 0x48, 0x39, 0xf1, 0x72, 0xf2, 0x48, 0x81, 0xc4, 0x80, 0x00, 0x00,
+  0x00, 0xc3, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x20, 0x33, 0x32, 0x2d,
+  0x62, 0x79, 0x74, 0x65, 0x20, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00
+};
+unsigned int kernel_chacha20_sse2_bin_len = 938;
 unsigned char stub_bin[] = {
   0x57, 0x56, 0x52, 0x51, 0x50, 0x41, 0x50, 0x41, 0x51, 0x41, 0x52, 0x41,
-  0x53, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48,
-  0x8d, 0x35, 0x20, 0x00, 0x00, 0x00, 0xba, 0x07, 0x00, 0x00, 0x00, 0x0f,
-  0x05, 0x41, 0x5b, 0x41, 0x5a, 0x41, 0x59, 0x41, 0x58, 0x58, 0x59, 0x5a,
-  0x5e, 0x5f, 0x48, 0xb8, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11,
-  0xff, 0xe0, 0x69, 0x6e, 0x73, 0x6b, 0x69, 0x6d, 0x0a
+  0x53, 0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0xb8,
+  0x01, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x35,
+  0x31, 0x0b, 0x00, 0x00, 0xba, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x05, 0xe8,
+  0x5b, 0x08, 0x00, 0x00, 0x48, 0x8d, 0x1d, 0x7d, 0x0f, 0x00, 0x00, 0x8b,
+  0x0d, 0x6f, 0x0f, 0x00, 0x00, 0x85, 0xc9, 0x0f, 0x84, 0x04, 0x0b, 0x00,
+  0x00, 0x8b, 0x53, 0x04, 0x21, 0xc2, 0x3b, 0x53, 0x04, 0x74, 0x08, 0x48,
+  0x83, 0xc3, 0x08, 0xff, 0xc9, 0xeb, 0xe6, 0x44, 0x8b, 0x3b, 0x48, 0x8d,
+  0x1d, 0x9b, 0xff, 0xff, 0xff, 0x49, 0x01, 0xdf, 0x4c, 0x8d, 0x25, 0x91,
+  0xff, 0xff, 0xff, 0x4c, 0x2b, 0x25, 0x02, 0x0e, 0x00, 0x00, 0xe8, 0xf8,
+  0x03, 0x00, 0x00, 0x83, 0x3d, 0x66, 0x10, 0x00, 0x00, 0x00, 0x75, 0x13,
+  0x83, 0x3d, 0x4d, 0x10, 0x00, 0x00, 0x00, 0x74, 0x24, 0xe8, 0x06, 0x06,
+  0x00, 0x00, 0xe9, 0xba, 0x00, 0x00, 0x00, 0x4c, 0x89, 0x25, 0xc2, 0x0a,
+  0x00, 0x00, 0x4c, 0x89, 0x3d, 0xc3, 0x0a, 0x00, 0x00, 0x48, 0x8d, 0x3d,
+  0xc0, 0x06, 0x00, 0x00, 0xe8, 0x8c, 0x07, 0x00, 0x00, 0x4c, 0x8d, 0x2d,
+  0x20, 0x0f, 0x00, 0x00, 0x44, 0x8b, 0x35, 0xf1, 0x0d, 0x00, 0x00, 0x45,
+  0x85, 0xf6, 0x0f, 0x84, 0x89, 0x00, 0x00, 0x00, 0x83, 0x3d, 0x19, 0x10,
+  0x00, 0x00, 0x00, 0x74, 0x07, 0xe8, 0xc4, 0x02, 0x00, 0x00, 0xeb, 0x6d,
+  0xba, 0x03, 0x00, 0x00, 0x00, 0xe8, 0x38, 0x0a, 0x00, 0x00, 0x41, 0x83,
+  0x7d, 0x1c, 0x00, 0x75, 0x12, 0x49, 0x8b, 0x7d, 0x00, 0x4c, 0x01, 0xe7,
+  0x49, 0x8b, 0x75, 0x08, 0xe8, 0xbd, 0x00, 0x00, 0x00, 0xeb, 0x41, 0x48,
+  0x8d, 0x1d, 0xfe, 0xfe, 0xff, 0xff, 0x41, 0x8b, 0x7d, 0x14, 0x48, 0x01,
+  0xdf, 0x41, 0x8b, 0x75, 0x1c, 0x41, 0x8b, 0x55, 0x10, 0x48, 0x8d, 0x0d,
+  0x58, 0x0d, 0x00, 0x00, 0x41, 0xff, 0xd7, 0x41, 0x8b, 0x75, 0x14, 0x48,
+  0x01, 0xde, 0x41, 0x8b, 0x4d, 0x1c, 0x49, 0x8b, 0x7d, 0x00, 0x4c, 0x01,
+  0xe7, 0x49, 0x8b, 0x55, 0x08, 0x8b, 0x05, 0x85, 0x0d, 0x00, 0x00, 0xe8,
+  0xc3, 0x07, 0x00, 0x00, 0x41, 0x8b, 0x55, 0x18, 0xe8, 0xd5, 0x09, 0x00,
+  0x00, 0x49, 0x83, 0xc5, 0x20, 0x41, 0xff, 0xce, 0xe9, 0x6e, 0xff, 0xff,
+  0xff, 0xe8, 0xbc, 0x02, 0x00, 0x00, 0x41, 0x5f, 0x41, 0x5e, 0x41, 0x5d,
+  0x41, 0x5c, 0x5d, 0x5b, 0x41, 0x5b, 0x41, 0x5a, 0x41, 0x59, 0x41, 0x58,
+  0x58, 0x59, 0x5a, 0x5e, 0x5f, 0x48, 0x8d, 0x05, 0x8c, 0xfe, 0xff, 0xff,
+  0x48, 0x2b, 0x05, 0xfd, 0x0c, 0x00, 0x00, 0x48, 0x03, 0x05, 0xee, 0x0c,
+  0x00, 0x00, 0xff, 0xe0, 0xb9, 0x06, 0x00, 0x00, 0x00, 0x83, 0x3d, 0x24,
+  0x0d, 0x00, 0x00, 0x00, 0x74, 0x05, 0xb9, 0x04, 0x00, 0x00, 0x00, 0xc3,
+  0x49, 0x8b, 0x55, 0x00, 0x4c, 0x01, 0xe2, 0x48, 0x83, 0xe2, 0xc0, 0x48,
+  0xf7, 0xda, 0x48, 0x01, 0xfa, 0xe8, 0xd6, 0xff, 0xff, 0xff, 0x48, 0xd3,
+  0xea, 0x41, 0x03, 0x55, 0x10, 0xc3, 0x53, 0x55, 0x48, 0x83, 0xec, 0x50,
+  0x48, 0x89, 0xfb, 0x48, 0x89, 0xf5, 0x89, 0xf9, 0x83, 0xe1, 0x3f, 0x74,
+  0x7c, 0x41, 0xb8, 0x40, 0x00, 0x00, 0x00, 0x49, 0x29, 0xc8, 0x49, 0x39,
+  0xe8, 0x4c, 0x0f, 0x47, 0xc5, 0x48, 0x89, 0x4c, 0x24, 0x40, 0x4c, 0x89,
+  0x44, 0x24, 0x48, 0x66, 0x0f, 0xef, 0xc0, 0xf3, 0x0f, 0x7f, 0x04, 0x24,
+  0xf3, 0x0f, 0x7f, 0x44, 0x24, 0x10, 0xf3, 0x0f, 0x7f, 0x44, 0x24, 0x20,
+  0xf3, 0x0f, 0x7f, 0x44, 0x24, 0x30, 0x48, 0x8d, 0x3c, 0x0c, 0x48, 0x89,
+  0xde, 0x4c, 0x89, 0xc1, 0xf3, 0xa4, 0x48, 0x89, 0xdf, 0x48, 0x2b, 0x7c,
+  0x24, 0x40, 0xe8, 0x81, 0xff, 0xff, 0xff, 0x48, 0x89, 0xe7, 0xbe, 0x40,
+  0x00, 0x00, 0x00, 0x48, 0x8d, 0x0d, 0x4a, 0x0c, 0x00, 0x00, 0x41, 0xff,
+  0xd7, 0x48, 0x89, 0xdf, 0x48, 0x89, 0xe6, 0x48, 0x03, 0x74, 0x24, 0x40,
+  0x48, 0x8b, 0x4c, 0x24, 0x48, 0xf3, 0xa4, 0x48, 0x03, 0x5c, 0x24, 0x48,
+  0x48, 0x2b, 0x6c, 0x24, 0x48, 0x48, 0x85, 0xed, 0x74, 0x18, 0x48, 0x89,
+  0xdf, 0xe8, 0x46, 0xff, 0xff, 0xff, 0x48, 0x89, 0xdf, 0x48, 0x89, 0xee,
+  0x48, 0x8d, 0x0d, 0x11, 0x0c, 0x00, 0x00, 0x41, 0xff, 0xd7, 0x48, 0x83,
+  0xc4, 0x50, 0x5d, 0x5b, 0xc3, 0x8b, 0x0d, 0x69, 0x0e, 0x00, 0x00, 0x49,
+  0x8b, 0x55, 0x00, 0x48, 0xd3, 0xea, 0x48, 0xd3, 0xe2, 0x49, 0x8b, 0x45,
+  0x00, 0x49, 0x03, 0x45, 0x08, 0x48, 0xff, 0xc8, 0x48, 0x29, 0xd0, 0x48,
+  0xd3, 0xe8, 0x48, 0xff, 0xc0, 0xc3, 0x41, 0x55, 0x4d, 0x89, 0xea, 0x4c,
+  0x8d, 0x05, 0x66, 0xfd, 0xff, 0xff, 0x44, 0x8b, 0x0d, 0x3b, 0x0e, 0x00,
+  0x00, 0x4d, 0x01, 0xc8, 0x4c, 0x8d, 0x2d, 0x2d, 0x0d, 0x00, 0x00, 0x4d,
+  0x39, 0xd5, 0x74, 0x0e, 0xe8, 0xb4, 0xff, 0xff, 0xff, 0x49, 0x01, 0xc0,
+  0x49, 0x83, 0xc5, 0x20, 0xeb, 0xed, 0x4c, 0x89, 0xc0, 0x41, 0x5d, 0xc3,
+  0x48, 0x8d, 0x05, 0x35, 0xfd, 0xff, 0xff, 0x41, 0x8b, 0x4d, 0x14, 0x48,
+  0x01, 0xc1, 0x8b, 0x3c, 0xd9, 0x8b, 0x74, 0xd9, 0x04, 0x89, 0xfa, 0x2b,
+  0x11, 0x48, 0x01, 0xc7, 0xe8, 0x9f, 0xfe, 0xff, 0xff, 0xd3, 0xea, 0x41,
+  0x03, 0x55, 0x10, 0xc3, 0xe8, 0x78, 0xff, 0xff, 0xff, 0x8b, 0x0d, 0xe1,
+  0x0d, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x48, 0xd3, 0xe7, 0x48, 0x01, 0xd7,
+  0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 0xd3, 0xe6, 0x48, 0x01, 0xfe, 0x4d,
+  0x8b, 0x45, 0x00, 0x4c, 0x39, 0xc7, 0x49, 0x0f, 0x42, 0xf8, 0x4d, 0x03,
+  0x45, 0x08, 0x4c, 0x39, 0xc6, 0x49, 0x0f, 0x47, 0xf0, 0x4c, 0x01, 0xe7,
+  0x4c, 0x01, 0xe6, 0xc3, 0x55, 0x41, 0x56, 0xe8, 0xbc, 0xff, 0xff, 0xff,
+  0x48, 0x89, 0xfd, 0x49, 0x89, 0xf6, 0x41, 0x83, 0x7d, 0x1c, 0x00, 0x75,
+  0x0a, 0x48, 0x29, 0xfe, 0xe8, 0x71, 0xfe, 0xff, 0xff, 0xeb, 0x2d, 0xe8,
+  0x78, 0xff, 0xff, 0xff, 0x48, 0x8d, 0x0d, 0x1d, 0x0b, 0x00, 0x00, 0x41,
+  0xff, 0xd7, 0xe8, 0x69, 0xff, 0xff, 0xff, 0x89, 0xf1, 0x48, 0x89, 0xfe,
+  0x48, 0x89, 0xef, 0x4c, 0x89, 0xf2, 0x48, 0x29, 0xea, 0x8b, 0x05, 0x4d,
+  0x0b, 0x00, 0x00, 0xe8, 0x8b, 0x05, 0x00, 0x00, 0x41, 0x5e, 0x5d, 0xc3,
+  0xe8, 0x6f, 0xff, 0xff, 0xff, 0xba, 0x03, 0x00, 0x00, 0x00, 0xe8, 0xa1,
+  0x07, 0x00, 0x00, 0xe8, 0x9c, 0xff, 0xff, 0xff, 0xe8, 0x5b, 0xff, 0xff,
+  0xff, 0x41, 0x8b, 0x55, 0x18, 0xe9, 0x8e, 0x07, 0x00, 0x00, 0x53, 0x55,
+  0x41, 0x56, 0xe8, 0xeb, 0xfe, 0xff, 0xff, 0x48, 0x89, 0xc5, 0xe8, 0xbe,
+  0xfe, 0xff, 0xff, 0x49, 0x89, 0xc6, 0x49, 0x83, 0xfe, 0x02, 0x76, 0x43,
+  0x8b, 0x0d, 0x1e, 0x0d, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48,
+  0xd3, 0xe7, 0x48, 0x01, 0xd7, 0x4c, 0x01, 0xe7, 0x49, 0x8d, 0x76, 0xff,
+  0x48, 0xd3, 0xe6, 0x48, 0x01, 0xd6, 0x4c, 0x01, 0xe6, 0x31, 0xd2, 0xe8,
+  0x4c, 0x07, 0x00, 0x00, 0x31, 0xdb, 0xe8, 0x95, 0xff, 0xff, 0xff, 0xc6,
+  0x45, 0x00, 0x02, 0x49, 0x8d, 0x5e, 0xff, 0xe8, 0x88, 0xff, 0xff, 0xff,
+  0xc6, 0x44, 0x1d, 0x00, 0x02, 0xeb, 0x16, 0x31, 0xdb, 0x4c, 0x39, 0xf3,
+  0x73, 0x0f, 0xe8, 0x75, 0xff, 0xff, 0xff, 0xc6, 0x44, 0x1d, 0x00, 0x02,
+  0x48, 0xff, 0xc3, 0xeb, 0xec, 0x41, 0x5e, 0x5d, 0x5b, 0xc3, 0x53, 0x55,
+  0x41, 0x55, 0x41, 0x56, 0x48, 0x8d, 0x2d, 0xe1, 0xfb, 0xff, 0xff, 0x8b,
+  0x05, 0xbb, 0x0c, 0x00, 0x00, 0x48, 0x01, 0xc5, 0x44, 0x8b, 0x35, 0xb5,
+  0x0c, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x74, 0x38, 0x8b, 0x45, 0x00, 0x89,
+  0xc3, 0x81, 0xe3, 0xff, 0xff, 0xff, 0x00, 0xc1, 0xe8, 0x18, 0x6b, 0xc0,
+  0x20, 0x4c, 0x8d, 0x2d, 0x8c, 0x0b, 0x00, 0x00, 0x49, 0x01, 0xc5, 0xe8,
+  0x3a, 0xfe, 0xff, 0xff, 0x80, 0x3c, 0x18, 0x00, 0x75, 0x09, 0xc6, 0x04,
+  0x18, 0x02, 0xe8, 0x15, 0xff, 0xff, 0xff, 0x48, 0x83, 0xc5, 0x04, 0x41,
+  0xff, 0xce, 0xeb, 0xc3, 0x41, 0x5e, 0x41, 0x5d, 0x5d, 0x5b, 0xc3, 0x83,
+  0x3d, 0x76, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x84, 0xe7, 0x00, 0x00, 0x00,
+  0x53, 0x55, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0x4c, 0x8d, 0x2d, 0x49,
+  0x0b, 0x00, 0x00, 0x44, 0x8b, 0x35, 0x1a, 0x0a, 0x00, 0x00, 0x45, 0x85,
+  0xf6, 0x0f, 0x84, 0xc0, 0x00, 0x00, 0x00, 0x49, 0x8b, 0x5d, 0x00, 0x4c,
+  0x01, 0xe3, 0x4d, 0x8b, 0x7d, 0x08, 0x49, 0x01, 0xdf, 0x48, 0x81, 0xc3,
+  0xff, 0xff, 0x1f, 0x00, 0x48, 0x81, 0xe3, 0x00, 0x00, 0xe0, 0xff, 0x49,
+  0x81, 0xe7, 0x00, 0x00, 0xe0, 0xff, 0x4c, 0x39, 0xfb, 0x0f, 0x83, 0x88,
+  0x00, 0x00, 0x00, 0x49, 0x29, 0xdf, 0x31, 0xff, 0x49, 0x8d, 0xb7, 0x00,
+  0x00, 0x20, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x41, 0xba, 0x22, 0x00,
+  0x00, 0x00, 0x49, 0xc7, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x45, 0x31, 0xc9,
+  0xb8, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x48, 0x3d, 0x01, 0xf0, 0xff,
+  0xff, 0x73, 0x58, 0x48, 0x89, 0xc5, 0x4c, 0x8d, 0x88, 0xff, 0xff, 0x1f,
+  0x00, 0x49, 0x81, 0xe1, 0x00, 0x00, 0xe0, 0xff, 0x4c, 0x89, 0xcf, 0x4c,
+  0x89, 0xfe, 0xba, 0x0e, 0x00, 0x00, 0x00, 0xb8, 0x1c, 0x00, 0x00, 0x00,
+  0x0f, 0x05, 0x4c, 0x89, 0xcf, 0x48, 0x89, 0xde, 0x4c, 0x89, 0xf9, 0xf3,
+  0xa4, 0x4c, 0x89, 0xcf, 0x4c, 0x89, 0xfe, 0x4c, 0x89, 0xfa, 0x41, 0xba,
+  0x03, 0x00, 0x00, 0x00, 0x49, 0x89, 0xd8, 0xb8, 0x19, 0x00, 0x00, 0x00,
+  0x0f, 0x05, 0x48, 0x89, 0xef, 0x49, 0x8d, 0xb7, 0x00, 0x00, 0x20, 0x00,
+  0xb8, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x49, 0x83, 0xc5, 0x20, 0x41,
+  0xff, 0xce, 0xe9, 0x37, 0xff, 0xff, 0xff, 0x41, 0x5f, 0x41, 0x5e, 0x41,
+  0x5d, 0x5d, 0x5b, 0xc3, 0x48, 0x81, 0xec, 0x80, 0x00, 0x00, 0x00, 0x31,
+  0xff, 0xbe, 0x80, 0x00, 0x00, 0x00, 0x48, 0x89, 0xe2, 0xb8, 0xcc, 0x00,
+  0x00, 0x00, 0x0f, 0x05, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x48, 0x85, 0xc0,
+  0x7e, 0x27, 0x31, 0xc9, 0x48, 0x89, 0xe6, 0x48, 0x8d, 0x3c, 0x04, 0x48,
+  0x39, 0xfe, 0x73, 0x19, 0x4c, 0x8b, 0x06, 0x4d, 0x85, 0xc0, 0x74, 0x0b,
+  0x4d, 0x8d, 0x48, 0xff, 0x4d, 0x21, 0xc8, 0xff, 0xc1, 0xeb, 0xf0, 0x48,
+  0x83, 0xc6, 0x08, 0xeb, 0xe2, 0x89, 0xc8, 0x48, 0x81, 0xc4, 0x80, 0x00,
+  0x00, 0x00, 0xc3, 0x53, 0x55, 0x41, 0x55, 0x41, 0x56, 0x48, 0x83, 0xec,
+  0x08, 0x4c, 0x8d, 0x2d, 0x0c, 0x0a, 0x00, 0x00, 0x44, 0x8b, 0x35, 0xdd,
+  0x08, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x74, 0x40, 0xe8, 0xb1, 0xfc, 0xff,
+  0xff, 0x48, 0x89, 0xc5, 0xe8, 0x84, 0xfc, 0xff, 0xff, 0x48, 0x89, 0x04,
+  0x24, 0x31, 0xdb, 0x48, 0x3b, 0x1c, 0x24, 0x73, 0x1e, 0x31, 0xc0, 0xb9,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xb0, 0x4c, 0x1d, 0x00, 0x75, 0x0a,
+  0xe8, 0x23, 0xfd, 0xff, 0xff, 0xc6, 0x44, 0x1d, 0x00, 0x02, 0x48, 0xff,
+  0xc3, 0xeb, 0xdc, 0x49, 0x83, 0xc5, 0x20, 0x41, 0xff, 0xce, 0xeb, 0xbb,
+  0x48, 0x83, 0xc4, 0x08, 0x41, 0x5e, 0x41, 0x5d, 0x5d, 0x5b, 0xc3, 0x31,
+  0xff, 0xbe, 0x00, 0x00, 0x01, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x41,
+  0xba, 0x22, 0x00, 0x00, 0x00, 0x49, 0xc7, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x45, 0x31, 0xc9, 0xb8, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x48, 0x85,
+  0xc0, 0x0f, 0x88, 0xfe, 0x04, 0x00, 0x00, 0x48, 0x8d, 0x0d, 0x1a, 0x05,
+  0x00, 0x00, 0x48, 0x89, 0x04, 0xd9, 0x48, 0x8d, 0xb0, 0x00, 0x00, 0x01,
+  0x00, 0xbf, 0x00, 0x0f, 0x35, 0x00, 0x48, 0x8d, 0x15, 0x03, 0x07, 0x00,
+  0x00, 0x48, 0x8d, 0x14, 0x9a, 0x49, 0x89, 0xd2, 0x45, 0x31, 0xc0, 0xb8,
+  0x38, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x48, 0x85, 0xc0, 0x0f, 0x88, 0xc6,
+  0x04, 0x00, 0x00, 0x74, 0x01, 0xc3, 0xe8, 0x2c, 0xff, 0xff, 0xff, 0xb8,
+  0x3c, 0x00, 0x00, 0x00, 0x31, 0xff, 0x0f, 0x05, 0x53, 0x55, 0x41, 0x55,
+  0x41, 0x56, 0x4c, 0x8d, 0x2d, 0x33, 0x09, 0x00, 0x00, 0x44, 0x8b, 0x35,
+  0x04, 0x08, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x74, 0x13, 0xba, 0x03, 0x00,
+  0x00, 0x00, 0xe8, 0x5f, 0x04, 0x00, 0x00, 0x49, 0x83, 0xc5, 0x20, 0x41,
+  0xff, 0xce, 0xeb, 0xe8, 0xe8, 0x9f, 0xfe, 0xff, 0xff, 0x3b, 0x05, 0x1d,
+  0x0a, 0x00, 0x00, 0x0f, 0x47, 0x05, 0x16, 0x0a, 0x00, 0x00, 0xb9, 0x40,
+  0x00, 0x00, 0x00, 0x39, 0xc8, 0x0f, 0x47, 0xc1, 0x85, 0xc0, 0x75, 0x02,
+  0xff, 0xc0, 0x8d, 0x68, 0xff, 0x31, 0xdb, 0x39, 0xeb, 0x73, 0x09, 0xe8,
+  0x2f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xeb, 0xf3, 0xe8, 0xbe, 0xfe, 0xff,
+  0xff, 0x31, 0xdb, 0x39, 0xeb, 0x73, 0x3d, 0x48, 0x8d, 0x3d, 0x66, 0x06,
+  0x00, 0x00, 0x48, 0x8d, 0x3c, 0x9f, 0x8b, 0x17, 0x85, 0xd2, 0x74, 0x11,
+  0xbe, 0x00, 0x00, 0x00, 0x00, 0x45, 0x31, 0xd2, 0xb8, 0xca, 0x00, 0x00,
+  0x00, 0x0f, 0x05, 0xeb, 0xe9, 0x48, 0x8d, 0x05, 0x44, 0x04, 0x00, 0x00,
+  0x48, 0x8b, 0x3c, 0xd8, 0xbe, 0x00, 0x00, 0x01, 0x00, 0xb8, 0x0b, 0x00,
+  0x00, 0x00, 0x0f, 0x05, 0xff, 0xc3, 0xeb, 0xbf, 0x4c, 0x8d, 0x2d, 0x91,
+  0x08, 0x00, 0x00, 0x44, 0x8b, 0x35, 0x62, 0x07, 0x00, 0x00, 0x45, 0x85,
+  0xf6, 0x74, 0x12, 0x41, 0x8b, 0x55, 0x18, 0xe8, 0xbe, 0x03, 0x00, 0x00,
+  0x49, 0x83, 0xc5, 0x20, 0x41, 0xff, 0xce, 0xeb, 0xe9, 0x41, 0x5e, 0x41,
+  0x5d, 0x5d, 0x5b, 0xc3, 0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56,
+  0x41, 0x57, 0x48, 0x83, 0xec, 0x10, 0x48, 0x8b, 0x82, 0xc0, 0x00, 0x00,
+  0x00, 0x48, 0x89, 0x04, 0x24, 0x4c, 0x8b, 0x25, 0xd4, 0x03, 0x00, 0x00,
+  0x4c, 0x8b, 0x3d, 0xd5, 0x03, 0x00, 0x00, 0x4c, 0x8b, 0x76, 0x10, 0x4d,
+  0x29, 0xe6, 0x4c, 0x8d, 0x2d, 0x37, 0x08, 0x00, 0x00, 0x8b, 0x2d, 0x09,
+  0x07, 0x00, 0x00, 0x85, 0xed, 0x74, 0x7c, 0x49, 0x8b, 0x45, 0x00, 0x48,
+  0x25, 0x00, 0xf0, 0xff, 0xff, 0x49, 0x39, 0xc6, 0x72, 0x19, 0x49, 0x8b,
+  0x45, 0x00, 0x49, 0x03, 0x45, 0x08, 0x48, 0x05, 0xff, 0x0f, 0x00, 0x00,
+  0x48, 0x25, 0x00, 0xf0, 0xff, 0xff, 0x49, 0x39, 0xc6, 0x72, 0x08, 0x49,
+  0x83, 0xc5, 0x20, 0xff, 0xcd, 0xeb, 0xcc, 0xe8, 0x89, 0xfa, 0xff, 0xff,
+  0x4c, 0x89, 0xf3, 0x48, 0x29, 0xd3, 0x8b, 0x0d, 0xec, 0x08, 0x00, 0x00,
+  0x48, 0xd3, 0xeb, 0xe8, 0x9a, 0xfa, 0xff, 0xff, 0x48, 0x8d, 0x2c, 0x18,
+  0x31, 0xc0, 0xb9, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xb0, 0x4d, 0x00,
+  0x75, 0x0b, 0xe8, 0x6d, 0xfb, 0xff, 0xff, 0xc6, 0x45, 0x00, 0x02, 0xeb,
+  0x1d, 0x3c, 0x01, 0x74, 0x08, 0xf6, 0x04, 0x24, 0x02, 0x75, 0x0c, 0xeb,
+  0x11, 0xf3, 0x90, 0x80, 0x7d, 0x00, 0x02, 0x75, 0xf8, 0xeb, 0x07, 0x31,
+  0xff, 0xe8, 0x0f, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x10, 0x41, 0x5f,
+  0x41, 0x5e, 0x41, 0x5d, 0x41, 0x5c, 0x5d, 0x5b, 0xc3, 0x48, 0x83, 0xec,
+  0x20, 0x48, 0x89, 0x3c, 0x24, 0x48, 0xc7, 0x44, 0x24, 0x08, 0x04, 0x00,
+  0x00, 0x04, 0x48, 0x8d, 0x05, 0x33, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44,
+  0x24, 0x10, 0x48, 0xc7, 0x44, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0x0b, 0x00, 0x00, 0x00, 0x48, 0x89, 0xe6, 0x31, 0xd2, 0x41, 0xba, 0x08,
+  0x00, 0x00, 0x00, 0xb8, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x48, 0x83,
+  0xc4, 0x20, 0x48, 0x85, 0xc0, 0x0f, 0x88, 0xc6, 0x02, 0x00, 0x00, 0xc3,
+  0xb8, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x45, 0x31, 0xc0, 0xb8, 0x01,
+  0x00, 0x00, 0x00, 0x0f, 0xa2, 0x0f, 0xba, 0xe1, 0x19, 0x73, 0x04, 0x41,
+  0x83, 0xc8, 0x01, 0x0f, 0xba, 0xe1, 0x1b, 0x73, 0x52, 0x0f, 0xba, 0xe1,
+  0x1c, 0x73, 0x4c, 0x31, 0xc9, 0x0f, 0x01, 0xd0, 0x41, 0x89, 0xc1, 0x83,
+  0xe0, 0x06, 0x83, 0xf8, 0x06, 0x75, 0x3c, 0xb8, 0x07, 0x00, 0x00, 0x00,
+  0x31, 0xc9, 0x0f, 0xa2, 0x0f, 0xba, 0xe3, 0x05, 0x73, 0x2d, 0x41, 0x83,
+  0xc8, 0x02, 0x0f, 0xba, 0xe1, 0x09, 0x73, 0x04, 0x41, 0x83, 0xc8, 0x08,
+  0x44, 0x89, 0xc8, 0x25, 0xe6, 0x00, 0x00, 0x00, 0x3d, 0xe6, 0x00, 0x00,
+  0x00, 0x75, 0x10, 0x0f, 0xba, 0xe3, 0x10, 0x73, 0x0a, 0x0f, 0xba, 0xe3,
+  0x1e, 0x73, 0x04, 0x41, 0x83, 0xc8, 0x04, 0x44, 0x89, 0xc0, 0xc3, 0x53,
+  0x55, 0xfc, 0x48, 0x89, 0xfb, 0x31, 0xed, 0x83, 0xf8, 0x01, 0x48, 0x0f,
+  0x44, 0xef, 0x4c, 0x8d, 0x04, 0x0e, 0x4c, 0x8d, 0x0c, 0x17, 0x48, 0x85,
+  0xed, 0x74, 0x27, 0x48, 0x89, 0xf8, 0x48, 0x29, 0xe8, 0x48, 0x3d, 0x04,
+  0x10, 0x01, 0x00, 0x72, 0x19, 0x56, 0x57, 0x48, 0x8d, 0x97, 0xfc, 0xff,
+  0xfe, 0xff, 0x48, 0x89, 0xee, 0x48, 0x89, 0xdf, 0xe8, 0x1c, 0x01, 0x00,
+  0x00, 0x48, 0x89, 0xf5, 0x5f, 0x5e, 0x0f, 0xb6, 0x06, 0x48, 0xff, 0xc6,
+  0x89, 0xc1, 0xc1, 0xe9, 0x04, 0x83, 0xf9, 0x0f, 0x75, 0x11, 0x0f, 0xb6,
+  0x16, 0x48, 0xff, 0xc6, 0x48, 0x01, 0xd1, 0x81, 0xfa, 0xff, 0x00, 0x00,
+  0x00, 0x74, 0xef, 0x4c, 0x8d, 0x1c, 0x0f, 0x48, 0x8d, 0x14, 0x0e, 0x4d,
+  0x8d, 0x53, 0x10, 0x4d, 0x39, 0xca, 0x77, 0x26, 0x4c, 0x8d, 0x52, 0x10,
+  0x4d, 0x39, 0xc2, 0x77, 0x1d, 0xf3, 0x0f, 0x6f, 0x06, 0xf3, 0x0f, 0x7f,
+  0x07, 0x48, 0x83, 0xc6, 0x10, 0x48, 0x83, 0xc7, 0x10, 0x4c, 0x39, 0xdf,
+  0x72, 0xeb, 0x48, 0x89, 0xd6, 0x4c, 0x89, 0xdf, 0xeb, 0x02, 0xf3, 0xa4,
+  0x4c, 0x39, 0xc6, 0x0f, 0x83, 0x9d, 0x00, 0x00, 0x00, 0x0f, 0xb7, 0x16,
+  0x48, 0x83, 0xc6, 0x02, 0x83, 0xe0, 0x0f, 0x83, 0xf8, 0x0f, 0x75, 0x11,
+  0x0f, 0xb6, 0x0e, 0x48, 0xff, 0xc6, 0x48, 0x01, 0xc8, 0x81, 0xf9, 0xff,
+  0x00, 0x00, 0x00, 0x74, 0xef, 0x48, 0x8d, 0x48, 0x04, 0x49, 0x89, 0xfa,
+  0x49, 0x29, 0xd2, 0x4c, 0x8d, 0x1c, 0x0f, 0x49, 0x8d, 0x43, 0x10, 0x4c,
+  0x39, 0xc8, 0x77, 0x45, 0x48, 0x83, 0xfa, 0x10, 0x72, 0x1e, 0xf3, 0x41,
+  0x0f, 0x6f, 0x02, 0xf3, 0x0f, 0x7f, 0x07, 0x49, 0x83, 0xc2, 0x10, 0x48,
+  0x83, 0xc7, 0x10, 0x4c, 0x39, 0xdf, 0x72, 0xea, 0x4c, 0x89, 0xdf, 0xe9,
+  0x16, 0xff, 0xff, 0xff, 0x48, 0x83, 0xfa, 0x08, 0x72, 0x1b, 0x49, 0x8b,
+  0x02, 0x48, 0x89, 0x07, 0x49, 0x83, 0xc2, 0x08, 0x48, 0x83, 0xc7, 0x08,
+  0x4c, 0x39, 0xdf, 0x72, 0xed, 0x4c, 0x89, 0xdf, 0xe9, 0xf5, 0xfe, 0xff,
+  0xff, 0x48, 0x83, 0xfa, 0x01, 0x75, 0x0b, 0x41, 0x0f, 0xb6, 0x02, 0xf3,
+  0xaa, 0xe9, 0xe4, 0xfe, 0xff, 0xff, 0x49, 0x89, 0xf3, 0x4c, 0x89, 0xd6,
+  0xf3, 0xa4, 0x4c, 0x89, 0xde, 0xe9, 0xd4, 0xfe, 0xff, 0xff, 0x48, 0x85,
+  0xed, 0x74, 0x0f, 0x48, 0x89, 0xee, 0x49, 0x8d, 0x51, 0xfc, 0x48, 0x89,
+  0xdf, 0xe8, 0x03, 0x00, 0x00, 0x00, 0x5d, 0x5b, 0xc3, 0xb8, 0xe8, 0xe8,
+  0xe8, 0xe8, 0x66, 0x0f, 0x6e, 0xc8, 0x66, 0x0f, 0x70, 0xc9, 0x00, 0xb8,
+  0xe9, 0xe9, 0xe9, 0xe9, 0x66, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0x70, 0xd2,
+  0x00, 0x48, 0x39, 0xd6, 0x0f, 0x83, 0x9b, 0x00, 0x00, 0x00, 0x48, 0x8d,
+  0x46, 0x10, 0x48, 0x39, 0xd0, 0x77, 0x4b, 0xf3, 0x0f, 0x6f, 0x06, 0x66,
+  0x0f, 0x6f, 0xd8, 0x66, 0x0f, 0x74, 0xc1, 0x66, 0x0f, 0x74, 0xda, 0x66,
+  0x0f, 0xeb, 0xc3, 0x66, 0x44, 0x0f, 0xd7, 0xd0, 0x45, 0x85, 0xd2, 0x74,
+  0x21, 0x41, 0x0f, 0xbc, 0xca, 0x4c, 0x8d, 0x1c, 0x0e, 0xe8, 0x37, 0x00,
+  0x00, 0x00, 0x49, 0x8d, 0x4b, 0x05, 0x48, 0x29, 0xf1, 0x83, 0xf9, 0x10,
+  0x73, 0x0e, 0x41, 0xd3, 0xea, 0x41, 0xd3, 0xe2, 0x75, 0xdf, 0x48, 0x83,
+  0xc6, 0x10, 0xeb, 0xa9, 0x49, 0x8d, 0x73, 0x05, 0xeb, 0xa3, 0x8a, 0x06,
+  0x24, 0xfe, 0x3c, 0xe8, 0x74, 0x05, 0x48, 0xff, 0xc6, 0xeb, 0x96, 0x49,
+  0x89, 0xf3, 0xe8, 0x02, 0x00, 0x00, 0x00, 0xeb, 0xe3, 0x41, 0x8b, 0x43,
+  0x01, 0x8d, 0x88, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xc1, 0x00, 0x00, 0x00,
+  0xfe, 0x75, 0x1e, 0x4c, 0x89, 0xd9, 0x48, 0x29, 0xf9, 0x83, 0xc1, 0x05,
+  0x29, 0xc8, 0x05, 0x00, 0x00, 0x00, 0x01, 0x25, 0xff, 0xff, 0xff, 0x01,
+  0x2d, 0x00, 0x00, 0x00, 0x01, 0x41, 0x89, 0x43, 0x01, 0xc3, 0x49, 0x8b,
+  0x7d, 0x00, 0x4c, 0x01, 0xe7, 0x49, 0x8b, 0x75, 0x08, 0x48, 0x01, 0xfe,
+  0x48, 0x81, 0xe7, 0x00, 0xf0, 0xff, 0xff, 0x48, 0x81, 0xc6, 0xff, 0x0f,
+  0x00, 0x00, 0x48, 0x81, 0xe6, 0x00, 0xf0, 0xff, 0xff, 0x48, 0x29, 0xfe,
+  0xb8, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x48, 0x85, 0xc0, 0x78, 0x01,
+  0xc3, 0xbf, 0x7f, 0x00, 0x00, 0x00, 0xb8, 0xe7, 0x00, 0x00, 0x00, 0x0f,
+  0x05, 0x69, 0x6e, 0x73, 0x6b, 0x69, 0x6d, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+unsigned int stub_bin_len = 4344;
+unsigned char stub_telemetry_bin[] = {
+  0x57, 0x56, 0x52, 0x51, 0x50, 0x41, 0x50, 0x41, 0x51, 0x41, 0x52, 0x41,
+  0x53, 0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0x0f,
+  0x31, 0x48, 0xc1, 0xe2, 0x20, 0x48, 0x09, 0xd0, 0x48, 0x89, 0x05, 0x81,
+  0x0f, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00,
+  0x00, 0x48, 0x8d, 0x35, 0x28, 0x0c, 0x00, 0x00, 0xba, 0x07, 0x00, 0x00,
+  0x00, 0x0f, 0x05, 0xe8, 0xb9, 0x08, 0x00, 0x00, 0x89, 0x05, 0x56, 0x0f,
+  0x00, 0x00, 0x48, 0x8d, 0x1d, 0xc7, 0x10, 0x00, 0x00, 0x8b, 0x0d, 0xb9,
+  0x10, 0x00, 0x00, 0x85, 0xc9, 0x0f, 0x84, 0xf5, 0x0b, 0x00, 0x00, 0x8b,
+  0x53, 0x04, 0x21, 0xc2, 0x3b, 0x53, 0x04, 0x74, 0x08, 0x48, 0x83, 0xc3,
+  0x08, 0xff, 0xc9, 0xeb, 0xe6, 0x44, 0x8b, 0x3b, 0x48, 0x8d, 0x1d, 0x85,
+  0xff, 0xff, 0xff, 0x49, 0x01, 0xdf, 0x8b, 0x15, 0x8c, 0x10, 0x00, 0x00,
+  0x29, 0xca, 0x89, 0x15, 0x18, 0x0f, 0x00, 0x00, 0x0f, 0x31, 0x48, 0xc1,
+  0xe2, 0x20, 0x48, 0x09, 0xd0, 0x48, 0x89, 0x05, 0x14, 0x0f, 0x00, 0x00,
+  0x4c, 0x8d, 0x25, 0x5d, 0xff, 0xff, 0xff, 0x4c, 0x2b, 0x25, 0x2e, 0x0f,
+  0x00, 0x00, 0xe8, 0x32, 0x04, 0x00, 0x00, 0x83, 0x3d, 0x92, 0x11, 0x00,
+  0x00, 0x00, 0x75, 0x13, 0x83, 0x3d, 0x79, 0x11, 0x00, 0x00, 0x00, 0x74,
+  0x24, 0xe8, 0x40, 0x06, 0x00, 0x00, 0xe9, 0xba, 0x00, 0x00, 0x00, 0x4c,
+  0x89, 0x25, 0x96, 0x0b, 0x00, 0x00, 0x4c, 0x89, 0x3d, 0x97, 0x0b, 0x00,
+  0x00, 0x48, 0x8d, 0x3d, 0xfa, 0x06, 0x00, 0x00, 0xe8, 0xc6, 0x07, 0x00,
+  0x00, 0x4c, 0x8d, 0x2d, 0x4c, 0x10, 0x00, 0x00, 0x44, 0x8b, 0x35, 0x1d,
+  0x0f, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x0f, 0x84, 0x89, 0x00, 0x00, 0x00,
+  0x83, 0x3d, 0x45, 0x11, 0x00, 0x00, 0x00, 0x74, 0x07, 0xe8, 0xfe, 0x02,
+  0x00, 0x00, 0xeb, 0x6d, 0xba, 0x03, 0x00, 0x00, 0x00, 0xe8, 0x72, 0x0a,
+  0x00, 0x00, 0x41, 0x83, 0x7d, 0x1c, 0x00, 0x75, 0x12, 0x49, 0x8b, 0x7d,
+  0x00, 0x4c, 0x01, 0xe7, 0x49, 0x8b, 0x75, 0x08, 0xe8, 0xf7, 0x00, 0x00,
+  0x00, 0xeb, 0x41, 0x48, 0x8d, 0x1d, 0xca, 0xfe, 0xff, 0xff, 0x41, 0x8b,
+  0x7d, 0x14, 0x48, 0x01, 0xdf, 0x41, 0x8b, 0x75, 0x1c, 0x41, 0x8b, 0x55,
+  0x10, 0x48, 0x8d, 0x0d, 0x84, 0x0e, 0x00, 0x00, 0x41, 0xff, 0xd7, 0x41,
+  0x8b, 0x75, 0x14, 0x48, 0x01, 0xde, 0x41, 0x8b, 0x4d, 0x1c, 0x49, 0x8b,
+  0x7d, 0x00, 0x4c, 0x01, 0xe7, 0x49, 0x8b, 0x55, 0x08, 0x8b, 0x05, 0xb1,
+  0x0e, 0x00, 0x00, 0xe8, 0xfd, 0x07, 0x00, 0x00, 0x41, 0x8b, 0x55, 0x18,
+  0xe8, 0x0f, 0x0a, 0x00, 0x00, 0x49, 0x83, 0xc5, 0x20, 0x41, 0xff, 0xce,
+  0xe9, 0x6e, 0xff, 0xff, 0xff, 0x0f, 0x31, 0x48, 0xc1, 0xe2, 0x20, 0x48,
+  0x09, 0xd0, 0x48, 0x89, 0x05, 0x23, 0x0e, 0x00, 0x00, 0xe8, 0xe6, 0x02,
+  0x00, 0x00, 0x0f, 0x31, 0x48, 0xc1, 0xe2, 0x20, 0x48, 0x09, 0xd0, 0x48,
+  0x89, 0x05, 0x16, 0x0e, 0x00, 0x00, 0x0f, 0x31, 0x48, 0xc1, 0xe2, 0x20,
+  0x48, 0x09, 0xd0, 0x48, 0x89, 0x05, 0x0e, 0x0e, 0x00, 0x00, 0x48, 0x8d,
+  0x7c, 0x24, 0x78, 0xe8, 0xfb, 0x09, 0x00, 0x00, 0x41, 0x5f, 0x41, 0x5e,
+  0x41, 0x5d, 0x41, 0x5c, 0x5d, 0x5b, 0x41, 0x5b, 0x41, 0x5a, 0x41, 0x59,
+  0x41, 0x58, 0x58, 0x59, 0x5a, 0x5e, 0x5f, 0x48, 0x8d, 0x05, 0x1e, 0xfe,
+  0xff, 0xff, 0x48, 0x2b, 0x05, 0xef, 0x0d, 0x00, 0x00, 0x48, 0x03, 0x05,
+  0xe0, 0x0d, 0x00, 0x00, 0xff, 0xe0, 0xb9, 0x06, 0x00, 0x00, 0x00, 0x83,
+  0x3d, 0x16, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x05, 0xb9, 0x04, 0x00, 0x00,
+  0x00, 0xc3, 0x49, 0x8b, 0x55, 0x00, 0x4c, 0x01, 0xe2, 0x48, 0x83, 0xe2,
+  0xc0, 0x48, 0xf7, 0xda, 0x48, 0x01, 0xfa, 0xe8, 0xd6, 0xff, 0xff, 0xff,
+  0x48, 0xd3, 0xea, 0x41, 0x03, 0x55, 0x10, 0xc3, 0x53, 0x55, 0x48, 0x83,
+  0xec, 0x50, 0x48, 0x89, 0xfb, 0x48, 0x89, 0xf5, 0x89, 0xf9, 0x83, 0xe1,
+  0x3f, 0x74, 0x7c, 0x41, 0xb8, 0x40, 0x00, 0x00, 0x00, 0x49, 0x29, 0xc8,
+  0x49, 0x39, 0xe8, 0x4c, 0x0f, 0x47, 0xc5, 0x48, 0x89, 0x4c, 0x24, 0x40,
+  0x4c, 0x89, 0x44, 0x24, 0x48, 0x66, 0x0f, 0xef, 0xc0, 0xf3, 0x0f, 0x7f,
+  0x04, 0x24, 0xf3, 0x0f, 0x7f, 0x44, 0x24, 0x10, 0xf3, 0x0f, 0x7f, 0x44,
+  0x24, 0x20, 0xf3, 0x0f, 0x7f, 0x44, 0x24, 0x30, 0x48, 0x8d, 0x3c, 0x0c,
+  0x48, 0x89, 0xde, 0x4c, 0x89, 0xc1, 0xf3, 0xa4, 0x48, 0x89, 0xdf, 0x48,
+  0x2b, 0x7c, 0x24, 0x40, 0xe8, 0x81, 0xff, 0xff, 0xff, 0x48, 0x89, 0xe7,
+  0xbe, 0x40, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0d, 0x3c, 0x0d, 0x00, 0x00,
+  0x41, 0xff, 0xd7, 0x48, 0x89, 0xdf, 0x48, 0x89, 0xe6, 0x48, 0x03, 0x74,
+  0x24, 0x40, 0x48, 0x8b, 0x4c, 0x24, 0x48, 0xf3, 0xa4, 0x48, 0x03, 0x5c,
+  0x24, 0x48, 0x48, 0x2b, 0x6c, 0x24, 0x48, 0x48, 0x85, 0xed, 0x74, 0x18,
+  0x48, 0x89, 0xdf, 0xe8, 0x46, 0xff, 0xff, 0xff, 0x48, 0x89, 0xdf, 0x48,
+  0x89, 0xee, 0x48, 0x8d, 0x0d, 0x03, 0x0d, 0x00, 0x00, 0x41, 0xff, 0xd7,
+  0x48, 0x83, 0xc4, 0x50, 0x5d, 0x5b, 0xc3, 0x8b, 0x0d, 0x5b, 0x0f, 0x00,
+  0x00, 0x49, 0x8b, 0x55, 0x00, 0x48, 0xd3, 0xea, 0x48, 0xd3, 0xe2, 0x49,
+  0x8b, 0x45, 0x00, 0x49, 0x03, 0x45, 0x08, 0x48, 0xff, 0xc8, 0x48, 0x29,
+  0xd0, 0x48, 0xd3, 0xe8, 0x48, 0xff, 0xc0, 0xc3, 0x41, 0x55, 0x4d, 0x89,
+  0xea, 0x4c, 0x8d, 0x05, 0xf8, 0xfc, 0xff, 0xff, 0x44, 0x8b, 0x0d, 0x2d,
+  0x0f, 0x00, 0x00, 0x4d, 0x01, 0xc8, 0x4c, 0x8d, 0x2d, 0x1f, 0x0e, 0x00,
+  0x00, 0x4d, 0x39, 0xd5, 0x74, 0x0e, 0xe8, 0xb4, 0xff, 0xff, 0xff, 0x49,
+  0x01, 0xc0, 0x49, 0x83, 0xc5, 0x20, 0xeb, 0xed, 0x4c, 0x89, 0xc0, 0x41,
+  0x5d, 0xc3, 0x48, 0x8d, 0x05, 0xc7, 0xfc, 0xff, 0xff, 0x41, 0x8b, 0x4d,
+  0x14, 0x48, 0x01, 0xc1, 0x8b, 0x3c, 0xd9, 0x8b, 0x74, 0xd9, 0x04, 0x89,
+  0xfa, 0x2b, 0x11, 0x48, 0x01, 0xc7, 0xe8, 0x9f, 0xfe, 0xff, 0xff, 0xd3,
+  0xea, 0x41, 0x03, 0x55, 0x10, 0xc3, 0xe8, 0x78, 0xff, 0xff, 0xff, 0x8b,
+  0x0d, 0xd3, 0x0e, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x48, 0xd3, 0xe7, 0x48,
+  0x01, 0xd7, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 0xd3, 0xe6, 0x48, 0x01,
+  0xfe, 0x4d, 0x8b, 0x45, 0x00, 0x4c, 0x39, 0xc7, 0x49, 0x0f, 0x42, 0xf8,
+  0x4d, 0x03, 0x45, 0x08, 0x4c, 0x39, 0xc6, 0x49, 0x0f, 0x47, 0xf0, 0x4c,
+  0x01, 0xe7, 0x4c, 0x01, 0xe6, 0xc3, 0x55, 0x41, 0x56, 0xe8, 0xbc, 0xff,
+  0xff, 0xff, 0x48, 0x89, 0xfd, 0x49, 0x89, 0xf6, 0x41, 0x83, 0x7d, 0x1c,
+  0x00, 0x75, 0x0a, 0x48, 0x29, 0xfe, 0xe8, 0x71, 0xfe, 0xff, 0xff, 0xeb,
+  0x2d, 0xe8, 0x78, 0xff, 0xff, 0xff, 0x48, 0x8d, 0x0d, 0x0f, 0x0c, 0x00,
+  0x00, 0x41, 0xff, 0xd7, 0xe8, 0x69, 0xff, 0xff, 0xff, 0x89, 0xf1, 0x48,
+  0x89, 0xfe, 0x48, 0x89, 0xef, 0x4c, 0x89, 0xf2, 0x48, 0x29, 0xea, 0x8b,
+  0x05, 0x3f, 0x0c, 0x00, 0x00, 0xe8, 0x8b, 0x05, 0x00, 0x00, 0x41, 0x5e,
+  0x5d, 0xc3, 0xe8, 0x6f, 0xff, 0xff, 0xff, 0xba, 0x03, 0x00, 0x00, 0x00,
+  0xe8, 0xa1, 0x07, 0x00, 0x00, 0xe8, 0x9c, 0xff, 0xff, 0xff, 0xe8, 0x5b,
+  0xff, 0xff, 0xff, 0x41, 0x8b, 0x55, 0x18, 0xe9, 0x8e, 0x07, 0x00, 0x00,
+  0x53, 0x55, 0x41, 0x56, 0xe8, 0xeb, 0xfe, 0xff, 0xff, 0x48, 0x89, 0xc5,
+  0xe8, 0xbe, 0xfe, 0xff, 0xff, 0x49, 0x89, 0xc6, 0x49, 0x83, 0xfe, 0x02,
+  0x76, 0x43, 0x8b, 0x0d, 0x10, 0x0e, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00,
+  0x00, 0x48, 0xd3, 0xe7, 0x48, 0x01, 0xd7, 0x4c, 0x01, 0xe7, 0x49, 0x8d,
+  0x76, 0xff, 0x48, 0xd3, 0xe6, 0x48, 0x01, 0xd6, 0x4c, 0x01, 0xe6, 0x31,
+  0xd2, 0xe8, 0x4c, 0x07, 0x00, 0x00, 0x31, 0xdb, 0xe8, 0x95, 0xff, 0xff,
+  0xff, 0xc6, 0x45, 0x00, 0x02, 0x49, 0x8d, 0x5e, 0xff, 0xe8, 0x88, 0xff,
+  0xff, 0xff, 0xc6, 0x44, 0x1d, 0x00, 0x02, 0xeb, 0x16, 0x31, 0xdb, 0x4c,
+  0x39, 0xf3, 0x73, 0x0f, 0xe8, 0x75, 0xff, 0xff, 0xff, 0xc6, 0x44, 0x1d,
+  0x00, 0x02, 0x48, 0xff, 0xc3, 0xeb, 0xec, 0x41, 0x5e, 0x5d, 0x5b, 0xc3,
+  0x53, 0x55, 0x41, 0x55, 0x41, 0x56, 0x48, 0x8d, 0x2d, 0x73, 0xfb, 0xff,
+  0xff, 0x8b, 0x05, 0xad, 0x0d, 0x00, 0x00, 0x48, 0x01, 0xc5, 0x44, 0x8b,
+  0x35, 0xa7, 0x0d, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x74, 0x38, 0x8b, 0x45,
+  0x00, 0x89, 0xc3, 0x81, 0xe3, 0xff, 0xff, 0xff, 0x00, 0xc1, 0xe8, 0x18,
+  0x6b, 0xc0, 0x20, 0x4c, 0x8d, 0x2d, 0x7e, 0x0c, 0x00, 0x00, 0x49, 0x01,
+  0xc5, 0xe8, 0x3a, 0xfe, 0xff, 0xff, 0x80, 0x3c, 0x18, 0x00, 0x75, 0x09,
+  0xc6, 0x04, 0x18, 0x02, 0xe8, 0x15, 0xff, 0xff, 0xff, 0x48, 0x83, 0xc5,
+  0x04, 0x41, 0xff, 0xce, 0xeb, 0xc3, 0x41, 0x5e, 0x41, 0x5d, 0x5d, 0x5b,
+  0xc3, 0x83, 0x3d, 0x68, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x84, 0xe7, 0x00,
+  0x00, 0x00, 0x53, 0x55, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0x4c, 0x8d,
+  0x2d, 0x3b, 0x0c, 0x00, 0x00, 0x44, 0x8b, 0x35, 0x0c, 0x0b, 0x00, 0x00,
+  0x45, 0x85, 0xf6, 0x0f, 0x84, 0xc0, 0x00, 0x00, 0x00, 0x49, 0x8b, 0x5d,
+  0x00, 0x4c, 0x01, 0xe3, 0x4d, 0x8b, 0x7d, 0x08, 0x49, 0x01, 0xdf, 0x48,
+  0x81, 0xc3, 0xff, 0xff, 0x1f, 0x00, 0x48, 0x81, 0xe3, 0x00, 0x00, 0xe0,
+  0xff, 0x49, 0x81, 0xe7, 0x00, 0x00, 0xe0, 0xff, 0x4c, 0x39, 0xfb, 0x0f,
+  0x83, 0x88, 0x00, 0x00, 0x00, 0x49, 0x29, 0xdf, 0x31, 0xff, 0x49, 0x8d,
+  0xb7, 0x00, 0x00, 0x20, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x41, 0xba,
+  0x22, 0x00, 0x00, 0x00, 0x49, 0xc7, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x45,
+  0x31, 0xc9, 0xb8, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x48, 0x3d, 0x01,
+  0xf0, 0xff, 0xff, 0x73, 0x58, 0x48, 0x89, 0xc5, 0x4c, 0x8d, 0x88, 0xff,
+  0xff, 0x1f, 0x00, 0x49, 0x81, 0xe1, 0x00, 0x00, 0xe0, 0xff, 0x4c, 0x89,
+  0xcf, 0x4c, 0x89, 0xfe, 0xba, 0x0e, 0x00, 0x00, 0x00, 0xb8, 0x1c, 0x00,
+  0x00, 0x00, 0x0f, 0x05, 0x4c, 0x89, 0xcf, 0x48, 0x89, 0xde, 0x4c, 0x89,
+  0xf9, 0xf3, 0xa4, 0x4c, 0x89, 0xcf, 0x4c, 0x89, 0xfe, 0x4c, 0x89, 0xfa,
+  0x41, 0xba, 0x03, 0x00, 0x00, 0x00, 0x49, 0x89, 0xd8, 0xb8, 0x19, 0x00,
+  0x00, 0x00, 0x0f, 0x05, 0x48, 0x89, 0xef, 0x49, 0x8d, 0xb7, 0x00, 0x00,
+  0x20, 0x00, 0xb8, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x49, 0x83, 0xc5,
+  0x20, 0x41, 0xff, 0xce, 0xe9, 0x37, 0xff, 0xff, 0xff, 0x41, 0x5f, 0x41,
+  0x5e, 0x41, 0x5d, 0x5d, 0x5b, 0xc3, 0x48, 0x81, 0xec, 0x80, 0x00, 0x00,
+  0x00, 0x31, 0xff, 0xbe, 0x80, 0x00, 0x00, 0x00, 0x48, 0x89, 0xe2, 0xb8,
+  0xcc, 0x00, 0x00, 0x00, 0x0f, 0x05, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x48,
+  0x85, 0xc0, 0x7e, 0x27, 0x31, 0xc9, 0x48, 0x89, 0xe6, 0x48, 0x8d, 0x3c,
+  0x04, 0x48, 0x39, 0xfe, 0x73, 0x19, 0x4c, 0x8b, 0x06, 0x4d, 0x85, 0xc0,
+  0x74, 0x0b, 0x4d, 0x8d, 0x48, 0xff, 0x4d, 0x21, 0xc8, 0xff, 0xc1, 0xeb,
+  0xf0, 0x48, 0x83, 0xc6, 0x08, 0xeb, 0xe2, 0x89, 0xc8, 0x48, 0x81, 0xc4,
+  0x80, 0x00, 0x00, 0x00, 0xc3, 0x53, 0x55, 0x41, 0x55, 0x41, 0x56, 0x48,
+  0x83, 0xec, 0x08, 0x4c, 0x8d, 0x2d, 0xfe, 0x0a, 0x00, 0x00, 0x44, 0x8b,
+  0x35, 0xcf, 0x09, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x74, 0x40, 0xe8, 0xb1,
+  0xfc, 0xff, 0xff, 0x48, 0x89, 0xc5, 0xe8, 0x84, 0xfc, 0xff, 0xff, 0x48,
+  0x89, 0x04, 0x24, 0x31, 0xdb, 0x48, 0x3b, 0x1c, 0x24, 0x73, 0x1e, 0x31,
+  0xc0, 0xb9, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xb0, 0x4c, 0x1d, 0x00,
+  0x75, 0x0a, 0xe8, 0x23, 0xfd, 0xff, 0xff, 0xc6, 0x44, 0x1d, 0x00, 0x02,
+  0x48, 0xff, 0xc3, 0xeb, 0xdc, 0x49, 0x83, 0xc5, 0x20, 0x41, 0xff, 0xce,
+  0xeb, 0xbb, 0x48, 0x83, 0xc4, 0x08, 0x41, 0x5e, 0x41, 0x5d, 0x5d, 0x5b,
+  0xc3, 0x31, 0xff, 0xbe, 0x00, 0x00, 0x01, 0x00, 0xba, 0x03, 0x00, 0x00,
+  0x00, 0x41, 0xba, 0x22, 0x00, 0x00, 0x00, 0x49, 0xc7, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x45, 0x31, 0xc9, 0xb8, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x05,
+  0x48, 0x85, 0xc0, 0x0f, 0x88, 0x97, 0x05, 0x00, 0x00, 0x48, 0x8d, 0x0d,
+  0xb4, 0x05, 0x00, 0x00, 0x48, 0x89, 0x04, 0xd9, 0x48, 0x8d, 0xb0, 0x00,
+  0x00, 0x01, 0x00, 0xbf, 0x00, 0x0f, 0x35, 0x00, 0x48, 0x8d, 0x15, 0x9d,
+  0x07, 0x00, 0x00, 0x48, 0x8d, 0x14, 0x9a, 0x49, 0x89, 0xd2, 0x45, 0x31,
+  0xc0, 0xb8, 0x38, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x48, 0x85, 0xc0, 0x0f,
+  0x88, 0x5f, 0x05, 0x00, 0x00, 0x74, 0x01, 0xc3, 0xe8, 0x2c, 0xff, 0xff,
+  0xff, 0xb8, 0x3c, 0x00, 0x00, 0x00, 0x31, 0xff, 0x0f, 0x05, 0x53, 0x55,
+  0x41, 0x55, 0x41, 0x56, 0x4c, 0x8d, 0x2d, 0x25, 0x0a, 0x00, 0x00, 0x44,
+  0x8b, 0x35, 0xf6, 0x08, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x74, 0x13, 0xba,
+  0x03, 0x00, 0x00, 0x00, 0xe8, 0x5f, 0x04, 0x00, 0x00, 0x49, 0x83, 0xc5,
+  0x20, 0x41, 0xff, 0xce, 0xeb, 0xe8, 0xe8, 0x9f, 0xfe, 0xff, 0xff, 0x3b,
+  0x05, 0x0f, 0x0b, 0x00, 0x00, 0x0f, 0x47, 0x05, 0x08, 0x0b, 0x00, 0x00,
+  0xb9, 0x40, 0x00, 0x00, 0x00, 0x39, 0xc8, 0x0f, 0x47, 0xc1, 0x85, 0xc0,
+  0x75, 0x02, 0xff, 0xc0, 0x8d, 0x68, 0xff, 0x31, 0xdb, 0x39, 0xeb, 0x73,
+  0x09, 0xe8, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xeb, 0xf3, 0xe8, 0xbe,
+  0xfe, 0xff, 0xff, 0x31, 0xdb, 0x39, 0xeb, 0x73, 0x3d, 0x48, 0x8d, 0x3d,
+  0x00, 0x07, 0x00, 0x00, 0x48, 0x8d, 0x3c, 0x9f, 0x8b, 0x17, 0x85, 0xd2,
+  0x74, 0x11, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x45, 0x31, 0xd2, 0xb8, 0xca,
+  0x00, 0x00, 0x00, 0x0f, 0x05, 0xeb, 0xe9, 0x48, 0x8d, 0x05, 0xde, 0x04,
+  0x00, 0x00, 0x48, 0x8b, 0x3c, 0xd8, 0xbe, 0x00, 0x00, 0x01, 0x00, 0xb8,
+  0x0b, 0x00, 0x00, 0x00, 0x0f, 0x05, 0xff, 0xc3, 0xeb, 0xbf, 0x4c, 0x8d,
+  0x2d, 0x83, 0x09, 0x00, 0x00, 0x44, 0x8b, 0x35, 0x54, 0x08, 0x00, 0x00,
+  0x45, 0x85, 0xf6, 0x74, 0x12, 0x41, 0x8b, 0x55, 0x18, 0xe8, 0xbe, 0x03,
+  0x00, 0x00, 0x49, 0x83, 0xc5, 0x20, 0x41, 0xff, 0xce, 0xeb, 0xe9, 0x41,
+  0x5e, 0x41, 0x5d, 0x5d, 0x5b, 0xc3, 0x53, 0x55, 0x41, 0x54, 0x41, 0x55,
+  0x41, 0x56, 0x41, 0x57, 0x48, 0x83, 0xec, 0x10, 0x48, 0x8b, 0x82, 0xc0,
+  0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x4c, 0x8b, 0x25, 0x6e, 0x04,
+  0x00, 0x00, 0x4c, 0x8b, 0x3d, 0x6f, 0x04, 0x00, 0x00, 0x4c, 0x8b, 0x76,
+  0x10, 0x4d, 0x29, 0xe6, 0x4c, 0x8d, 0x2d, 0x29, 0x09, 0x00, 0x00, 0x8b,
+  0x2d, 0xfb, 0x07, 0x00, 0x00, 0x85, 0xed, 0x74, 0x7c, 0x49, 0x8b, 0x45,
+  0x00, 0x48, 0x25, 0x00, 0xf0, 0xff, 0xff, 0x49, 0x39, 0xc6, 0x72, 0x19,
+  0x49, 0x8b, 0x45, 0x00, 0x49, 0x03, 0x45, 0x08, 0x48, 0x05, 0xff, 0x0f,
+  0x00, 0x00, 0x48, 0x25, 0x00, 0xf0, 0xff, 0xff, 0x49, 0x39, 0xc6, 0x72,
+  0x08, 0x49, 0x83, 0xc5, 0x20, 0xff, 0xcd, 0xeb, 0xcc, 0xe8, 0x89, 0xfa,
+  0xff, 0xff, 0x4c, 0x89, 0xf3, 0x48, 0x29, 0xd3, 0x8b, 0x0d, 0xde, 0x09,
+  0x00, 0x00, 0x48, 0xd3, 0xeb, 0xe8, 0x9a, 0xfa, 0xff, 0xff, 0x48, 0x8d,
+  0x2c, 0x18, 0x31, 0xc0, 0xb9, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xb0,
+  0x4d, 0x00, 0x75, 0x0b, 0xe8, 0x6d, 0xfb, 0xff, 0xff, 0xc6, 0x45, 0x00,
+  0x02, 0xeb, 0x1d, 0x3c, 0x01, 0x74, 0x08, 0xf6, 0x04, 0x24, 0x02, 0x75,
+  0x0c, 0xeb, 0x11, 0xf3, 0x90, 0x80, 0x7d, 0x00, 0x02, 0x75, 0xf8, 0xeb,
+  0x07, 0x31, 0xff, 0xe8, 0x0f, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x10,
+  0x41, 0x5f, 0x41, 0x5e, 0x41, 0x5d, 0x41, 0x5c, 0x5d, 0x5b, 0xc3, 0x48,
+  0x83, 0xec, 0x20, 0x48, 0x89, 0x3c, 0x24, 0x48, 0xc7, 0x44, 0x24, 0x08,
+  0x04, 0x00, 0x00, 0x04, 0x48, 0x8d, 0x05, 0x33, 0x00, 0x00, 0x00, 0x48,
+  0x89, 0x44, 0x24, 0x10, 0x48, 0xc7, 0x44, 0x24, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0x0b, 0x00, 0x00, 0x00, 0x48, 0x89, 0xe6, 0x31, 0xd2, 0x41,
+  0xba, 0x08, 0x00, 0x00, 0x00, 0xb8, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x05,
+  0x48, 0x83, 0xc4, 0x20, 0x48, 0x85, 0xc0, 0x0f, 0x88, 0x5f, 0x03, 0x00,
+  0x00, 0xc3, 0xb8, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x45, 0x31, 0xc0,
+  0xb8, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xa2, 0x0f, 0xba, 0xe1, 0x19, 0x73,
+  0x04, 0x41, 0x83, 0xc8, 0x01, 0x0f, 0xba, 0xe1, 0x1b, 0x73, 0x52, 0x0f,
+  0xba, 0xe1, 0x1c, 0x73, 0x4c, 0x31, 0xc9, 0x0f, 0x01, 0xd0, 0x41, 0x89,
+  0xc1, 0x83, 0xe0, 0x06, 0x83, 0xf8, 0x06, 0x75, 0x3c, 0xb8, 0x07, 0x00,
+  0x00, 0x00, 0x31, 0xc9, 0x0f, 0xa2, 0x0f, 0xba, 0xe3, 0x05, 0x73, 0x2d,
+  0x41, 0x83, 0xc8, 0x02, 0x0f, 0xba, 0xe1, 0x09, 0x73, 0x04, 0x41, 0x83,
+  0xc8, 0x08, 0x44, 0x89, 0xc8, 0x25, 0xe6, 0x00, 0x00, 0x00, 0x3d, 0xe6,
+  0x00, 0x00, 0x00, 0x75, 0x10, 0x0f, 0xba, 0xe3, 0x10, 0x73, 0x0a, 0x0f,
+  0xba, 0xe3, 0x1e, 0x73, 0x04, 0x41, 0x83, 0xc8, 0x04, 0x44, 0x89, 0xc0,
+  0xc3, 0x53, 0x55, 0xfc, 0x48, 0x89, 0xfb, 0x31, 0xed, 0x83, 0xf8, 0x01,
+  0x48, 0x0f, 0x44, 0xef, 0x4c, 0x8d, 0x04, 0x0e, 0x4c, 0x8d, 0x0c, 0x17,
+  0x48, 0x85, 0xed, 0x74, 0x27, 0x48, 0x89, 0xf8, 0x48, 0x29, 0xe8, 0x48,
+  0x3d, 0x04, 0x10, 0x01, 0x00, 0x72, 0x19, 0x56, 0x57, 0x48, 0x8d, 0x97,
+  0xfc, 0xff, 0xfe, 0xff, 0x48, 0x89, 0xee, 0x48, 0x89, 0xdf, 0xe8, 0x1c,
+  0x01, 0x00, 0x00, 0x48, 0x89, 0xf5, 0x5f, 0x5e, 0x0f, 0xb6, 0x06, 0x48,
+  0xff, 0xc6, 0x89, 0xc1, 0xc1, 0xe9, 0x04, 0x83, 0xf9, 0x0f, 0x75, 0x11,
+  0x0f, 0xb6, 0x16, 0x48, 0xff, 0xc6, 0x48, 0x01, 0xd1, 0x81, 0xfa, 0xff,
+  0x00, 0x00, 0x00, 0x74, 0xef, 0x4c, 0x8d, 0x1c, 0x0f, 0x48, 0x8d, 0x14,
+  0x0e, 0x4d, 0x8d, 0x53, 0x10, 0x4d, 0x39, 0xca, 0x77, 0x26, 0x4c, 0x8d,
+  0x52, 0x10, 0x4d, 0x39, 0xc2, 0x77, 0x1d, 0xf3, 0x0f, 0x6f, 0x06, 0xf3,
+  0x0f, 0x7f, 0x07, 0x48, 0x83, 0xc6, 0x10, 0x48, 0x83, 0xc7, 0x10, 0x4c,
+  0x39, 0xdf, 0x72, 0xeb, 0x48, 0x89, 0xd6, 0x4c, 0x89, 0xdf, 0xeb, 0x02,
+  0xf3, 0xa4, 0x4c, 0x39, 0xc6, 0x0f, 0x83, 0x9d, 0x00, 0x00, 0x00, 0x0f,
+  0xb7, 0x16, 0x48, 0x83, 0xc6, 0x02, 0x83, 0xe0, 0x0f, 0x83, 0xf8, 0x0f,
+  0x75, 0x11, 0x0f, 0xb6, 0x0e, 0x48, 0xff, 0xc6, 0x48, 0x01, 0xc8, 0x81,
+  0xf9, 0xff, 0x00, 0x00, 0x00, 0x74, 0xef, 0x48, 0x8d, 0x48, 0x04, 0x49,
+  0x89, 0xfa, 0x49, 0x29, 0xd2, 0x4c, 0x8d, 0x1c, 0x0f, 0x49, 0x8d, 0x43,
+  0x10, 0x4c, 0x39, 0xc8, 0x77, 0x45, 0x48, 0x83, 0xfa, 0x10, 0x72, 0x1e,
+  0xf3, 0x41, 0x0f, 0x6f, 0x02, 0xf3, 0x0f, 0x7f, 0x07, 0x49, 0x83, 0xc2,
+  0x10, 0x48, 0x83, 0xc7, 0x10, 0x4c, 0x39, 0xdf, 0x72, 0xea, 0x4c, 0x89,
+  0xdf, 0xe9, 0x16, 0xff, 0xff, 0xff, 0x48, 0x83, 0xfa, 0x08, 0x72, 0x1b,
+  0x49, 0x8b, 0x02, 0x48, 0x89, 0x07, 0x49, 0x83, 0xc2, 0x08, 0x48, 0x83,
+  0xc7, 0x08, 0x4c, 0x39, 0xdf, 0x72, 0xed, 0x4c, 0x89, 0xdf, 0xe9, 0xf5,
+  0xfe, 0xff, 0xff, 0x48, 0x83, 0xfa, 0x01, 0x75, 0x0b, 0x41, 0x0f, 0xb6,
+  0x02, 0xf3, 0xaa, 0xe9, 0xe4, 0xfe, 0xff, 0xff, 0x49, 0x89, 0xf3, 0x4c,
+  0x89, 0xd6, 0xf3, 0xa4, 0x4c, 0x89, 0xde, 0xe9, 0xd4, 0xfe, 0xff, 0xff,
+  0x48, 0x85, 0xed, 0x74, 0x0f, 0x48, 0x89, 0xee, 0x49, 0x8d, 0x51, 0xfc,
+  0x48, 0x89, 0xdf, 0xe8, 0x03, 0x00, 0x00, 0x00, 0x5d, 0x5b, 0xc3, 0xb8,
+  0xe8, 0xe8, 0xe8, 0xe8, 0x66, 0x0f, 0x6e, 0xc8, 0x66, 0x0f, 0x70, 0xc9,
+  0x00, 0xb8, 0xe9, 0xe9, 0xe9, 0xe9, 0x66, 0x0f, 0x6e, 0xd0, 0x66, 0x0f,
+  0x70, 0xd2, 0x00, 0x48, 0x39, 0xd6, 0x0f, 0x83, 0x9b, 0x00, 0x00, 0x00,
+  0x48, 0x8d, 0x46, 0x10, 0x48, 0x39, 0xd0, 0x77, 0x4b, 0xf3, 0x0f, 0x6f,
+  0x06, 0x66, 0x0f, 0x6f, 0xd8, 0x66, 0x0f, 0x74, 0xc1, 0x66, 0x0f, 0x74,
+  0xda, 0x66, 0x0f, 0xeb, 0xc3, 0x66, 0x44, 0x0f, 0xd7, 0xd0, 0x45, 0x85,
+  0xd2, 0x74, 0x21, 0x41, 0x0f, 0xbc, 0xca, 0x4c, 0x8d, 0x1c, 0x0e, 0xe8,
+  0x37, 0x00, 0x00, 0x00, 0x49, 0x8d, 0x4b, 0x05, 0x48, 0x29, 0xf1, 0x83,
+  0xf9, 0x10, 0x73, 0x0e, 0x41, 0xd3, 0xea, 0x41, 0xd3, 0xe2, 0x75, 0xdf,
+  0x48, 0x83, 0xc6, 0x10, 0xeb, 0xa9, 0x49, 0x8d, 0x73, 0x05, 0xeb, 0xa3,
+  0x8a, 0x06, 0x24, 0xfe, 0x3c, 0xe8, 0x74, 0x05, 0x48, 0xff, 0xc6, 0xeb,
+  0x96, 0x49, 0x89, 0xf3, 0xe8, 0x02, 0x00, 0x00, 0x00, 0xeb, 0xe3, 0x41,
+  0x8b, 0x43, 0x01, 0x8d, 0x88, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xc1, 0x00,
+  0x00, 0x00, 0xfe, 0x75, 0x1e, 0x4c, 0x89, 0xd9, 0x48, 0x29, 0xf9, 0x83,
+  0xc1, 0x05, 0x29, 0xc8, 0x05, 0x00, 0x00, 0x00, 0x01, 0x25, 0xff, 0xff,
+  0xff, 0x01, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x41, 0x89, 0x43, 0x01, 0xc3,
+  0x49, 0x8b, 0x7d, 0x00, 0x4c, 0x01, 0xe7, 0x49, 0x8b, 0x75, 0x08, 0x48,
+  0x01, 0xfe, 0x48, 0x81, 0xe7, 0x00, 0xf0, 0xff, 0xff, 0x48, 0x81, 0xc6,
+  0xff, 0x0f, 0x00, 0x00, 0x48, 0x81, 0xe6, 0x00, 0xf0, 0xff, 0xff, 0x48,
+  0x29, 0xfe, 0xb8, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x48, 0x85, 0xc0,
+  0x0f, 0x88, 0x96, 0x00, 0x00, 0x00, 0xc3, 0x48, 0x8b, 0x07, 0x48, 0x8d,
+  0x7c, 0xc7, 0x10, 0x48, 0x8b, 0x37, 0x48, 0x85, 0xf6, 0x74, 0x70, 0x48,
+  0x83, 0xc7, 0x08, 0x48, 0x8d, 0x0d, 0x9e, 0x03, 0x00, 0x00, 0x31, 0xd2,
+  0x0f, 0xb6, 0x04, 0x11, 0x85, 0xc0, 0x74, 0x09, 0x3a, 0x04, 0x16, 0x75,
+  0xde, 0xff, 0xc2, 0xeb, 0xef, 0x48, 0x01, 0xd6, 0x0f, 0xb6, 0x06, 0x83,
+  0xf8, 0x2f, 0x74, 0x1f, 0x83, 0xe8, 0x30, 0x83, 0xf8, 0x09, 0x77, 0x3f,
+  0x31, 0xff, 0x6b, 0xff, 0x0a, 0x01, 0xc7, 0x48, 0xff, 0xc6, 0x0f, 0xb6,
+  0x06, 0x83, 0xe8, 0x30, 0x83, 0xf8, 0x09, 0x76, 0xed, 0xeb, 0x29, 0x48,
+  0x89, 0xf7, 0xbe, 0x41, 0x04, 0x08, 0x00, 0xba, 0xa4, 0x01, 0x00, 0x00,
+  0xb8, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x85, 0xc0, 0x78, 0x10, 0x50,
+  0x89, 0xc7, 0xe8, 0x09, 0x00, 0x00, 0x00, 0x5f, 0xb8, 0x03, 0x00, 0x00,
+  0x00, 0x0f, 0x05, 0xc3, 0x48, 0x8d, 0x35, 0x49, 0x03, 0x00, 0x00, 0xba,
+  0x40, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x05, 0xc3,
+  0xbf, 0x7f, 0x00, 0x00, 0x00, 0xb8, 0xe7, 0x00, 0x00, 0x00, 0x0f, 0x05,
+  0x69, 0x6e, 0x73, 0x6b, 0x69, 0x6d, 0x0a, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x4f, 0x4f, 0x44, 0x59, 0x5f, 0x54, 0x45, 0x4c, 0x45, 0x4d, 0x45,
+  0x54, 0x52, 0x59, 0x3d, 0x00, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x44, 0x59, 0x54, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
 };
-unsigned int stub_bin_len = 69;
+unsigned int stub_telemetry_bin_len = 4696;
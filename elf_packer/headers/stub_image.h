@@ -0,0 +1,42 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stub_image.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/03 15:21:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STUB_IMAGE_H
+# define STUB_IMAGE_H
+
+#include <stddef.h>
+#include "payload.h"
+#include "blake2b.h"
+
+// kernel 진입점 정렬 (cache line)
+# define KERNEL_ALIGN 64
+
+// stub.s (dispatcher) 뒤에 cipher 에 맞는 kernel 들을 이어 붙인 이미지
+struct s_stub_image
+{
+    unsigned char   *code;
+    size_t          size;
+    t_stub_params   *params;    // code 안의 params 자리 (append_stub 후 다시 읽을 것)
+    size_t          bss;        // code 뒤에 0 으로 잡을 메모리 (--lazy 의 block 상태)
+    size_t          tail;       // --stream: code 뒤에 출력 파일로 바로 쓴 chunk 들 (메모리에 없음)
+};
+
+int     build_stub(t_stub_image *image, t_cipher cipher, const char *kernel_name, int telemetry);
+int     append_stub(t_stub_image *image, const void *data, size_t size, uint32_t *offset);
+void    free_stub(t_stub_image *image);
+int     is_kernel_name(const char *name);
+const char  *kernel_bin(size_t index, int *aes, uint32_t *features,
+                        const unsigned char **code, size_t *len);
+void    hash_stub(t_blake2b *ctx, t_cipher cipher, const char *kernel_name, int telemetry);
+void    set_telemetry_id(t_stub_image *image, uint64_t id);
+
+#endif
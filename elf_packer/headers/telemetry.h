@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   telemetry.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:42:17 by insub             #+#    #+#             */
+/*   Updated: 2026/02/09 15:31:04 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TELEMETRY_H
+# define TELEMETRY_H
+
+#include <stdint.h>
+
+// --telemetry: stub 이 시작부터 OEP 로 뛰기 직전까지 단계마다 RDTSC 를 찍어 두고,
+// 실행할 때 WOODY_TELEMETRY 가 있으면 record 하나를 씀 (=<fd> 면 그 fd, =/path 면 그 파일 끝에 O_APPEND)
+// stub.inc 의 TELEMETRY_* / TSC_* 와 같은 값
+# define TELEMETRY_MAGIC 0x54594457 // "WDYT"
+# define TELEMETRY_VERSION 1
+# define TELEMETRY_ENV "WOODY_TELEMETRY"
+
+typedef enum e_tsc_point
+{
+    TSC_ENTRY,      // stub 진입 (레지스터 저장 직후)
+    TSC_KERNEL,     // CPU 기능 확인과 kernel 선택 끝
+    TSC_UNPACK,     // region 복호화 / 압축 해제 끝 (--lazy 는 handler 설치까지)
+    TSC_HOT,        // --profile 의 hot block 끝
+    TSC_OEP,        // 레지스터 복구 직전 (record 쓰기는 이 뒤)
+    TSC_POINTS,
+}   t_tsc_point;
+
+// stub.s 의 telemetry_record 와 반드시 같아야 함 (64 bytes, O_APPEND 한 번에 씀)
+typedef struct s_telemetry_record
+{
+    uint32_t    magic;
+    uint16_t    version;
+    uint16_t    points;     // TSC_POINTS
+    uint64_t    id;         // 원본 ELF 의 XXH64 (packer 가 채움). 같은 binary 끼리 묶는 key
+    uint32_t    features;   // stub 이 본 CPU 기능 (FEAT_*)
+    uint32_t    kernel;     // 고른 kernel 번호 (packer 가 넣은 순서)
+    uint64_t    tsc[TSC_POINTS];
+}   t_telemetry_record;
+
+_Static_assert(sizeof(t_telemetry_record) == 64, "t_telemetry_record must match stub.s");
+
+#endif
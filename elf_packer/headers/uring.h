@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   uring.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/19 10:42:08 by insub             #+#    #+#             */
+/*   Updated: 2026/01/19 17:31:55 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef URING_H
+# define URING_H
+
+#include <stddef.h>
+#include <linux/io_uring.h>
+
+// liburing 없이 io_uring_setup / io_uring_enter 를 직접 부르는 최소한의 ring (thread 하나 전용)
+typedef struct s_uring
+{
+    int                 fd;
+    unsigned            entries;
+    unsigned            *sq_head;
+    unsigned            *sq_tail;
+    unsigned            *sq_mask;
+    unsigned            *sq_array;
+    unsigned            *cq_head;
+    unsigned            *cq_tail;
+    unsigned            *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void                *sq_ring;
+    size_t              sq_ring_size;
+    void                *cq_ring;   // IORING_FEAT_SINGLE_MMAP 이면 sq_ring 과 같음
+    size_t              cq_ring_size;
+    unsigned            queued;     // 채웠지만 아직 enter 하지 않은 sqe 수
+}   t_uring;
+
+int                 uring_init(t_uring *ring, unsigned entries);
+void                uring_exit(t_uring *ring);
+int                 uring_register(t_uring *ring, unsigned opcode, void *arg, unsigned count);
+unsigned            uring_space(const t_uring *ring);
+struct io_uring_sqe *uring_get_sqe(t_uring *ring);
+int                 uring_submit(t_uring *ring, unsigned wait);
+int                 uring_peek(t_uring *ring, struct io_uring_cqe *cqe);
+
+#endif
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watch.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/29 15:02:44 by insub             #+#    #+#             */
+/*   Updated: 2026/01/29 15:02:44 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WATCH_H
+# define WATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "payload.h"
+#include "batch.h"
+
+# define WATCH_QUEUE 64             // worker 에게 넘긴 뒤 아직 시작 안 한 job 상한
+# define WATCH_DEBOUNCE_MS 200      // 마지막 close-after-write 뒤 이만큼 조용하면 pack
+
+// inotify watch 하나 (하위 디렉터리마다)
+typedef struct s_watch_dir
+{
+    int     wd;
+    char    *path;
+}   t_watch_dir;
+
+// 쓰기가 끝났지만 아직 조용해지기를 기다리는 파일
+typedef struct s_pending
+{
+    char        *path;
+    uint64_t    deadline;   // CLOCK_MONOTONIC ms
+}   t_pending;
+
+typedef struct s_watch
+{
+    int                 fd;         // inotify
+    t_watch_dir         *dirs;
+    size_t              dir_count;
+    size_t              dir_cap;
+    t_pending           *pending;
+    size_t              pending_count;
+    size_t              pending_cap;
+    char                *out_real;  // --out-dir 의 realpath (그 아래는 보지 않음)
+    char                *cache_real;    // --cache 도 마찬가지
+    const char          *out_dir;
+    uint64_t            debounce;
+    const t_pack_config *config;
+
+    // main thread 가 넣고 worker 가 꺼내는 고리
+    pthread_mutex_t     lock;
+    pthread_cond_t      ready;
+    char                *queue[WATCH_QUEUE];
+    size_t              head;
+    size_t              count;
+    char                **active;   // worker 마다 pack 중인 입력 (같은 파일을 두 번 동시에 하지 않도록)
+    int                 workers;
+    int                 stop;
+    size_t              packed;
+    size_t              failed;
+}   t_watch;
+
+int     run_watch(const char *dir, const t_batch *batch, const t_pack_config *config,
+                  int debounce_ms);
+
+#endif
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   woody.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 14:37:09 by insub             #+#    #+#             */
+/*   Updated: 2026/02/02 14:37:09 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WOODY_H
+# define WOODY_H
+
+#include <stddef.h>
+#include "print_utils.h"
+
+// libwoody (libwoody.a): 파일을 거치지 않고 메모리의 ELF 를 packing.
+// context 하나에 옵션을 정해 두고 여러 번 pack. context 하나를 여러 thread 가 동시에 쓰면 안 됨
+// (context 마다 따로면 됨). 링크할 때 -pthread
+//
+//   t_woody         *ctx = woody_create();
+//   t_woody_buffer  out;
+//   woody_option(ctx, "--compress", NULL);
+//   if (woody_pack(ctx, elf, elf_size, &out) < 0)
+//       fprintf(stderr, "%s\n", woody_error(ctx));
+//   ...
+//   woody_free_buffer(&out);
+//   woody_destroy(ctx);
+
+typedef struct s_woody t_woody;
+
+typedef struct s_woody_buffer
+{
+    unsigned char   *data;
+    size_t          size;
+}   t_woody_buffer;
+
+t_woody     *woody_create(void);
+int         woody_option(t_woody *ctx, const char *name, const char *value);
+int         woody_pack(t_woody *ctx, const void *input, size_t size, t_woody_buffer *output);
+int         woody_pack_fd(t_woody *ctx, const void *input, size_t size, int fd);
+const char  *woody_error(const t_woody *ctx);
+void        woody_free_buffer(t_woody_buffer *output);
+void        woody_destroy(t_woody *ctx);
+
+#endif
@@ -0,0 +1,22 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   xxh64.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/27 16:41:19 by insub             #+#    #+#             */
+/*   Updated: 2026/01/27 16:41:19 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef XXH64_H
+# define XXH64_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// xxHash64: 바뀐 chunk 를 찾는 용도의 빠른 hash (암호학적 hash 아님)
+uint64_t    xxh64(const void *data, size_t size, uint64_t seed);
+
+#endif
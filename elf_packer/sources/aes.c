@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aes.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/12/27 14:10:33 by insub             #+#    #+#             */
+/*   Updated: 2025/12/28 11:47:05 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "aes.h"
+#include <string.h>
+#include <wmmintrin.h>
+
+static const uint8_t g_sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+static uint8_t xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ ((x & 0x80) ? 0x1b : 0));
+}
+
+void aes_expand_key(t_aes *aes, const uint8_t *key, int key_bits)
+{
+    int         nk = key_bits / 32;
+    uint8_t     *w = aes->round_keys;
+    uint8_t     rcon = 1;
+
+    aes->rounds = nk + 6;
+    memcpy(w, key, nk * 4);
+    for (int i = nk; i < 4 * (aes->rounds + 1); i++)
+    {
+        uint8_t t[4];
+
+        memcpy(t, &w[(i - 1) * 4], 4);
+        if (i % nk == 0)
+        {
+            uint8_t first = t[0];
+            t[0] = g_sbox[t[1]] ^ rcon;
+            t[1] = g_sbox[t[2]];
+            t[2] = g_sbox[t[3]];
+            t[3] = g_sbox[first];
+            rcon = xtime(rcon);
+        }
+        else if (nk > 6 && i % nk == 4)
+        {
+            for (int j = 0; j < 4; j++)
+                t[j] = g_sbox[t[j]];
+        }
+        for (int j = 0; j < 4; j++)
+            w[i * 4 + j] = w[(i - nk) * 4 + j] ^ t[j];
+    }
+}
+
+// AES-NI 가 없는 호스트용 byte 단위 구현 (stub.s 의 aes_block_soft 와 같은 방식)
+static void aes_encrypt_soft(const t_aes *aes, uint8_t block[16])
+{
+    static const uint8_t shift_rows[16] = {
+        0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11
+    };
+    const uint8_t   *rk = aes->round_keys;
+    uint8_t         tmp[16];
+
+    for (int i = 0; i < 16; i++)
+        block[i] ^= rk[i];
+    for (int round = 1; round <= aes->rounds; round++)
+    {
+        for (int i = 0; i < 16; i++)
+            tmp[i] = g_sbox[block[shift_rows[i]]];
+        rk += 16;
+        if (round == aes->rounds)
+        {
+            for (int i = 0; i < 16; i++)
+                block[i] = tmp[i] ^ rk[i];
+            break;
+        }
+        for (int c = 0; c < 16; c += 4)
+        {
+            uint8_t *a = &tmp[c];
+            uint8_t t = a[0] ^ a[1] ^ a[2] ^ a[3];
+
+            block[c + 0] = a[0] ^ t ^ xtime(a[0] ^ a[1]) ^ rk[c + 0];
+            block[c + 1] = a[1] ^ t ^ xtime(a[1] ^ a[2]) ^ rk[c + 1];
+            block[c + 2] = a[2] ^ t ^ xtime(a[2] ^ a[3]) ^ rk[c + 2];
+            block[c + 3] = a[3] ^ t ^ xtime(a[3] ^ a[0]) ^ rk[c + 3];
+        }
+    }
+}
+
+static void make_counter_block(uint8_t block[16], const uint8_t nonce[12], uint32_t counter)
+{
+    memcpy(block, nonce, 12);
+    block[12] = (uint8_t)(counter >> 24);
+    block[13] = (uint8_t)(counter >> 16);
+    block[14] = (uint8_t)(counter >> 8);
+    block[15] = (uint8_t)counter;
+}
+
+__attribute__((target("aes,sse4.1")))
+static size_t aes_ctr_xor_ni(const t_aes *aes, const uint8_t nonce[12],
+                             uint32_t counter, uint8_t *buffer, size_t size)
+{
+    __m128i rk[AES_MAX_ROUNDS + 1];
+    uint8_t block[16];
+    size_t  done = 0;
+
+    for (int i = 0; i <= aes->rounds; i++)
+        rk[i] = _mm_loadu_si128((const __m128i *)&aes->round_keys[i * 16]);
+
+    for (; done + 4 * AES_BLOCK_SIZE <= size; done += 4 * AES_BLOCK_SIZE, counter += 4)
+    {
+        __m128i b[4];
+
+        for (int j = 0; j < 4; j++)
+        {
+            make_counter_block(block, nonce, counter + j);
+            b[j] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)block), rk[0]);
+        }
+        for (int r = 1; r < aes->rounds; r++)
+            for (int j = 0; j < 4; j++)
+                b[j] = _mm_aesenc_si128(b[j], rk[r]);
+        for (int j = 0; j < 4; j++)
+        {
+            __m128i *p = (__m128i *)&buffer[done + j * 16];
+            b[j] = _mm_aesenclast_si128(b[j], rk[aes->rounds]);
+            _mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), b[j]));
+        }
+    }
+    return done;
+}
+
+void aes_ctr_xor(const t_aes *aes, const uint8_t nonce[12],
+                 uint32_t counter, uint8_t *buffer, size_t size)
+{
+    uint8_t block[16];
+
+    if (__builtin_cpu_supports("aes"))
+    {
+        size_t done = aes_ctr_xor_ni(aes, nonce, counter, buffer, size);
+        buffer += done;
+        size -= done;
+        counter += (uint32_t)(done / AES_BLOCK_SIZE);
+    }
+    while (size > 0)
+    {
+        size_t chunk = size < AES_BLOCK_SIZE ? size : AES_BLOCK_SIZE;
+
+        make_counter_block(block, nonce, counter++);
+        aes_encrypt_soft(aes, block);
+        for (size_t i = 0; i < chunk; i++)
+            buffer[i] ^= block[i];
+        buffer += chunk;
+        size -= chunk;
+    }
+}
@@ -0,0 +1,334 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 11:26:50 by insub             #+#    #+#             */
+/*   Updated: 2026/02/04 11:26:50 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "arena.h"
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#define ALIGN_UP(x, a) (((x) + (a) - 1) & ~((size_t)(a) - 1))
+#define SLAB_HEAD ALIGN_UP(sizeof(t_slab), ARENA_ALIGN)
+
+enum
+{
+    BLOCK_BUMP,     // slab 안에서 bump
+    BLOCK_SLAB,     // slab 하나를 통째로 (ARENA_LARGE 이상)
+};
+
+// allocation 앞에 붙는 헤더 (ARENA_ALIGN bytes)
+typedef struct s_block
+{
+    uint64_t    size;
+    uint32_t    kind;
+    uint32_t    prev;   // BLOCK_BUMP: 바로 앞 allocation 의 헤더 위치 (LIFO free 때 되돌림)
+}   t_block;
+
+_Static_assert(sizeof(t_block) == ARENA_ALIGN, "t_block must keep allocations aligned");
+
+static __thread t_arena *g_arena;       // arena_use 로 고른 것
+static __thread t_arena g_thread_arena; // 고르지 않았으면 thread 마다 하나 (thread 가 끝날 때 풂)
+static pthread_key_t    g_key;
+static pthread_once_t   g_once = PTHREAD_ONCE_INIT;
+static int              g_no_hugetlb;   // MAP_HUGETLB 가 한 번 실패하면 다시 안 해 봄
+
+static void destroy_thread_arena(void *arena)
+{
+    arena_destroy(arena);
+}
+
+static void make_key(void)
+{
+    pthread_key_create(&g_key, destroy_thread_arena);
+}
+
+// 이 thread 의 allocation 을 arena 에서 받게 함. 이전 것을 돌려줌 (NULL 이면 thread 기본 arena)
+t_arena *arena_use(t_arena *arena)
+{
+    t_arena *prev = g_arena;
+
+    g_arena = arena;
+    return prev;
+}
+
+t_arena *arena_current(void)
+{
+    if (!g_arena)
+    {
+        pthread_once(&g_once, make_key);
+        pthread_setspecific(g_key, &g_thread_arena);
+        g_arena = &g_thread_arena;
+    }
+    return g_arena;
+}
+
+// hugetlbfs 에 잡아 둔 page 가 있으면 그걸 쓰고, 없으면 2 MB 경계에 맞춰 THP 가 바로 붙게 함
+static t_slab *map_slab(size_t size)
+{
+    void    *map = MAP_FAILED;
+    int     huge = FALSE;
+
+    if (!__atomic_load_n(&g_no_hugetlb, __ATOMIC_RELAXED))
+    {
+        map = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        huge = map != MAP_FAILED;
+        if (!huge)
+            __atomic_store_n(&g_no_hugetlb, TRUE, __ATOMIC_RELAXED);
+    }
+    if (map == MAP_FAILED)
+    {
+        char *raw = mmap(NULL, size + ARENA_SLAB_SIZE, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED)
+            return NULL;
+        char *start = (char *)ALIGN_UP((uintptr_t)raw, ARENA_SLAB_SIZE);
+        if (start > raw)
+            munmap(raw, start - raw);
+        munmap(start + size, raw + size + ARENA_SLAB_SIZE - (start + size));
+        madvise(start, size, MADV_HUGEPAGE);
+        map = start;
+    }
+    t_slab *slab = map;
+    *slab = (t_slab){ .size = size, .used = SLAB_HEAD, .huge = huge };
+    return slab;
+}
+
+static int push_slab(t_slab ***list, size_t *count, size_t *cap, t_slab *slab)
+{
+    if (*count == *cap)
+    {
+        size_t  grown = *cap ? *cap * 2 : 16;
+        t_slab  **tmp = realloc(*list, grown * sizeof(*tmp));
+        if (!tmp)
+            return FALSE;
+        *list = tmp;
+        *cap = grown;
+    }
+    (*list)[(*count)++] = slab;
+    return TRUE;
+}
+
+// 남겨 둔 slab 중 size 이상에서 가장 작은 것, 없으면 새로 map. 이번 job 의 slab 목록에 넣음
+static t_slab *take_slab(t_arena *arena, size_t size)
+{
+    t_slab  *slab = NULL;
+    size_t  best = 0;
+
+    size = ALIGN_UP(size, ARENA_SLAB_SIZE);
+    for (size_t i = 0; i < arena->spare_count; i++)
+        if (arena->spare[i]->size >= size && (!slab || arena->spare[i]->size < slab->size))
+        {
+            slab = arena->spare[i];
+            best = i;
+        }
+    if (slab)
+    {
+        arena->spare[best] = arena->spare[--arena->spare_count];
+        arena->spare_bytes -= slab->size;
+        slab->used = SLAB_HEAD;
+        slab->last = 0;
+    }
+    else
+        slab = map_slab(size);
+    if (slab && !push_slab(&arena->slabs, &arena->count, &arena->cap, slab))
+    {
+        munmap(slab, slab->size);
+        slab = NULL;
+    }
+    return slab;
+}
+
+static void *place(t_slab *slab, size_t at, size_t size, int kind)
+{
+    t_block *block = (t_block *)((char *)slab + at);
+
+    *block = (t_block){ .size = size, .kind = kind, .prev = slab->last };
+    slab->last = at;
+    return block + 1;
+}
+
+void *arena_alloc(size_t size)
+{
+    t_arena *arena = arena_current();
+    size_t  need = sizeof(t_block) + ALIGN_UP(size, ARENA_ALIGN);
+    t_slab  *slab;
+
+    if (size >= ARENA_LARGE)
+    {
+        slab = take_slab(arena, SLAB_HEAD + need);
+        if (!slab)
+            return NULL;
+        slab->used = slab->size;
+        return place(slab, SLAB_HEAD, size, BLOCK_SLAB);
+    }
+    slab = arena->current;
+    if (!slab || slab->used + need > slab->size)
+    {
+        slab = take_slab(arena, ARENA_SLAB_SIZE);
+        if (!slab)
+            return NULL;
+        arena->current = slab;
+    }
+    size_t at = slab->used;
+    slab->used += need;
+    return place(slab, at, size, BLOCK_BUMP);
+}
+
+void *arena_calloc(size_t count, size_t size)
+{
+    void *ptr;
+
+    if (size && count > SIZE_MAX / size)
+        return NULL;
+    ptr = arena_alloc(count * size);
+    if (ptr)
+        memset(ptr, 0, count * size);  // 다시 쓰는 slab 은 이전 job 의 내용이 남아 있음
+    return ptr;
+}
+
+static t_slab *slab_of(const t_block *block)
+{
+    return (t_slab *)((char *)block - SLAB_HEAD);
+}
+
+static int is_last(const t_arena *arena, const t_block *block)
+{
+    return block->kind == BLOCK_BUMP && arena->current && arena->current->last
+        && (const char *)block == (const char *)arena->current + arena->current->last;
+}
+
+static size_t find_slab(const t_arena *arena, const t_slab *slab)
+{
+    for (size_t i = 0; i < arena->count; i++)
+        if (arena->slabs[i] == slab)
+            return i;
+    return SIZE_MAX;
+}
+
+// 마지막 bump allocation 이면 되돌리고, slab 하나짜리면 다음 큰 allocation 을 위해 남겨 둠.
+// 나머지는 reset 때 한꺼번에 돌아옴
+void arena_free(void *ptr)
+{
+    t_arena *arena = g_arena;
+    t_block *block;
+
+    if (!ptr || !arena)
+        return;
+    block = (t_block *)ptr - 1;
+    if (is_last(arena, block))
+    {
+        arena->current->used = arena->current->last;
+        arena->current->last = block->prev;
+    }
+    else if (block->kind == BLOCK_SLAB)
+    {
+        t_slab  *slab = slab_of(block);
+        size_t  i = find_slab(arena, slab);
+        if (i != SIZE_MAX && push_slab(&arena->spare, &arena->spare_count, &arena->spare_cap, slab))
+        {
+            arena->slabs[i] = arena->slabs[--arena->count];
+            arena->spare_bytes += slab->size;
+        }
+    }
+}
+
+// 마지막 bump allocation 은 제자리에서, slab 하나짜리는 mremap 으로 늘림
+void *arena_realloc(void *ptr, size_t size)
+{
+    t_arena *arena = arena_current();
+    t_block *block;
+    void    *grown;
+
+    if (!ptr)
+        return arena_alloc(size);
+    block = (t_block *)ptr - 1;
+    if (is_last(arena, block) && size < ARENA_LARGE)
+    {
+        size_t end = (char *)ptr - (char *)arena->current + ALIGN_UP(size, ARENA_ALIGN);
+        if (end <= arena->current->size)
+        {
+            arena->current->used = end;
+            block->size = size;
+            return ptr;
+        }
+    }
+    else if (block->kind == BLOCK_SLAB && size >= ARENA_LARGE)
+    {
+        t_slab  *slab = slab_of(block);
+        size_t  need = ALIGN_UP(SLAB_HEAD + sizeof(t_block) + size, ARENA_SLAB_SIZE);
+        size_t  i = find_slab(arena, slab);
+        if (need <= slab->size)
+        {
+            block->size = size;
+            return ptr;
+        }
+        if (!slab->huge && i != SIZE_MAX)
+        {
+            t_slab *moved = mremap(slab, slab->size, need, MREMAP_MAYMOVE);
+            if (moved != MAP_FAILED)
+            {
+                moved->size = need;
+                moved->used = need;
+                arena->slabs[i] = moved;
+                block = (t_block *)((char *)moved + SLAB_HEAD);
+                block->size = size;
+                return block + 1;
+            }
+        }
+    }
+    grown = arena_alloc(size);
+    if (!grown)
+        return NULL;
+    memcpy(grown, ptr, block->size < size ? block->size : size);
+    arena_free(ptr);
+    return grown;
+}
+
+// job 이 쓴 slab 을 모두 다음 job 용으로 돌림. 남긴 크기가 ARENA_KEEP 를 넘으면 큰 것부터 풂
+void arena_reset(t_arena *arena)
+{
+    for (size_t i = 0; i < arena->count; i++)
+    {
+        t_slab *slab = arena->slabs[i];
+        if (push_slab(&arena->spare, &arena->spare_count, &arena->spare_cap, slab))
+            arena->spare_bytes += slab->size;
+        else
+            munmap(slab, slab->size);
+    }
+    arena->count = 0;
+    arena->current = NULL;
+    while (arena->spare_bytes > ARENA_KEEP)
+    {
+        size_t largest = 0;
+        for (size_t i = 1; i < arena->spare_count; i++)
+            if (arena->spare[i]->size > arena->spare[largest]->size)
+                largest = i;
+        t_slab *slab = arena->spare[largest];
+        arena->spare[largest] = arena->spare[--arena->spare_count];
+        arena->spare_bytes -= slab->size;
+        munmap(slab, slab->size);
+    }
+}
+
+void arena_destroy(t_arena *arena)
+{
+    arena_reset(arena);
+    for (size_t i = 0; i < arena->spare_count; i++)
+        munmap(arena->spare[i], arena->spare[i]->size);
+    free(arena->slabs);
+    free(arena->spare);
+    if (g_arena == arena)
+        g_arena = NULL;
+    *arena = (t_arena){0};
+}
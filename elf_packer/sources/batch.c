@@ -0,0 +1,308 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/16 11:20:37 by insub             #+#    #+#             */
+/*   Updated: 2026/01/16 19:05:12 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "print_utils.h"
+#include "pack.h"
+#include "batch.h"
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+
+typedef struct s_worker
+{
+    t_pool      *pool;
+    int         id;
+    pthread_t   thread;
+}   t_worker;
+
+static int take_own(t_deque *deque, size_t *job)
+{
+    int found = FALSE;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->head < deque->tail)
+    {
+        *job = deque->items[--deque->tail];
+        found = TRUE;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+static int steal(t_pool *pool, int thief, size_t *job)
+{
+    for (int i = 1; i < pool->workers; i++)
+    {
+        t_deque *victim = &pool->deques[(thief + i) % pool->workers];
+        int     found = FALSE;
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->head < victim->tail)
+        {
+            *job = victim->items[victim->head++];
+            found = TRUE;
+        }
+        pthread_mutex_unlock(&victim->lock);
+        if (found)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+// 새 job 은 생기지 않으므로 자기 덱도 비고 훔칠 것도 없으면 끝 (FALSE)
+int next_job(t_pool *pool, int id, size_t *job)
+{
+    return take_own(&pool->deques[id], job) || steal(pool, id, job);
+}
+
+void report_job(const t_job *job)
+{
+    if (job->result < 0)
+        fprintf(stderr, "FAIL %s\n", job->input);
+}
+
+static void run_job(t_pool *pool, t_job *job)
+{
+    struct stat st;
+
+    if (stat(job->input, &st) == 0)
+        job->size = st.st_size;
+    job->result = pack_file(job->input, job->output, pool->config);
+    report_job(job);
+}
+
+// io_uring 을 못 쓰면 (커널이 막았거나 --no-uring) 파일마다 blocking I/O
+static void *worker_main(void *arg)
+{
+    t_worker    *worker = arg;
+    size_t      job;
+
+    if (!worker->pool->no_uring && run_uring_worker(worker->pool, worker->id) == 0)
+        return NULL;
+    while (next_job(worker->pool, worker->id, &job))
+        run_job(worker->pool, &worker->pool->jobs[job]);
+    return NULL;
+}
+
+// --out-dir 이 있으면 out_dir/basename(입력), 없으면 입력.woody (malloc)
+char *default_output(const char *input, const char *out_dir)
+{
+    const char  *base = strrchr(input, '/');
+    char        *output;
+
+    base = base ? base + 1 : input;
+    if (out_dir)
+        output = malloc(strlen(out_dir) + strlen(base) + 2);
+    else
+        output = malloc(strlen(input) + sizeof(".woody"));
+    if (!output)
+        return NULL;
+    if (out_dir)
+        sprintf(output, "%s/%s", out_dir, base);
+    else
+        sprintf(output, "%s.woody", input);
+    return output;
+}
+
+static int add_job(t_job **jobs, size_t *count, size_t *cap, const char *input, char *output)
+{
+    if (*count == *cap)
+    {
+        size_t  new_cap = *cap ? *cap * 2 : 64;
+        t_job   *grown = realloc(*jobs, new_cap * sizeof(**jobs));
+        if (!grown)
+        {
+            free(output);
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        }
+        *jobs = grown;
+        *cap = new_cap;
+    }
+    if (!output)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    (*jobs)[(*count)++] = (t_job){ .input = input, .output = output };
+    return 0;
+}
+
+// manifest 한 줄 = "입력 [출력]" (# 주석, 빈 줄 무시). 입력 문자열은 *lines 에 남김
+static int read_manifest(const t_batch *batch, t_job **jobs, size_t *count, size_t *cap,
+                         char ***lines, size_t *line_count)
+{
+    char    *line = NULL;
+    size_t  len = 0;
+    FILE    *fp = fopen(batch->manifest, "r");
+
+    if (!fp)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    while (getline(&line, &len, fp) > 0)
+    {
+        char *input = strtok(line, " \t\n");
+        char *output = strtok(NULL, " \t\n");
+        if (!input || input[0] == '#')
+            continue;
+        char **grown = realloc(*lines, (*line_count + 1) * sizeof(**lines));
+        // 실패해도 *lines 와 *line_count 는 그대로 맞으므로 정리는 호출자가
+        if (grown)
+            *lines = grown;
+        if (!grown || !(input = strdup(input)))
+        {
+            free(line);
+            fclose(fp);
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        }
+        (*lines)[(*line_count)++] = input;
+        if (add_job(jobs, count, cap, input,
+                output ? strdup(output) : default_output(input, batch->out_dir)) < 0)
+        {
+            free(line);
+            fclose(fp);
+            return -1;
+        }
+    }
+    free(line);
+    fclose(fp);
+    return 0;
+}
+
+int cpu_count(void)
+{
+    cpu_set_t set;
+
+    if (sched_getaffinity(0, sizeof(set), &set) == 0 && CPU_COUNT(&set) > 0)
+        return CPU_COUNT(&set);
+    return 1;
+}
+
+// 오래 떠 있는 모드 (--watch, --serve): LZ4 blob 같은 큰 buffer 를 job 마다 mmap / munmap 하지 않고
+// heap 에 남겨 다음 job 이 그대로 씀
+void warm_heap(void)
+{
+    mallopt(M_MMAP_THRESHOLD, WARM_MMAP_THRESHOLD);
+    mallopt(M_TRIM_THRESHOLD, WARM_TRIM_THRESHOLD);
+}
+
+static double elapsed(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+// job 을 worker 들에게 연속 구간으로 나눠 주고, 먼저 끝난 worker 는 남의 구간 앞쪽을 훔침
+static void run_pool(t_pool *pool, size_t count)
+{
+    t_worker    workers[BATCH_MAX_WORKERS];
+    size_t      *items = malloc(count * sizeof(*items));
+
+    if (!items)
+    {
+        pool->workers = 1;      // 덱 없이 이 thread 에서 순서대로
+        for (size_t i = 0; i < count; i++)
+            run_job(pool, &pool->jobs[i]);
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+        items[i] = i;
+    for (int w = 0; w < pool->workers; w++)
+    {
+        t_deque *deque = &pool->deques[w];
+        pthread_mutex_init(&deque->lock, NULL);
+        deque->items = items;
+        deque->head = count * w / pool->workers;
+        deque->tail = count * (w + 1) / pool->workers;
+        workers[w] = (t_worker){ .pool = pool, .id = w };
+    }
+    int started = 1;
+    while (started < pool->workers
+        && pthread_create(&workers[started].thread, NULL, worker_main, &workers[started]) == 0)
+        started++;
+    worker_main(&workers[0]);   // 못 띄운 worker 의 덱은 남은 worker 들이 훔쳐 감
+    for (int w = 1; w < started; w++)
+        pthread_join(workers[w].thread, NULL);
+    for (int w = 0; w < pool->workers; w++)
+        pthread_mutex_destroy(&pool->deques[w].lock);
+    free(items);
+}
+
+int run_batch(const t_batch *batch, const t_pack_config *config)
+{
+    t_job           *jobs = NULL;
+    size_t          count = 0;
+    size_t          cap = 0;
+    char            **lines = NULL;
+    size_t          line_count = 0;
+    int             ret = 0;
+    t_pack_config   quiet = *config;
+    struct timespec start;
+
+    for (size_t i = 0; i < batch->count && ret == 0; i++)
+        ret = add_job(&jobs, &count, &cap, batch->inputs[i],
+            default_output(batch->inputs[i], batch->out_dir));
+    if (ret == 0 && batch->manifest)
+        ret = read_manifest(batch, &jobs, &count, &cap, &lines, &line_count);
+
+    // io_uring 경로는 읽은 buffer 를 바로 packing 하므로 cache / 고정 key / --stream (출력을 먼저
+    // 열어 두고 region 을 바로 씀) 은 blocking 경로에서
+    t_pool pool = { .jobs = jobs, .config = &quiet,
+        .no_uring = batch->no_uring || config->cache_dir || config->key || config->stream };
+    pool.workers = batch->workers ? batch->workers : cpu_count();
+    if (pool.workers > BATCH_MAX_WORKERS)
+        pool.workers = BATCH_MAX_WORKERS;
+    if ((size_t)pool.workers > count)
+        pool.workers = count ? count : 1;
+    if (ret == 0 && !pool.no_uring)
+        pool.uring_buffer = uring_buffer_size(jobs, count);
+    pool.deques = calloc(pool.workers, sizeof(*pool.deques));
+    if (ret == 0 && !pool.deques)
+        ret = print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+
+    if (ret == 0)
+    {
+        // 파일마다의 진행 출력은 섞이기만 하므로 끄고 마지막에 합계만
+        set_debug(FALSE);
+        quiet.quiet = TRUE;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        run_pool(&pool, count);
+        double seconds = elapsed(&start);
+
+        size_t      failed = 0;
+        size_t      cached = 0;
+        uint64_t    bytes = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            failed += jobs[i].result < 0;
+            cached += jobs[i].result == PACK_CACHED;
+            bytes += jobs[i].size;
+        }
+        printf("batch: %zu packed, %zu cached, %zu failed, %.1f MB in %.2f s (%.1f MB/s, %.1f files/s, %d workers, %s)\n",
+            count - failed - cached, cached, failed, bytes / 1e6, seconds,
+            seconds > 0 ? bytes / 1e6 / seconds : 0.0,
+            seconds > 0 ? count / seconds : 0.0, pool.workers,
+            pool.uring_workers ? "io_uring" : "blocking I/O");
+        ret = failed ? -1 : 0;
+    }
+
+    for (size_t i = 0; i < count; i++)
+        free(jobs[i].output);
+    for (size_t i = 0; i < line_count; i++)
+        free(lines[i]);
+    free(lines);
+    free(jobs);
+    free(pool.deques);
+    return ret;
+}
@@ -0,0 +1,414 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_uring.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/19 13:05:44 by insub             #+#    #+#             */
+/*   Updated: 2026/01/19 17:31:55 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "print_utils.h"
+#include "pack.h"
+#include "stub_image.h"
+#include "batch.h"
+#include "uring.h"
+#include "arena.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#define URING_ENTRIES 64
+#define URING_SLOTS 2                   // 한 buffer 를 packing 하는 동안 다른 buffer 는 읽기 / 쓰기
+#define URING_BUFFER_SIZE (8UL << 20)   // slot buffer 상한. 더 큰 입력은 blocking 경로 (mmap + copy_file_range)
+#define URING_HOLE_MIN (64UL << 10)     // 이만큼 이어진 0 페이지는 쓰지 않고 hole 로 둠
+#define URING_MAX_RUNS 32
+#define PAGE_SIZE 0x1000
+
+// cqe.user_data = 기대한 byte 수 << 32 | 종류 << 8 | slot
+enum e_uring_op
+{
+    OP_STATX,
+    OP_OPEN,
+    OP_READ,
+    OP_WRITE,
+    OP_CLOSE,
+};
+
+// buffer 하나와 그 buffer 를 쓰는 job. direct descriptor 는 입력 slot * 2, 출력 slot * 2 + 1
+typedef struct s_slot
+{
+    t_job           *job;
+    char            *buffer;
+    struct statx    stx;
+    int64_t         read_bytes;
+    int             inflight;   // 아직 cqe 가 오지 않은 sqe 수
+    int             error;      // 처음 실패한 요청의 errno
+    t_stub_image    stub;       // 출력 쓰기가 끝날 때까지 보관
+    t_arena         arena;      // 이 slot 의 job 이 쓴 memory (출력 쓰기가 끝나면 reset)
+}   t_slot;
+
+typedef struct s_uring_worker
+{
+    t_uring     ring;
+    t_slot      slots[URING_SLOTS];
+    char        *buffers;
+    uint64_t    buffer_size;    // slot 하나의 buffer 크기
+    int         fixed;          // buffer 를 등록했으면 READ_FIXED / WRITE_FIXED
+}   t_uring_worker;
+
+static uint64_t user_data(t_uring_worker *w, t_slot *slot, int op, uint32_t expect)
+{
+    return (uint64_t)expect << 32 | (uint64_t)op << 8 | (uint64_t)(slot - w->slots);
+}
+
+static void complete(t_uring_worker *w, const struct io_uring_cqe *cqe)
+{
+    t_slot      *slot = &w->slots[cqe->user_data & 0xff];
+    int         op = (cqe->user_data >> 8) & 0xff;
+    uint32_t    expect = cqe->user_data >> 32;
+
+    slot->inflight--;
+    if (op == OP_READ && cqe->res >= 0)
+        slot->read_bytes += cqe->res;
+    else if (cqe->res < 0 || (op == OP_WRITE && (uint32_t)cqe->res != expect))
+    {
+        if (slot->error == 0)
+            slot->error = cqe->res < 0 ? -cqe->res : EIO;
+    }
+}
+
+static void wait_slot(t_uring_worker *w, t_slot *slot)
+{
+    struct io_uring_cqe cqe;
+
+    while (slot->inflight > 0)
+    {
+        if (uring_peek(&w->ring, &cqe))
+            complete(w, &cqe);
+        else if (uring_submit(&w->ring, 1) < 0 && errno != EAGAIN && errno != EBUSY)
+        {
+            // ring 자체가 망가진 경우. 남은 요청은 기다릴 수 없으니 실패로 처리
+            slot->error = errno;
+            slot->inflight = 0;
+        }
+    }
+}
+
+// link 묶음은 한 번의 enter 에 다 넘어가야 하므로 자리가 모자라면 먼저 넘김
+static void reserve(t_uring_worker *w, unsigned count)
+{
+    if (uring_space(&w->ring) < count)
+        uring_submit(&w->ring, 0);
+}
+
+static void prep_rw(t_uring_worker *w, t_slot *slot, int write, int file,
+                    const void *buf, uint32_t len, uint64_t offset)
+{
+    struct io_uring_sqe *sqe = uring_get_sqe(&w->ring);
+    int                 fixed = w->fixed && buf >= (void *)w->buffers
+        && buf < (void *)(w->buffers + URING_SLOTS * w->buffer_size);
+
+    if (write)
+        sqe->opcode = fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    else
+        sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    sqe->fd = file;
+    sqe->flags = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+    sqe->addr = (uint64_t)buf;
+    sqe->len = len;
+    sqe->off = offset;
+    sqe->buf_index = 0;
+    sqe->user_data = user_data(w, slot, write ? OP_WRITE : OP_READ, len);
+    slot->inflight++;
+}
+
+// openat 으로 direct descriptor 를 채우고 그 뒤 요청들을 hard link 로 이음.
+// 앞이 실패해도 close 까지는 돌아서 slot 이 비워짐 (실패는 error 에 남음)
+static void prep_open(t_uring_worker *w, t_slot *slot, const char *path, int flags, int file)
+{
+    struct io_uring_sqe *sqe = uring_get_sqe(&w->ring);
+
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (uint64_t)path;
+    sqe->open_flags = flags;   // direct descriptor 에는 O_CLOEXEC 를 줄 수 없음
+    sqe->len = 0755;
+    sqe->file_index = file + 1;
+    sqe->flags = IOSQE_IO_HARDLINK;
+    sqe->user_data = user_data(w, slot, OP_OPEN, 0);
+    slot->inflight++;
+}
+
+static void prep_close(t_uring_worker *w, t_slot *slot, int file)
+{
+    struct io_uring_sqe *sqe = uring_get_sqe(&w->ring);
+
+    sqe->opcode = IORING_OP_CLOSE;
+    sqe->file_index = file + 1;
+    sqe->user_data = user_data(w, slot, OP_CLOSE, 0);
+    slot->inflight++;
+}
+
+// statx 와 open -> read -> close 를 한 번에 넘기고 기다리지 않음
+static void submit_read(t_uring_worker *w, t_slot *slot, t_job *job)
+{
+    int file = (int)(slot - w->slots) * 2;
+
+    slot->job = job;
+    slot->error = 0;
+    slot->read_bytes = 0;
+    memset(&slot->stx, 0, sizeof(slot->stx));
+    reserve(w, 4);
+
+    struct io_uring_sqe *sqe = uring_get_sqe(&w->ring);
+    sqe->opcode = IORING_OP_STATX;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (uint64_t)job->input;
+    sqe->len = STATX_SIZE;
+    sqe->off = (uint64_t)&slot->stx;
+    sqe->user_data = user_data(w, slot, OP_STATX, 0);
+    slot->inflight++;
+
+    prep_open(w, slot, job->input, O_RDONLY, file);
+    prep_rw(w, slot, FALSE, file, slot->buffer, w->buffer_size, 0);
+    prep_close(w, slot, file);
+    uring_submit(&w->ring, 0);
+}
+
+// 짧게 읽혔으면 (signal, 일부 filesystem) 남은 부분을 다시 open -> read -> close 로 읽음.
+// 더 못 읽으면 (그 사이 파일이 줄어듦) FALSE
+static int read_rest(t_uring_worker *w, t_slot *slot)
+{
+    int     file = (int)(slot - w->slots) * 2;
+    int64_t done = slot->read_bytes;
+
+    reserve(w, 3);
+    prep_open(w, slot, slot->job->input, O_RDONLY, file);
+    prep_rw(w, slot, FALSE, file, slot->buffer + done, slot->job->size - done, done);
+    prep_close(w, slot, file);
+    uring_submit(&w->ring, 0);
+    wait_slot(w, slot);
+    return slot->error == 0 && slot->read_bytes > done;
+}
+
+static int is_zero_page(const char *page)
+{
+    static const char zero[PAGE_SIZE];
+
+    return memcmp(page, zero, PAGE_SIZE) == 0;
+}
+
+// 출력에 실제로 써야 할 구간. 길게 이어진 0 페이지 (--compress 로 비운 원본 자리) 는 건너뛰어
+// hole 로 남김. 구간이 너무 잘게 쪼개지면 통째로 씀
+static int data_runs(const t_file *file, t_patch *runs)
+{
+    int         count = 0;
+    uint64_t    start = 0;
+    uint64_t    page = 0;
+
+    while (page + PAGE_SIZE <= file->size)
+    {
+        if (!is_zero_page(file->buffer + page))
+        {
+            page += PAGE_SIZE;
+            continue;
+        }
+        uint64_t end = page;
+        while (end + PAGE_SIZE <= file->size && is_zero_page(file->buffer + end))
+            end += PAGE_SIZE;
+        if (end - page >= URING_HOLE_MIN)
+        {
+            if (page > start && count == URING_MAX_RUNS)
+                break;
+            if (page > start)
+                runs[count++] = (t_patch){ start, page - start };
+            start = end;
+        }
+        page = end;
+    }
+    if (start < file->size && count < URING_MAX_RUNS && page + PAGE_SIZE > file->size)
+        runs[count++] = (t_patch){ start, file->size - start };
+    else if (start < file->size)
+    {
+        runs[0] = (t_patch){ 0, file->size };
+        count = 1;
+    }
+    return count;
+}
+
+// open -> 구간 write -> stub write -> close 를 한 묶음으로 넘김. 원본을 통째로 읽어 왔으므로
+// blocking 경로의 copy_file_range + 헤더 페이지 다시 쓰기 대신 buffer 를 그대로 씀
+static void submit_write(t_uring_worker *w, t_slot *slot, const t_file *file, const t_output *out)
+{
+    t_patch runs[URING_MAX_RUNS];
+    t_file  head = *file;   // --layout extend: 옮기는 원본 끝은 따로 (원래 자리는 hole)
+    int     count;
+    int     out_file = (int)(slot - w->slots) * 2 + 1;
+
+    if (out->trailer_to)
+        head.size = out->trailer;
+    count = data_runs(&head, runs);
+    reserve(w, count + 4);
+    unlink(slot->job->output);  // begin_output 처럼 덮어쓰지 않고 새로 만듦
+    prep_open(w, slot, slot->job->output, O_WRONLY | O_CREAT | O_TRUNC, out_file);
+    for (int i = 0; i < count; i++)
+        prep_rw(w, slot, TRUE, out_file, file->buffer + runs[i].offset,
+            runs[i].size, runs[i].offset);
+    prep_rw(w, slot, TRUE, out_file, out->stub, out->stub_size, out->stub_offset);
+    if (out->trailer_to)
+        prep_rw(w, slot, TRUE, out_file, file->buffer + out->trailer,
+            file->size - out->trailer, out->trailer_to);
+    prep_close(w, slot, out_file);
+    uring_submit(&w->ring, 0);
+}
+
+// 읽기가 끝난 slot 을 packing 하고 출력 쓰기를 넘김
+static void pack_slot(t_uring_worker *w, t_slot *slot, const t_pack_config *config)
+{
+    t_job       *job = slot->job;
+    t_output    out = { .fd = -1 };
+
+    if (slot->error)
+    {
+        errno = slot->error;
+        job->result = print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+        return;
+    }
+    job->size = slot->stx.stx_size;
+    if (job->size > w->buffer_size)
+    {
+        job->result = pack_file(job->input, job->output, config);
+        return;
+    }
+    while ((uint64_t)slot->read_bytes < job->size && read_rest(w, slot))
+        ;
+    if (slot->error)
+    {
+        errno = slot->error;
+        job->result = print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+        return;
+    }
+    if (job->size == 0 || (uint64_t)slot->read_bytes != job->size)
+    {
+        job->result = print_error(INVALID_ELF, ERRNO_FALSE);
+        return;
+    }
+
+    // 두 slot 의 job 이 겹쳐 살아 있으므로 thread 의 arena 대신 slot 마다 따로
+    t_file  file = { .fd = -1, .buffer = slot->buffer, .size = job->size };
+    t_arena *prev = arena_use(&slot->arena);
+    job->result = pack_image(&file, config, &out, &slot->stub);
+    arena_use(prev);
+    if (job->result < 0)
+        return;
+    submit_write(w, slot, &file, &out);
+}
+
+// 출력 쓰기까지 끝난 slot 을 비움
+static void finish_slot(t_slot *slot)
+{
+    t_job *job = slot->job;
+
+    if (!job)
+        return;
+    arena_reset(&slot->arena);  // stub 도 여기 있음
+    if (job->result == 0 && slot->error)
+    {
+        errno = slot->error;
+        job->result = print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    }
+    report_job(job);
+    slot->job = NULL;
+}
+
+// 등록 buffer 는 등록할 때 전부 pin 되므로 (worker 마다 2 x 8 MB 면 8 ms 쯤) batch 에서
+// 가장 큰 입력에 맞춤. stat 이 실패한 입력은 어차피 읽기에서 실패하므로 건너뜀
+uint64_t uring_buffer_size(const t_job *jobs, size_t count)
+{
+    struct stat st;
+    uint64_t    size = PAGE_SIZE;
+
+    for (size_t i = 0; i < count && size < URING_BUFFER_SIZE; i++)
+        if (stat(jobs[i].input, &st) == 0 && (uint64_t)st.st_size > size)
+            size = st.st_size;
+    if (size > URING_BUFFER_SIZE)
+        size = URING_BUFFER_SIZE;
+    return (size + PAGE_SIZE - 1) & ~(uint64_t)(PAGE_SIZE - 1);
+}
+
+static int setup_worker(t_uring_worker *w, uint64_t buffer_size)
+{
+    struct io_uring_rsrc_register   files = { .nr = URING_SLOTS * 2,
+                                              .flags = IORING_RSRC_REGISTER_SPARSE };
+    struct iovec                    iov;
+
+    *w = (t_uring_worker){ .buffer_size = buffer_size };
+    if (uring_init(&w->ring, URING_ENTRIES) < 0)
+        return -1;
+    // direct descriptor (5.19+) 가 없으면 read -> write 를 link 할 수 없으므로 blocking 경로
+    if (uring_register(&w->ring, IORING_REGISTER_FILES2, &files, sizeof(files)) < 0)
+    {
+        uring_exit(&w->ring);
+        return -1;
+    }
+    w->buffers = mmap(NULL, URING_SLOTS * buffer_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (w->buffers == MAP_FAILED)
+    {
+        uring_exit(&w->ring);
+        return -1;
+    }
+    // 등록은 RLIMIT_MEMLOCK 에 걸릴 수 있음. 안 되면 일반 READ / WRITE
+    iov = (struct iovec){ w->buffers, URING_SLOTS * buffer_size };
+    w->fixed = uring_register(&w->ring, IORING_REGISTER_BUFFERS, &iov, 1) == 0;
+    for (int i = 0; i < URING_SLOTS; i++)
+        w->slots[i].buffer = w->buffers + i * buffer_size;
+    return 0;
+}
+
+// io_uring 으로 job 들을 처리. slot 두 개를 번갈아 쓰면서 한 job 을 packing 하는 동안
+// 다음 job 의 open + read 와 이전 job 의 write 가 커널에서 진행됨. ring 을 못 띄우면 -1
+int run_uring_worker(t_pool *pool, int id)
+{
+    t_uring_worker  w;
+    size_t          job;
+    int             cur = 0;
+
+    if (setup_worker(&w, pool->uring_buffer) < 0)
+        return -1;
+    __atomic_fetch_add(&pool->uring_workers, 1, __ATOMIC_RELAXED);
+
+    if (next_job(pool, id, &job))
+        submit_read(&w, &w.slots[0], &pool->jobs[job]);
+    while (w.slots[cur].job)
+    {
+        t_slot *slot = &w.slots[cur];
+        t_slot *other = &w.slots[cur ^ 1];
+
+        wait_slot(&w, slot);
+        wait_slot(&w, other);
+        finish_slot(other);
+        if (next_job(pool, id, &job))
+            submit_read(&w, other, &pool->jobs[job]);
+        pack_slot(&w, slot, pool->config);
+        cur ^= 1;
+    }
+    for (int i = 0; i < URING_SLOTS; i++)
+    {
+        wait_slot(&w, &w.slots[i]);
+        finish_slot(&w.slots[i]);
+    }
+    for (int i = 0; i < URING_SLOTS; i++)
+        arena_destroy(&w.slots[i].arena);
+    uring_exit(&w.ring);
+    munmap(w.buffers, URING_SLOTS * w.buffer_size);
+    return 0;
+}
@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bcj.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/14 10:26:08 by insub             #+#    #+#             */
+/*   Updated: 2026/01/14 22:51:40 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bcj.h"
+#include <string.h>
+
+static int in_range(uint32_t value)
+{
+    return ((value + BCJ_RANGE) & ~(uint32_t)BCJ_MASK) == 0;
+}
+
+// E8/E9 뒤 4 bytes 는 변환 여부와 관계없이 항상 건너뜀. 그래야 stub 이 앞에서부터
+// 되돌릴 때 판단에 쓰는 operand 가 이 위치 말고는 바뀌지 않음
+void bcj_x86_encode(uint8_t *buffer, size_t size)
+{
+    size_t i = 0;
+
+    while (i + 5 <= size)
+    {
+        uint32_t rel;
+
+        if ((buffer[i] & 0xfe) != 0xe8)
+        {
+            i++;
+            continue;
+        }
+        memcpy(&rel, &buffer[i + 1], sizeof(rel));
+        if (in_range(rel))
+        {
+            // 다음 명령 위치 (region 시작 기준) 를 더해 call target 으로
+            uint32_t target = ((rel + (uint32_t)(i + 5) + BCJ_RANGE) & BCJ_MASK) - BCJ_RANGE;
+            memcpy(&buffer[i + 1], &target, sizeof(target));
+        }
+        i += 5;
+    }
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   blake2b.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/25 14:20:07 by insub             #+#    #+#             */
+/*   Updated: 2026/01/25 14:20:07 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "blake2b.h"
+#include <string.h>
+
+#define ROTR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+#define G(a, b, c, d, x, y)                         \
+    do {                                            \
+        a += b + x; d = ROTR64(d ^ a, 32);          \
+        c += d;     b = ROTR64(b ^ c, 24);          \
+        a += b + y; d = ROTR64(d ^ a, 16);          \
+        c += d;     b = ROTR64(b ^ c, 63);          \
+    } while (0)
+
+static const uint64_t g_iv[8] = {
+    0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+    0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
+};
+
+static const uint8_t g_sigma[12][16] = {
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+    { 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+    { 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+    { 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+    { 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+    { 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+    { 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+    { 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+    { 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+};
+
+static void compress(t_blake2b *ctx, const uint8_t *block, int last)
+{
+    uint64_t m[16];
+    uint64_t v[16];
+
+    memcpy(m, block, sizeof(m));   // little-endian 전제 (x86-64)
+    memcpy(v, ctx->h, sizeof(ctx->h));
+    memcpy(v + 8, g_iv, sizeof(g_iv));
+    v[12] ^= ctx->count[0];
+    v[13] ^= ctx->count[1];
+    if (last)
+        v[14] = ~v[14];
+    for (int r = 0; r < 12; r++)
+    {
+        const uint8_t *s = g_sigma[r];
+        G(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+        G(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+        G(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+        G(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+        G(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+        G(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+        G(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+        G(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+    for (int i = 0; i < 8; i++)
+        ctx->h[i] ^= v[i] ^ v[i + 8];
+}
+
+static void add_count(t_blake2b *ctx, uint64_t n)
+{
+    ctx->count[0] += n;
+    if (ctx->count[0] < n)
+        ctx->count[1]++;
+}
+
+void blake2b_init(t_blake2b *ctx, size_t out_size)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    memcpy(ctx->h, g_iv, sizeof(g_iv));
+    ctx->h[0] ^= 0x01010000 ^ out_size;    // fanout 1, depth 1, key 없음
+    ctx->out_size = out_size;
+}
+
+// 마지막 block 은 final 에서 last 표시와 함께 압축해야 하므로 가득 차도 남겨 둠
+void blake2b_update(t_blake2b *ctx, const void *data, size_t size)
+{
+    const uint8_t *in = data;
+
+    if (size == 0)
+        return;
+    if (ctx->used + size > BLAKE2B_BLOCK_SIZE)
+    {
+        size_t fill = BLAKE2B_BLOCK_SIZE - ctx->used;
+        memcpy(ctx->block + ctx->used, in, fill);
+        add_count(ctx, BLAKE2B_BLOCK_SIZE);
+        compress(ctx, ctx->block, 0);
+        ctx->used = 0;
+        in += fill;
+        size -= fill;
+        for (; size > BLAKE2B_BLOCK_SIZE; in += BLAKE2B_BLOCK_SIZE, size -= BLAKE2B_BLOCK_SIZE)
+        {
+            add_count(ctx, BLAKE2B_BLOCK_SIZE);
+            compress(ctx, in, 0);
+        }
+    }
+    memcpy(ctx->block + ctx->used, in, size);
+    ctx->used += size;
+}
+
+void blake2b_final(t_blake2b *ctx, uint8_t *out)
+{
+    add_count(ctx, ctx->used);
+    memset(ctx->block + ctx->used, 0, BLAKE2B_BLOCK_SIZE - ctx->used);
+    compress(ctx, ctx->block, 1);
+    memcpy(out, ctx->h, ctx->out_size);
+}
+
+void blake2b(uint8_t *out, size_t out_size, const void *data, size_t size)
+{
+    t_blake2b ctx;
+
+    blake2b_init(&ctx, out_size);
+    blake2b_update(&ctx, data, size);
+    blake2b_final(&ctx, out);
+}
@@ -0,0 +1,309 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/25 14:20:07 by insub             #+#    #+#             */
+/*   Updated: 2026/01/25 14:20:07 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "cache.h"
+#include "blake2b.h"
+#include "output.h"
+#include "stub_image.h"
+#include "print_utils.h"
+#include "arena.h"
+#include <dirent.h>
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/fs.h>
+
+#define CACHE_DIRS 8
+
+typedef struct s_entry
+{
+    char            name[CACHE_KEY_SIZE * 2 + 1];
+    uint64_t        size;       // 디스크에서 차지하는 크기 (hole 제외)
+    struct timespec used;       // mtime: 넣거나 꺼낼 때마다 갱신
+}   t_entry;
+
+// 이 process 가 아는 cache 디렉터리의 크기. --serve 는 요청마다 --cache 가 다를 수 있으므로
+// 디렉터리 (dev, inode) 마다 따로 셈
+typedef struct s_usage
+{
+    dev_t       dev;
+    ino_t       ino;
+    uint64_t    used;
+}   t_usage;
+
+// batch worker 들이 같이 쓰므로 lock. 표에 없는 디렉터리는 훑어서 셈 (다른 process 가 넣은 것은
+// 다음에 훑을 때 반영). 표가 차면 돌아가며 덮음
+static pthread_mutex_t  g_lock = PTHREAD_MUTEX_INITIALIZER;
+static t_usage          g_usage[CACHE_DIRS];
+static int              g_usage_count;
+static int              g_usage_next;
+
+static void hash_u64(t_blake2b *ctx, uint64_t value)
+{
+    blake2b_update(ctx, &value, sizeof(value));
+}
+
+static void hash_string(t_blake2b *ctx, const char *str)
+{
+    size_t len = str ? strlen(str) : 0;
+
+    hash_u64(ctx, len);
+    blake2b_update(ctx, str, len);
+}
+
+// 입력 말고 출력 bytes 를 결정하는 것 (quiet, cache 위치 / 크기는 결과에 영향 없음)
+void hash_config(t_blake2b *ctx, const t_pack_config *config)
+{
+    hash_stub(ctx, config->cipher, config->kernel, config->telemetry);
+    hash_u64(ctx, config->cipher);
+    hash_string(ctx, config->kernel);
+    hash_u64(ctx, config->compress);
+    hash_u64(ctx, config->filter);
+    hash_u64(ctx, config->lazy_shift);
+    hash_u64(ctx, config->threads);
+    hash_u64(ctx, config->stream);
+    hash_u64(ctx, config->telemetry);
+    hash_u64(ctx, config->layout);
+    hash_u64(ctx, config->huge_pages);
+    hash_u64(ctx, config->profile != NULL);
+    if (config->profile)
+    {
+        hash_u64(ctx, config->profile->entry);
+        hash_u64(ctx, config->profile->count);
+        blake2b_update(ctx, config->profile->pages,
+            config->profile->count * sizeof(*config->profile->pages));
+    }
+    hash_u64(ctx, config->key != NULL);
+    if (config->key)
+        blake2b_update(ctx, config->key, CACHE_KEY_SIZE);
+}
+
+void cache_key(const t_file *file, const t_pack_config *config, uint8_t *key)
+{
+    t_blake2b ctx;
+
+    blake2b_init(&ctx, CACHE_KEY_SIZE);
+    hash_string(&ctx, CACHE_VERSION);
+    hash_u64(&ctx, file->size);
+    blake2b_update(&ctx, file->buffer, file->size);
+    hash_config(&ctx, config);
+    blake2b_final(&ctx, key);
+}
+
+static void key_name(char *name, const uint8_t *key)
+{
+    for (int i = 0; i < CACHE_KEY_SIZE; i++)
+        sprintf(name + i * 2, "%02x", key[i]);
+}
+
+static int entry_path(char *path, const char *dir, const uint8_t *key)
+{
+    char name[CACHE_KEY_SIZE * 2 + 1];
+
+    key_name(name, key);
+    return snprintf(path, PATH_MAX, "%s/%s", dir, name) < PATH_MAX;
+}
+
+// 자리에 있던 출력을 지우고 entry 를 reflink -> hardlink -> copy_file_range 순으로 꺼냄
+static const char *emit(const char *path, int fd_in, uint64_t size, const char *output)
+{
+    if (unlink(output) < 0 && errno != ENOENT)
+        return NULL;
+    int fd_out = open(output, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0755);
+    if (fd_out >= 0 && ioctl(fd_out, FICLONE, fd_in) == 0)
+    {
+        close(fd_out);
+        return "reflink";
+    }
+    if (fd_out >= 0)
+    {
+        close(fd_out);
+        unlink(output);
+    }
+    // 출력과 cache 가 같은 inode 가 됨. begin_output 이 덮어쓰기 전에 unlink 하므로 안전
+    if (link(path, output) == 0)
+        return "hardlink";
+    fd_out = open(output, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0755);
+    if (fd_out < 0)
+        return NULL;
+    int copied = clone_file(fd_out, fd_in, size);
+    close(fd_out);
+    if (copied == TRUE)
+        return "copy";
+    unlink(output);
+    return NULL;
+}
+
+// 있으면 output 에 꺼내고 TRUE. 없거나 꺼내지 못하면 FALSE (호출자가 새로 packing)
+int cache_fetch(const t_pack_config *config, const uint8_t *key, const char *output)
+{
+    char        path[PATH_MAX];
+    struct stat st;
+
+    if (!entry_path(path, config->cache_dir, key))
+        return FALSE;
+    int fd_in = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd_in < 0)
+        return FALSE;
+    const char *how = NULL;
+    if (fstat(fd_in, &st) == 0)
+        how = emit(path, fd_in, st.st_size, output);
+    if (how)
+    {
+        futimens(fd_in, NULL);  // 최근에 쓴 entry 는 지우지 않도록
+        print_debug("[+] Cache hit (%s): %s\n", how, path);
+    }
+    close(fd_in);
+    return how != NULL;
+}
+
+static int compare_used(const void *a, const void *b)
+{
+    const t_entry *ea = a;
+    const t_entry *eb = b;
+
+    if (ea->used.tv_sec != eb->used.tv_sec)
+        return (ea->used.tv_sec > eb->used.tv_sec) - (ea->used.tv_sec < eb->used.tv_sec);
+    return (ea->used.tv_nsec > eb->used.tv_nsec) - (ea->used.tv_nsec < eb->used.tv_nsec);
+}
+
+static int is_entry_name(const char *name)
+{
+    size_t len = strspn(name, "0123456789abcdef");
+
+    return len == CACHE_KEY_SIZE * 2 && name[len] == '\0';
+}
+
+// 디렉터리를 훑어 크기를 다시 세고, max 를 넘으면 오래 안 쓴 것부터 지움.
+// 지운 뒤 (또는 그대로) 남은 크기를 돌려줌
+static uint64_t evict(const char *dir, uint64_t max)
+{
+    DIR             *d = opendir(dir);
+    t_entry         *entries = NULL;
+    size_t          count = 0;
+    size_t          cap = 0;
+    uint64_t        used = 0;
+    struct dirent   *ent;
+    struct stat     st;
+
+    if (!d)
+        return 0;
+    while ((ent = readdir(d)))
+    {
+        if (!is_entry_name(ent->d_name)
+            || fstatat(dirfd(d), ent->d_name, &st, AT_SYMLINK_NOFOLLOW) < 0
+            || !S_ISREG(st.st_mode))
+            continue;
+        if (count == cap)
+        {
+            t_entry *grown = arena_realloc(entries, (cap ? cap * 2 : 64) * sizeof(*entries));
+            if (!grown)
+                break;
+            entries = grown;
+            cap = cap ? cap * 2 : 64;
+        }
+        strcpy(entries[count].name, ent->d_name);
+        entries[count].size = (uint64_t)st.st_blocks * 512;
+        entries[count].used = st.st_mtim;
+        used += entries[count++].size;
+    }
+
+    if (used > max)
+    {
+        uint64_t    target = max / 100 * CACHE_EVICT_PERCENT;
+        size_t      removed = 0;
+
+        qsort(entries, count, sizeof(*entries), compare_used);
+        for (size_t i = 0; i < count && used > target; i++)
+        {
+            if (unlinkat(dirfd(d), entries[i].name, 0) == 0 || errno == ENOENT)
+            {
+                used -= entries[i].size;
+                removed++;
+            }
+        }
+        print_debug("[+] Cache evicted %zu entries (%.1f MB left)\n", removed, used / 1e6);
+    }
+    arena_free(entries);
+    closedir(d);
+    return used;
+}
+
+static t_usage *find_usage(const struct stat *dir)
+{
+    for (int i = 0; i < g_usage_count; i++)
+        if (g_usage[i].dev == dir->st_dev && g_usage[i].ino == dir->st_ino)
+            return &g_usage[i];
+    return NULL;
+}
+
+static t_usage *add_usage(const struct stat *dir)
+{
+    t_usage *usage = &g_usage[g_usage_next];
+
+    g_usage_next = (g_usage_next + 1) % CACHE_DIRS;
+    if (g_usage_count < CACHE_DIRS)
+        g_usage_count++;
+    *usage = (t_usage){ .dev = dir->st_dev, .ino = dir->st_ino };
+    return usage;
+}
+
+// 임시 이름으로 복사한 뒤 rename 해서 넣음 (같은 key 를 동시에 넣어도 둘 중 하나가 남음).
+// cache 는 부가 기능이므로 실패해도 packing 결과에는 영향 없음
+void cache_store(const t_pack_config *config, const uint8_t *key, const char *output)
+{
+    char        path[PATH_MAX];
+    char        tmp[PATH_MAX];
+    struct stat st;
+    struct stat dir;
+
+    if ((mkdir(config->cache_dir, 0755) < 0 && errno != EEXIST)
+        || stat(config->cache_dir, &dir) < 0
+        || !entry_path(path, config->cache_dir, key)
+        || snprintf(tmp, sizeof(tmp), "%s.%d.%lx.tmp", path, getpid(),
+                    (unsigned long)pthread_self()) >= (int)sizeof(tmp))
+        return;
+    int fd_in = open(output, O_RDONLY | O_CLOEXEC);
+    if (fd_in < 0)
+        return;
+    int fd_out = open(tmp, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0755);
+    int stored = fd_out >= 0 && fstat(fd_in, &st) == 0
+        && clone_file(fd_out, fd_in, st.st_size) == TRUE
+        && fstat(fd_out, &st) == 0;
+    close(fd_in);
+    if (fd_out >= 0)
+        close(fd_out);
+    if (!stored || rename(tmp, path) < 0)
+    {
+        unlink(tmp);
+        return;
+    }
+    print_debug("[+] Cached as %s\n", path);
+
+    pthread_mutex_lock(&g_lock);
+    uint64_t    size = (uint64_t)st.st_blocks * 512;
+    t_usage     *usage = find_usage(&dir);
+    if (!usage || usage->used + size > config->cache_size)
+    {
+        if (!usage)
+            usage = add_usage(&dir);
+        usage->used = evict(config->cache_dir, config->cache_size);
+    }
+    else
+        usage->used += size;
+    pthread_mutex_unlock(&g_lock);
+}
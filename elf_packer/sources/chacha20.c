@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   chacha20.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/12/20 13:24:51 by insub             #+#    #+#             */
+/*   Updated: 2025/12/20 17:11:02 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "chacha20.h"
+#include <string.h>
+
+#define ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#define QUARTER_ROUND(a, b, c, d)                   \
+    do {                                            \
+        a += b; d ^= a; d = ROTL(d, 16);            \
+        c += d; b ^= c; b = ROTL(b, 12);            \
+        a += b; d ^= a; d = ROTL(d, 8);             \
+        c += d; b ^= c; b = ROTL(b, 7);             \
+    } while (0)
+
+static void chacha20_block(const uint32_t input[16], uint8_t output[64])
+{
+    uint32_t x[16];
+
+    memcpy(x, input, sizeof(x));
+    for (int i = 0; i < 10; i++)
+    {
+        QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+    for (int i = 0; i < 16; i++)
+        x[i] += input[i];
+    // x86-64 only: little endian 이므로 그대로 복사
+    memcpy(output, x, 64);
+}
+
+void chacha20_xor(const uint32_t key[8], const uint32_t nonce[3],
+                  uint32_t counter, uint8_t *buffer, size_t size)
+{
+    uint32_t    state[16] = {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 // "expand 32-byte k"
+    };
+    uint8_t     keystream[64];
+
+    memcpy(&state[4], key, 32);
+    state[12] = counter;
+    memcpy(&state[13], nonce, 12);
+
+    while (size > 0)
+    {
+        size_t chunk = size < 64 ? size : 64;
+
+        chacha20_block(state, keystream);
+        for (size_t i = 0; i < chunk; i++)
+            buffer[i] ^= keystream[i];
+        buffer += chunk;
+        size -= chunk;
+        state[12]++;
+    }
+}
@@ -13,6 +13,30 @@
 #include "main.h"
 #include "print_utils.h"
 #include "elf_parser.h"
+#include <string.h>
+
+// parse_elf 가 따라갈 헤더 / 테이블이 파일 안에 있는지 (x86-64 ELF64 만)
+int check_elf(const char *file_buffer, size_t size)
+{
+    const Elf64_Ehdr *ehdr = (const Elf64_Ehdr *)file_buffer;
+
+    if (size < sizeof(Elf64_Ehdr) || memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0
+        || ehdr->e_ident[EI_CLASS] != ELFCLASS64 || ehdr->e_machine != EM_X86_64)
+        return FALSE;
+    if (ehdr->e_phentsize != sizeof(Elf64_Phdr) || ehdr->e_shentsize != sizeof(Elf64_Shdr)
+        || ehdr->e_phoff > size || ehdr->e_phnum > (size - ehdr->e_phoff) / sizeof(Elf64_Phdr)
+        || ehdr->e_shoff > size || ehdr->e_shnum > (size - ehdr->e_shoff) / sizeof(Elf64_Shdr)
+        || ehdr->e_shstrndx >= ehdr->e_shnum)
+        return FALSE;
+    const Elf64_Shdr *shdrs = (const Elf64_Shdr *)(file_buffer + ehdr->e_shoff);
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        if (shdrs[i].sh_type != SHT_NOBITS
+            && (shdrs[i].sh_offset > size || shdrs[i].sh_size > size - shdrs[i].sh_offset))
+            return FALSE;
+    }
+    return TRUE;
+}
 
 t_elf   parse_elf(char *file_buffer)
 {
@@ -45,16 +69,24 @@ t_elf   parse_elf(char *file_buffer)
     return elf;
 }
 
-int check_pt_note(t_elf elf)
+// 실행 가능한 PT_LOAD 안의 SHF_EXECINSTR section 들이 차지하는 범위
+// (segment 전체를 암호화하면 같은 segment 의 ELF 헤더, .dynsym 등을 ld.so 가 읽지 못함)
+int find_exec_range(t_elf elf, Elf64_Phdr *phdr, uint64_t *start, uint64_t *end)
 {
-    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+    *start = UINT64_MAX;
+    *end = 0;
+    for (int i = 0; i < elf.ehdr->e_shnum; i++)
     {
-        Elf64_Phdr *phdr = &elf.phdrs[i];
-        if (phdr->p_type == PT_NOTE)
-            return TRUE;
+        Elf64_Shdr *shdr = &elf.shdrs[i];
+        if (!(shdr->sh_flags & SHF_EXECINSTR) || shdr->sh_type == SHT_NOBITS || shdr->sh_size == 0)
+            continue;
+        if (shdr->sh_offset < phdr->p_offset
+            || shdr->sh_offset + shdr->sh_size > phdr->p_offset + phdr->p_filesz)
+            continue;
+        if (shdr->sh_offset < *start)
+            *start = shdr->sh_offset;
+        if (shdr->sh_offset + shdr->sh_size > *end)
+            *end = shdr->sh_offset + shdr->sh_size;
     }
-
-    print_debug("No PT_NOTE segment found.\n");
-
-    return FALSE;
-}
\ No newline at end of file
+    return *start < *end;
+}
@@ -10,34 +10,90 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "main.h"
 #include "file.h"
 #include "print_utils.h"
+#include <errno.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-size_t read_file(const char *filename, char **file_buffer)
+// read() 는 요청보다 적게 읽을 수 있고 한 번에 2GB 이상 읽지 못하므로 끝까지 반복
+static int read_all(int fd, char *buffer, size_t size)
 {
-    assert(filename != NULL);
-    // open file
-    int fd = open(filename, O_RDWR);
-    if (fd < 0) 
-        return print_error(FILE_NOT_FOUND, ERRNO_TRUE) & 0x0;
-    
+    size_t total = 0;
+
+    while (total < size)
+    {
+        size_t  chunk = size - total;
+        if (chunk > READ_CHUNK_SIZE)
+            chunk = READ_CHUNK_SIZE;
+
+        ssize_t read_bytes = pread(fd, buffer + total, chunk, (off_t)total);
+        if (read_bytes < 0 && errno == EINTR)
+            continue;
+        if (read_bytes <= 0)
+            return FALSE;
+        total += (size_t)read_bytes;
+    }
+    return TRUE;
+}
+
+int open_file(const char *filename, t_file *file)
+{
+    assert(filename != NULL && file != NULL);
+    *file = (t_file){ .fd = -1 };
+
+    // open file (원본은 절대 수정하지 않으므로 읽기 전용)
+    file->fd = open(filename, O_RDONLY);
+    if (file->fd < 0)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+
     // get file size
-    size_t file_size = lseek(fd, 0, SEEK_END);
-    print_debug("file [%s] size : %llu\n", filename, (unsigned long long)file_size);
+    struct stat st;
+    if (fstat(file->fd, &st) < 0 || st.st_size <= 0 || (uint64_t)st.st_size > SIZE_MAX)
+    {
+        close_file(file);
+        return print_error(INVALID_ELF, ERRNO_FALSE);
+    }
+    file->size = (size_t)st.st_size;
+    print_debug("file [%s] size : %llu\n", filename, (unsigned long long)file->size);
 
-    *file_buffer = malloc(file_size);
-    if (!*file_buffer)
-        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE) & 0x0;
+    // 헤더 수정은 MAP_PRIVATE 의 copy-on-write 로 처리되어 수정한 페이지만 복사됨
+    void *view = mmap(NULL, file->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file->fd, 0);
+    if (view != MAP_FAILED)
+    {
+        file->buffer = view;
+        file->mapped = TRUE;
+        return 0;
+    }
+    print_debug("mmap failed, falling back to read\n");
 
-    lseek(fd, 0, SEEK_SET);
-    // read file
-    ssize_t read_bytes = read(fd, *file_buffer, file_size);
-    if (read_bytes > 0 && (size_t)read_bytes != file_size)
+    // mmap 이 불가능한 파일 (procfs 등) 은 malloc + read
+    file->buffer = malloc(file->size);
+    if (!file->buffer)
+    {
+        close_file(file);
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    }
+    if (read_all(file->fd, file->buffer, file->size) == FALSE)
     {
-        free(*file_buffer);
-        return print_error(FILE_NOT_FOUND, ERRNO_TRUE) & 0x0;
+        close_file(file);
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
     }
+    return 0;
+}
 
-    close(fd);
-    return file_size;
+void close_file(t_file *file)
+{
+    if (file->buffer)
+    {
+        if (file->mapped)
+            munmap(file->buffer, file->size);
+        else
+            free(file->buffer);
+    }
+    if (file->fd >= 0)
+        close(file->fd);
+    *file = (t_file){ .fd = -1 };
 }
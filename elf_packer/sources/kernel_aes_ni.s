@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_aes_ni.s                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/03 15:21:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+; AES-CTR 복호화 kernel: AES-NI (xmm), 8 block (128 bytes) 씩 AESENC 를 겹쳐서 파이프라인을 채움
+[BITS 64]
+
+%include "stub.inc"
+
+; counter block = nonce (12 bytes) || big endian counter 를 %1 에 만듦
+; %1 = xmm, %2 = r8d 에 더할 block 번호
+%macro CTR_BLOCK 2
+    movdqa %1, xmm15
+    lea eax, [r8 + %2]
+    bswap eax
+    pinsrd %1, eax, 3
+%endmacro
+
+%macro AES_ROUND8 2
+    %1 xmm0, %2
+    %1 xmm1, %2
+    %1 xmm2, %2
+    %1 xmm3, %2
+    %1 xmm4, %2
+    %1 xmm5, %2
+    %1 xmm6, %2
+    %1 xmm7, %2
+%endmacro
+
+aes_ni:
+    test rsi, rsi
+    jz .ret
+    mov r8d, edx                        ; r8d = counter
+    mov r9d, [rcx + P_AES_ROUNDS]       ; r9d = Nr (10 / 14)
+    lea r11, [rcx + P_ROUND_KEYS]
+    movdqu xmm15, [rcx + P_NONCE]
+    pshufd xmm15, xmm15, 0x39           ; (n1, n2, n3, 0): 마지막 dword 가 counter 자리
+
+.eight:
+    cmp rsi, 128
+    jb .single
+    CTR_BLOCK xmm0, 0
+    CTR_BLOCK xmm1, 1
+    CTR_BLOCK xmm2, 2
+    CTR_BLOCK xmm3, 3
+    CTR_BLOCK xmm4, 4
+    CTR_BLOCK xmm5, 5
+    CTR_BLOCK xmm6, 6
+    CTR_BLOCK xmm7, 7
+    mov r10, r11
+    movdqu xmm8, [r10]
+    AES_ROUND8 pxor, xmm8
+    mov ecx, r9d
+    dec ecx
+.eight_round:
+    add r10, 16
+    movdqu xmm8, [r10]
+    AES_ROUND8 aesenc, xmm8
+    dec ecx
+    jnz .eight_round
+    movdqu xmm8, [r10 + 16]
+    AES_ROUND8 aesenclast, xmm8
+
+    movdqu xmm8, [rdi]
+    pxor xmm0, xmm8
+    movdqu [rdi], xmm0
+    movdqu xmm8, [rdi + 16]
+    pxor xmm1, xmm8
+    movdqu [rdi + 16], xmm1
+    movdqu xmm8, [rdi + 32]
+    pxor xmm2, xmm8
+    movdqu [rdi + 32], xmm2
+    movdqu xmm8, [rdi + 48]
+    pxor xmm3, xmm8
+    movdqu [rdi + 48], xmm3
+    movdqu xmm8, [rdi + 64]
+    pxor xmm4, xmm8
+    movdqu [rdi + 64], xmm4
+    movdqu xmm8, [rdi + 80]
+    pxor xmm5, xmm8
+    movdqu [rdi + 80], xmm5
+    movdqu xmm8, [rdi + 96]
+    pxor xmm6, xmm8
+    movdqu [rdi + 96], xmm6
+    movdqu xmm8, [rdi + 112]
+    pxor xmm7, xmm8
+    movdqu [rdi + 112], xmm7
+
+    add r8d, 8
+    add rdi, 128
+    sub rsi, 128
+    jmp .eight
+
+    ; 남은 block 을 하나씩
+.single:
+    test rsi, rsi
+    jz .ret
+    CTR_BLOCK xmm0, 0
+    mov r10, r11
+    movdqu xmm8, [r10]
+    pxor xmm0, xmm8
+    mov ecx, r9d
+    dec ecx
+.single_round:
+    add r10, 16
+    movdqu xmm8, [r10]
+    aesenc xmm0, xmm8
+    dec ecx
+    jnz .single_round
+    movdqu xmm8, [r10 + 16]
+    aesenclast xmm0, xmm8
+
+    sub rsp, 16
+    movdqu [rsp], xmm0
+    xor ecx, ecx
+.single_byte:
+    mov al, [rsp + rcx]
+    xor [rdi + rcx], al
+    inc rcx
+    cmp rcx, rsi
+    jae .single_done
+    cmp rcx, 16
+    jb .single_byte
+.single_done:
+    add rsp, 16
+    add rdi, rcx
+    sub rsi, rcx
+    inc r8d
+    jmp .single
+.ret:
+    ret
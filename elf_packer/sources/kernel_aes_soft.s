@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_aes_soft.s                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/03 15:21:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+; AES-CTR 복호화 kernel: AES-NI 가 없는 CPU 용 scalar (SSE2 만 사용)
+; aes.c 의 aes_encrypt_soft 와 같은 순서로 한 block 씩 처리
+[BITS 64]
+
+%include "stub.inc"
+
+aes_soft:
+    test rsi, rsi
+    jz .ret
+    push rbx
+    push r15
+    sub rsp, 48                         ; [rsp] = counter block / keystream
+    mov r8d, edx                        ; r8d = counter
+    mov r9d, [rcx + P_AES_ROUNDS]
+    lea r11, [rcx + P_ROUND_KEYS]
+    mov rax, [rcx + P_NONCE + 4]        ; nonce 12 bytes
+    mov [rsp + 32], rax
+    mov eax, [rcx + P_NONCE + 12]
+    mov [rsp + 40], eax
+
+.block:
+    movdqu xmm0, [rsp + 32]
+    movdqu [rsp], xmm0
+    mov eax, r8d
+    bswap eax
+    mov [rsp + 12], eax                 ; big endian counter
+    movdqu xmm0, [rsp]
+    call aes_block_soft
+    movdqu [rsp], xmm0
+
+    xor ecx, ecx
+.xor_byte:
+    mov al, [rsp + rcx]
+    xor [rdi + rcx], al
+    inc rcx
+    cmp rcx, rsi
+    jae .block_done
+    cmp rcx, 16
+    jb .xor_byte
+.block_done:
+    add rdi, rcx
+    sub rsi, rcx
+    inc r8d
+    test rsi, rsi
+    jnz .block
+
+    add rsp, 48
+    pop r15
+    pop rbx
+.ret:
+    ret
+
+; in/out: xmm0 = block, r9d = Nr, r11 = round keys
+; clobbers rax, rbx, rcx, rdx, r10, r15, xmm8
+aes_block_soft:
+    push rsi
+    push rdi
+    push r8
+    sub rsp, 32                         ; [rsp] = state, [rsp + 16] = SubBytes + ShiftRows 결과
+    lea rbx, [rel sbox]
+    lea r15, [rel shift_rows]
+    mov r10, r11
+    mov edx, r9d
+    movdqu xmm8, [r10]
+    pxor xmm0, xmm8
+    movdqu [rsp], xmm0
+
+.round:
+    xor ecx, ecx
+.sub_shift:
+    movzx eax, byte [r15 + rcx]
+    movzx eax, byte [rsp + rax]
+    mov al, [rbx + rax]
+    mov [rsp + 16 + rcx], al
+    inc ecx
+    cmp ecx, 16
+    jb .sub_shift
+    add r10, 16
+    dec edx
+    jz .last
+
+    ; MixColumns: column w = (a0, a1, a2, a3)
+    ; b = w ^ t ^ xtime(w ^ ror8(w)), t = 모든 byte 가 a0 ^ a1 ^ a2 ^ a3
+    xor ecx, ecx
+.mix:
+    mov eax, [rsp + 16 + rcx * 4]
+    mov esi, eax
+    ror esi, 8
+    xor esi, eax                        ; u = (a0^a1, a1^a2, a2^a3, a3^a0)
+    mov edi, esi
+    ror edi, 16
+    xor edi, esi                        ; t
+    mov r8d, esi
+    and r8d, 0x80808080
+    shr r8d, 7
+    imul r8d, r8d, 0x1b
+    and esi, 0x7f7f7f7f
+    add esi, esi
+    xor esi, r8d                        ; xtime(u)
+    xor eax, edi
+    xor eax, esi
+    mov [rsp + rcx * 4], eax
+    inc ecx
+    cmp ecx, 4
+    jb .mix
+
+    movdqu xmm0, [rsp]
+    movdqu xmm8, [r10]
+    pxor xmm0, xmm8
+    movdqu [rsp], xmm0
+    jmp .round
+
+.last:
+    movdqu xmm0, [rsp + 16]
+    movdqu xmm8, [r10]
+    pxor xmm0, xmm8
+    add rsp, 32
+    pop r8
+    pop rdi
+    pop rsi
+    ret
+
+shift_rows: db 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11
+sbox:
+    db 0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76
+    db 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0
+    db 0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15
+    db 0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75
+    db 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84
+    db 0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf
+    db 0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8
+    db 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2
+    db 0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73
+    db 0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb
+    db 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79
+    db 0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08
+    db 0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a
+    db 0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e
+    db 0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf
+    db 0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
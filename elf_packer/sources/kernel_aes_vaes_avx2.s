@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_aes_vaes_avx2.s                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/03 15:21:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+; AES-CTR 복호화 kernel: VAES + AVX2
+; ymm 하나에 counter block 2 개, 8 개를 겹쳐서 256 bytes (16 block) 씩 처리
+[BITS 64]
+
+%include "stub.inc"
+
+%macro AES_ROUND8 2
+    %1 ymm0, ymm0, %2
+    %1 ymm1, ymm1, %2
+    %1 ymm2, ymm2, %2
+    %1 ymm3, ymm3, %2
+    %1 ymm4, ymm4, %2
+    %1 ymm5, ymm5, %2
+    %1 ymm6, ymm6, %2
+    %1 ymm7, ymm7, %2
+%endmacro
+
+aes_vaes_avx2:
+    test rsi, rsi
+    jz .ret
+    mov r8d, [rcx + P_AES_ROUNDS]
+    lea r11, [rcx + P_ROUND_KEYS]
+
+    ; counter 는 little endian 으로 더하고 vpshufb 로 마지막 dword 만 big endian 으로 바꿈
+    vpshufd xmm15, [rcx + P_NONCE], 0x39    ; (n1, n2, n3, 0)
+    vmovd xmm12, edx
+    vpslldq xmm12, xmm12, 12
+    vpaddd xmm15, xmm15, xmm12
+    vpermq ymm15, ymm15, 0x44
+    vpaddd ymm15, ymm15, [rel lane_inc]
+    vbroadcasti128 ymm14, [rel ctr_step]
+    vbroadcasti128 ymm13, [rel bswap_ctr]
+
+.block:
+    vpshufb ymm0, ymm15, ymm13
+    vpaddd ymm15, ymm15, ymm14
+    vpshufb ymm1, ymm15, ymm13
+    vpaddd ymm15, ymm15, ymm14
+    vpshufb ymm2, ymm15, ymm13
+    vpaddd ymm15, ymm15, ymm14
+    vpshufb ymm3, ymm15, ymm13
+    vpaddd ymm15, ymm15, ymm14
+    vpshufb ymm4, ymm15, ymm13
+    vpaddd ymm15, ymm15, ymm14
+    vpshufb ymm5, ymm15, ymm13
+    vpaddd ymm15, ymm15, ymm14
+    vpshufb ymm6, ymm15, ymm13
+    vpaddd ymm15, ymm15, ymm14
+    vpshufb ymm7, ymm15, ymm13
+    vpaddd ymm15, ymm15, ymm14
+    mov r10, r11
+    vbroadcasti128 ymm12, [r10]
+    AES_ROUND8 vpxor, ymm12
+    mov ecx, r8d
+    dec ecx
+.round:
+    add r10, 16
+    vbroadcasti128 ymm12, [r10]
+    AES_ROUND8 vaesenc, ymm12
+    dec ecx
+    jnz .round
+    vbroadcasti128 ymm12, [r10 + 16]
+    AES_ROUND8 vaesenclast, ymm12
+
+    ; 256 bytes 미만이면 0 으로 채운 stack 에 keystream 을 받아서 byte 단위로 xor
+    mov r9, rdi
+    cmp rsi, 256
+    jae .xor
+    sub rsp, 256
+    mov r9, rsp
+    vpxor ymm12, ymm12, ymm12
+    vmovdqu [rsp + 0], ymm12
+    vmovdqu [rsp + 32], ymm12
+    vmovdqu [rsp + 64], ymm12
+    vmovdqu [rsp + 96], ymm12
+    vmovdqu [rsp + 128], ymm12
+    vmovdqu [rsp + 160], ymm12
+    vmovdqu [rsp + 192], ymm12
+    vmovdqu [rsp + 224], ymm12
+
+.xor:
+    vpxor ymm0, ymm0, [r9 + 0]
+    vmovdqu [r9 + 0], ymm0
+    vpxor ymm1, ymm1, [r9 + 32]
+    vmovdqu [r9 + 32], ymm1
+    vpxor ymm2, ymm2, [r9 + 64]
+    vmovdqu [r9 + 64], ymm2
+    vpxor ymm3, ymm3, [r9 + 96]
+    vmovdqu [r9 + 96], ymm3
+    vpxor ymm4, ymm4, [r9 + 128]
+    vmovdqu [r9 + 128], ymm4
+    vpxor ymm5, ymm5, [r9 + 160]
+    vmovdqu [r9 + 160], ymm5
+    vpxor ymm6, ymm6, [r9 + 192]
+    vmovdqu [r9 + 192], ymm6
+    vpxor ymm7, ymm7, [r9 + 224]
+    vmovdqu [r9 + 224], ymm7
+    cmp r9, rdi
+    jne .tail
+    add rdi, 256
+    sub rsi, 256
+    jnz .block
+    jmp .ret
+
+.tail:
+    xor ecx, ecx
+.tail_byte:
+    mov al, [rsp + rcx]
+    xor [rdi + rcx], al
+    inc rcx
+    cmp rcx, rsi
+    jb .tail_byte
+    add rsp, 256
+.ret:
+    vzeroupper
+    ret
+
+align 32
+lane_inc: dd 0, 0, 0, 0, 0, 0, 0, 1
+ctr_step: dd 0, 0, 0, 2
+bswap_ctr: db 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 14, 13, 12
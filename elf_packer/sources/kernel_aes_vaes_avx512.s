@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_aes_vaes_avx512.s                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/03 15:21:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+; AES-CTR 복호화 kernel: VAES + AVX-512
+; zmm 하나에 counter block 4 개, 8 개를 겹쳐서 512 bytes (32 block) 씩 처리
+[BITS 64]
+
+%include "stub.inc"
+
+%macro AES_ROUND8 2
+    %1 zmm0, zmm0, %2
+    %1 zmm1, zmm1, %2
+    %1 zmm2, zmm2, %2
+    %1 zmm3, zmm3, %2
+    %1 zmm4, zmm4, %2
+    %1 zmm5, zmm5, %2
+    %1 zmm6, zmm6, %2
+    %1 zmm7, zmm7, %2
+%endmacro
+
+aes_vaes_avx512:
+    test rsi, rsi
+    jz .ret
+    mov r8d, [rcx + P_AES_ROUNDS]
+    lea r11, [rcx + P_ROUND_KEYS]
+
+    ; counter 는 little endian 으로 더하고 vpshufb 로 마지막 dword 만 big endian 으로 바꿈
+    vpshufd xmm15, [rcx + P_NONCE], 0x39    ; (n1, n2, n3, 0)
+    vmovd xmm12, edx
+    vpslldq xmm12, xmm12, 12
+    vpaddd xmm15, xmm15, xmm12
+    vshufi32x4 zmm15, zmm15, zmm15, 0x00
+    vpaddd zmm15, zmm15, [rel lane_inc]
+    vbroadcasti32x4 zmm14, [rel ctr_step]
+    vbroadcasti32x4 zmm13, [rel bswap_ctr]
+
+.block:
+    vpshufb zmm0, zmm15, zmm13
+    vpaddd zmm15, zmm15, zmm14
+    vpshufb zmm1, zmm15, zmm13
+    vpaddd zmm15, zmm15, zmm14
+    vpshufb zmm2, zmm15, zmm13
+    vpaddd zmm15, zmm15, zmm14
+    vpshufb zmm3, zmm15, zmm13
+    vpaddd zmm15, zmm15, zmm14
+    vpshufb zmm4, zmm15, zmm13
+    vpaddd zmm15, zmm15, zmm14
+    vpshufb zmm5, zmm15, zmm13
+    vpaddd zmm15, zmm15, zmm14
+    vpshufb zmm6, zmm15, zmm13
+    vpaddd zmm15, zmm15, zmm14
+    vpshufb zmm7, zmm15, zmm13
+    vpaddd zmm15, zmm15, zmm14
+    mov r10, r11
+    vbroadcasti32x4 zmm12, [r10]
+    AES_ROUND8 vpxord, zmm12
+    mov ecx, r8d
+    dec ecx
+.round:
+    add r10, 16
+    vbroadcasti32x4 zmm12, [r10]
+    AES_ROUND8 vaesenc, zmm12
+    dec ecx
+    jnz .round
+    vbroadcasti32x4 zmm12, [r10 + 16]
+    AES_ROUND8 vaesenclast, zmm12
+
+    ; 512 bytes 미만이면 0 으로 채운 stack 에 keystream 을 받아서 byte 단위로 xor
+    mov r9, rdi
+    cmp rsi, 512
+    jae .xor
+    sub rsp, 512
+    mov r9, rsp
+    vpxord zmm12, zmm12, zmm12
+    vmovdqu32 [rsp + 0], zmm12
+    vmovdqu32 [rsp + 64], zmm12
+    vmovdqu32 [rsp + 128], zmm12
+    vmovdqu32 [rsp + 192], zmm12
+    vmovdqu32 [rsp + 256], zmm12
+    vmovdqu32 [rsp + 320], zmm12
+    vmovdqu32 [rsp + 384], zmm12
+    vmovdqu32 [rsp + 448], zmm12
+
+.xor:
+    vpxord zmm0, zmm0, [r9 + 0]
+    vmovdqu32 [r9 + 0], zmm0
+    vpxord zmm1, zmm1, [r9 + 64]
+    vmovdqu32 [r9 + 64], zmm1
+    vpxord zmm2, zmm2, [r9 + 128]
+    vmovdqu32 [r9 + 128], zmm2
+    vpxord zmm3, zmm3, [r9 + 192]
+    vmovdqu32 [r9 + 192], zmm3
+    vpxord zmm4, zmm4, [r9 + 256]
+    vmovdqu32 [r9 + 256], zmm4
+    vpxord zmm5, zmm5, [r9 + 320]
+    vmovdqu32 [r9 + 320], zmm5
+    vpxord zmm6, zmm6, [r9 + 384]
+    vmovdqu32 [r9 + 384], zmm6
+    vpxord zmm7, zmm7, [r9 + 448]
+    vmovdqu32 [r9 + 448], zmm7
+    cmp r9, rdi
+    jne .tail
+    add rdi, 512
+    sub rsi, 512
+    jnz .block
+    jmp .ret
+
+.tail:
+    xor ecx, ecx
+.tail_byte:
+    mov al, [rsp + rcx]
+    xor [rdi + rcx], al
+    inc rcx
+    cmp rcx, rsi
+    jb .tail_byte
+    add rsp, 512
+.ret:
+    vzeroupper
+    ret
+
+align 64
+lane_inc: dd 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 3
+ctr_step: dd 0, 0, 0, 4
+bswap_ctr: db 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 14, 13, 12
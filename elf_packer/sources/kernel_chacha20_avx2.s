@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_chacha20_avx2.s                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/03 15:21:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+; ChaCha20 복호화 kernel: AVX2
+; ymm 하나에 두 block 의 같은 row 를 (128bit lane 마다 한 block) 넣고 두 쌍을 겹쳐서
+; 256 bytes (4 block) 씩 처리. rotl 16 / 8 은 vpshufb 한 번
+[BITS 64]
+
+%include "stub.inc"
+
+; %1..%4 = row a, b, c, d / %5 = temp
+%macro QROUND 5
+    vpaddd %1, %1, %2
+    vpxor %4, %4, %1
+    vpshufb %4, %4, ymm14
+    vpaddd %3, %3, %4
+    vpxor %2, %2, %3
+    vpsrld %5, %2, 20
+    vpslld %2, %2, 12
+    vpor %2, %2, %5
+    vpaddd %1, %1, %2
+    vpxor %4, %4, %1
+    vpshufb %4, %4, ymm15
+    vpaddd %3, %3, %4
+    vpxor %2, %2, %3
+    vpsrld %5, %2, 25
+    vpslld %2, %2, 7
+    vpor %2, %2, %5
+%endmacro
+
+%macro DIAGONAL 5
+    vpshufd %1, %1, %4
+    vpshufd %2, %2, 0x4e
+    vpshufd %3, %3, %5
+%endmacro
+
+; 한 쌍 (a, b, c, d) 의 keystream 128 bytes 를 [r9 + %5] 에 xor
+; lane 0 이 앞 block, lane 1 이 뒤 block 이므로 vperm2i128 로 block 순서로 다시 묶음
+%macro XOR_PAIR 5
+    vperm2i128 ymm12, %1, %2, 0x20
+    vpxor ymm12, ymm12, [r9 + %5]
+    vmovdqu [r9 + %5], ymm12
+    vperm2i128 ymm12, %3, %4, 0x20
+    vpxor ymm12, ymm12, [r9 + %5 + 32]
+    vmovdqu [r9 + %5 + 32], ymm12
+    vperm2i128 ymm12, %1, %2, 0x31
+    vpxor ymm12, ymm12, [r9 + %5 + 64]
+    vmovdqu [r9 + %5 + 64], ymm12
+    vperm2i128 ymm12, %3, %4, 0x31
+    vpxor ymm12, ymm12, [r9 + %5 + 96]
+    vmovdqu [r9 + %5 + 96], ymm12
+%endmacro
+
+chacha20_avx2:
+    test rsi, rsi
+    jz .ret
+    vbroadcasti128 ymm8, [rel sigma]
+    vbroadcasti128 ymm9, [rcx + P_KEY]
+    vbroadcasti128 ymm10, [rcx + P_KEY + 16]
+    vbroadcasti128 ymm11, [rcx + P_NONCE]
+    vmovd xmm12, edx
+    vpermq ymm12, ymm12, 0x44
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm11, ymm11, [rel lane_inc] ; row d = (counter | counter + 1)
+    vmovdqu ymm14, [rel rot16]
+    vmovdqu ymm15, [rel rot8]
+
+.block:
+    vmovdqa ymm0, ymm8
+    vmovdqa ymm1, ymm9
+    vmovdqa ymm2, ymm10
+    vmovdqa ymm3, ymm11
+    vmovdqa ymm4, ymm8
+    vmovdqa ymm5, ymm9
+    vmovdqa ymm6, ymm10
+    vpaddd ymm7, ymm11, [rel inc2]      ; 두 번째 쌍은 counter + 2, + 3
+    mov ecx, 10
+
+.round:
+    QROUND ymm0, ymm1, ymm2, ymm3, ymm12
+    QROUND ymm4, ymm5, ymm6, ymm7, ymm13
+    DIAGONAL ymm1, ymm2, ymm3, 0x39, 0x93
+    DIAGONAL ymm5, ymm6, ymm7, 0x39, 0x93
+    QROUND ymm0, ymm1, ymm2, ymm3, ymm12
+    QROUND ymm4, ymm5, ymm6, ymm7, ymm13
+    DIAGONAL ymm1, ymm2, ymm3, 0x93, 0x39
+    DIAGONAL ymm5, ymm6, ymm7, 0x93, 0x39
+    dec ecx
+    jnz .round
+
+    vpaddd ymm0, ymm0, ymm8
+    vpaddd ymm1, ymm1, ymm9
+    vpaddd ymm2, ymm2, ymm10
+    vpaddd ymm3, ymm3, ymm11
+    vpaddd ymm4, ymm4, ymm8
+    vpaddd ymm5, ymm5, ymm9
+    vpaddd ymm6, ymm6, ymm10
+    vpaddd ymm7, ymm7, ymm11
+    vpaddd ymm7, ymm7, [rel inc2]
+
+    ; 256 bytes 미만이면 0 으로 채운 stack 에 keystream 을 받아서 byte 단위로 xor
+    mov r9, rdi
+    cmp rsi, 256
+    jae .xor
+    sub rsp, 256
+    mov r9, rsp
+    vpxor ymm12, ymm12, ymm12
+%assign i 0
+%rep 8
+    vmovdqu [rsp + i], ymm12
+%assign i i + 32
+%endrep
+
+.xor:
+    XOR_PAIR ymm0, ymm1, ymm2, ymm3, 0
+    XOR_PAIR ymm4, ymm5, ymm6, ymm7, 128
+    cmp r9, rdi
+    jne .tail
+
+    vpaddd ymm11, ymm11, [rel inc4]
+    add rdi, 256
+    sub rsi, 256
+    jnz .block
+    jmp .ret
+
+.tail:
+    xor ecx, ecx
+.tail_byte:
+    mov al, [rsp + rcx]
+    xor [rdi + rcx], al
+    inc rcx
+    cmp rcx, rsi
+    jb .tail_byte
+    add rsp, 256
+.ret:
+    vzeroupper
+    ret
+
+align 32
+rot16: db 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13
+       db 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13
+rot8: db 3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14
+      db 3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14
+lane_inc: dd 0, 0, 0, 0, 1, 0, 0, 0
+inc2: dd 2, 0, 0, 0, 2, 0, 0, 0
+inc4: dd 4, 0, 0, 0, 4, 0, 0, 0
+sigma: db "expand 32-byte k"
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_chacha20_avx512.s                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/03 15:21:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+; ChaCha20 복호화 kernel: AVX-512
+; zmm 하나에 네 block 의 같은 row 를 넣고 두 묶음을 겹쳐서 512 bytes (8 block) 씩 처리
+; rotate 는 vprold 한 번
+[BITS 64]
+
+%include "stub.inc"
+
+%macro QROUND 4
+    vpaddd %1, %1, %2
+    vpxord %4, %4, %1
+    vprold %4, %4, 16
+    vpaddd %3, %3, %4
+    vpxord %2, %2, %3
+    vprold %2, %2, 12
+    vpaddd %1, %1, %2
+    vpxord %4, %4, %1
+    vprold %4, %4, 8
+    vpaddd %3, %3, %4
+    vpxord %2, %2, %3
+    vprold %2, %2, 7
+%endmacro
+
+%macro DIAGONAL 5
+    vpshufd %1, %1, %4
+    vpshufd %2, %2, 0x4e
+    vpshufd %3, %3, %5
+%endmacro
+
+; 네 block 묶음 (a, b, c, d) 의 keystream 256 bytes 를 [r9 + %5] 에 xor
+; 128bit lane 4x4 전치로 block 순서 (a0 b0 c0 d0)(a1 b1 c1 d1)... 로 다시 묶음
+%macro XOR_QUAD 5
+    vshufi32x4 zmm12, %1, %2, 0x44      ; a0 a1 b0 b1
+    vshufi32x4 zmm13, %3, %4, 0x44      ; c0 c1 d0 d1
+    vshufi32x4 zmm14, %1, %2, 0xee      ; a2 a3 b2 b3
+    vshufi32x4 zmm15, %3, %4, 0xee      ; c2 c3 d2 d3
+    vshufi32x4 %1, zmm12, zmm13, 0x88
+    vshufi32x4 %2, zmm12, zmm13, 0xdd
+    vshufi32x4 %3, zmm14, zmm15, 0x88
+    vshufi32x4 %4, zmm14, zmm15, 0xdd
+    vpxord %1, %1, [r9 + %5]
+    vmovdqu32 [r9 + %5], %1
+    vpxord %2, %2, [r9 + %5 + 64]
+    vmovdqu32 [r9 + %5 + 64], %2
+    vpxord %3, %3, [r9 + %5 + 128]
+    vmovdqu32 [r9 + %5 + 128], %3
+    vpxord %4, %4, [r9 + %5 + 192]
+    vmovdqu32 [r9 + %5 + 192], %4
+%endmacro
+
+chacha20_avx512:
+    test rsi, rsi
+    jz .ret
+    vbroadcasti32x4 zmm8, [rel sigma]
+    vbroadcasti32x4 zmm9, [rcx + P_KEY]
+    vbroadcasti32x4 zmm10, [rcx + P_KEY + 16]
+    vbroadcasti32x4 zmm11, [rcx + P_NONCE]
+    vmovd xmm12, edx
+    vshufi32x4 zmm12, zmm12, zmm12, 0x00
+    vpaddd zmm11, zmm11, zmm12
+    vpaddd zmm11, zmm11, [rel lane_inc] ; row d = (counter .. counter + 3)
+
+.block:
+    vmovdqa32 zmm0, zmm8
+    vmovdqa32 zmm1, zmm9
+    vmovdqa32 zmm2, zmm10
+    vmovdqa32 zmm3, zmm11
+    vmovdqa32 zmm4, zmm8
+    vmovdqa32 zmm5, zmm9
+    vmovdqa32 zmm6, zmm10
+    vpaddd zmm7, zmm11, [rel inc4]      ; 두 번째 묶음은 counter + 4 .. + 7
+    mov ecx, 10
+
+.round:
+    QROUND zmm0, zmm1, zmm2, zmm3
+    QROUND zmm4, zmm5, zmm6, zmm7
+    DIAGONAL zmm1, zmm2, zmm3, 0x39, 0x93
+    DIAGONAL zmm5, zmm6, zmm7, 0x39, 0x93
+    QROUND zmm0, zmm1, zmm2, zmm3
+    QROUND zmm4, zmm5, zmm6, zmm7
+    DIAGONAL zmm1, zmm2, zmm3, 0x93, 0x39
+    DIAGONAL zmm5, zmm6, zmm7, 0x93, 0x39
+    dec ecx
+    jnz .round
+
+    vpaddd zmm0, zmm0, zmm8
+    vpaddd zmm1, zmm1, zmm9
+    vpaddd zmm2, zmm2, zmm10
+    vpaddd zmm3, zmm3, zmm11
+    vpaddd zmm4, zmm4, zmm8
+    vpaddd zmm5, zmm5, zmm9
+    vpaddd zmm6, zmm6, zmm10
+    vpaddd zmm7, zmm7, zmm11
+    vpaddd zmm7, zmm7, [rel inc4]
+
+    ; 512 bytes 미만이면 0 으로 채운 stack 에 keystream 을 받아서 byte 단위로 xor
+    mov r9, rdi
+    cmp rsi, 512
+    jae .xor
+    sub rsp, 512
+    mov r9, rsp
+    vpxord zmm12, zmm12, zmm12
+%assign i 0
+%rep 8
+    vmovdqu32 [rsp + i], zmm12
+%assign i i + 64
+%endrep
+
+.xor:
+    XOR_QUAD zmm0, zmm1, zmm2, zmm3, 0
+    XOR_QUAD zmm4, zmm5, zmm6, zmm7, 256
+    cmp r9, rdi
+    jne .tail
+
+    vpaddd zmm11, zmm11, [rel inc8]
+    add rdi, 512
+    sub rsi, 512
+    jnz .block
+    jmp .ret
+
+.tail:
+    xor ecx, ecx
+.tail_byte:
+    mov al, [rsp + rcx]
+    xor [rdi + rcx], al
+    inc rcx
+    cmp rcx, rsi
+    jb .tail_byte
+    add rsp, 512
+.ret:
+    vzeroupper
+    ret
+
+align 64
+lane_inc: dd 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0
+inc4: dd 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0
+inc8: dd 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0
+sigma: db "expand 32-byte k"
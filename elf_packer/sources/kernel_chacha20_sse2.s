@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_chacha20_sse2.s                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/03 15:21:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+; ChaCha20 복호화 kernel: SSE2 (모든 x86-64 에서 동작하는 기본값)
+[BITS 64]
+
+%include "stub.inc"
+
+; ChaCha20 quarter round, 한 block 의 4 column (또는 diagonal) 을 SSE2 로 동시에 처리
+; %1..%4 = row a, b, c, d / %5 = temp
+%macro QROUND 5
+    paddd %1, %2
+    pxor %4, %1
+    pshuflw %4, %4, 0xb1        ; rotl 16 = 16bit 반 교환
+    pshufhw %4, %4, 0xb1
+    paddd %3, %4
+    pxor %2, %3
+    movdqa %5, %2
+    pslld %2, 12
+    psrld %5, 20
+    por %2, %5
+    paddd %1, %2
+    pxor %4, %1
+    movdqa %5, %4
+    pslld %4, 8
+    psrld %5, 24
+    por %4, %5
+    paddd %3, %4
+    pxor %2, %3
+    movdqa %5, %2
+    pslld %2, 7
+    psrld %5, 25
+    por %2, %5
+%endmacro
+
+; diagonal round 을 위해 row b, c, d 를 1, 2, 3 word 회전 (되돌릴 때는 %4, %5 를 바꿔서)
+%macro DIAGONAL 5
+    pshufd %1, %1, %4
+    pshufd %2, %2, 0x4e
+    pshufd %3, %3, %5
+%endmacro
+
+; 128 bytes (2 block) 씩 keystream 을 만들어 바로 xor, 남는 꼬리는 stack 에서 처리
+chacha20_sse2:
+    test rsi, rsi
+    jz .ret
+    movdqu xmm8, [rel sigma]
+    movdqu xmm9, [rcx + P_KEY]
+    movdqu xmm10, [rcx + P_KEY + 16]
+    movdqu xmm11, [rcx + P_NONCE]
+    movd xmm12, edx
+    paddd xmm11, xmm12          ; row d = counter | nonce
+    movdqu xmm14, [rel one]
+    movdqu xmm15, [rel two]
+
+.block:
+    movdqa xmm0, xmm8
+    movdqa xmm1, xmm9
+    movdqa xmm2, xmm10
+    movdqa xmm3, xmm11
+    movdqa xmm4, xmm8
+    movdqa xmm5, xmm9
+    movdqa xmm6, xmm10
+    movdqa xmm7, xmm11
+    paddd xmm7, xmm14           ; 두 번째 block 은 counter + 1
+    mov ecx, 10
+
+.round:
+    QROUND xmm0, xmm1, xmm2, xmm3, xmm12
+    QROUND xmm4, xmm5, xmm6, xmm7, xmm13
+    DIAGONAL xmm1, xmm2, xmm3, 0x39, 0x93
+    DIAGONAL xmm5, xmm6, xmm7, 0x39, 0x93
+    QROUND xmm0, xmm1, xmm2, xmm3, xmm12
+    QROUND xmm4, xmm5, xmm6, xmm7, xmm13
+    DIAGONAL xmm1, xmm2, xmm3, 0x93, 0x39
+    DIAGONAL xmm5, xmm6, xmm7, 0x93, 0x39
+    dec ecx
+    jnz .round
+
+    paddd xmm0, xmm8
+    paddd xmm1, xmm9
+    paddd xmm2, xmm10
+    paddd xmm3, xmm11
+    paddd xmm4, xmm8
+    paddd xmm5, xmm9
+    paddd xmm6, xmm10
+    paddd xmm7, xmm11
+    paddd xmm7, xmm14
+
+    cmp rsi, 128
+    jb .tail
+
+    movdqu xmm12, [rdi]
+    pxor xmm0, xmm12
+    movdqu [rdi], xmm0
+    movdqu xmm12, [rdi + 16]
+    pxor xmm1, xmm12
+    movdqu [rdi + 16], xmm1
+    movdqu xmm12, [rdi + 32]
+    pxor xmm2, xmm12
+    movdqu [rdi + 32], xmm2
+    movdqu xmm12, [rdi + 48]
+    pxor xmm3, xmm12
+    movdqu [rdi + 48], xmm3
+    movdqu xmm12, [rdi + 64]
+    pxor xmm4, xmm12
+    movdqu [rdi + 64], xmm4
+    movdqu xmm12, [rdi + 80]
+    pxor xmm5, xmm12
+    movdqu [rdi + 80], xmm5
+    movdqu xmm12, [rdi + 96]
+    pxor xmm6, xmm12
+    movdqu [rdi + 96], xmm6
+    movdqu xmm12, [rdi + 112]
+    pxor xmm7, xmm12
+    movdqu [rdi + 112], xmm7
+
+    paddd xmm11, xmm15
+    add rdi, 128
+    sub rsi, 128
+    jnz .block
+.ret:
+    ret
+
+.tail:
+    sub rsp, 128
+    movdqu [rsp], xmm0
+    movdqu [rsp + 16], xmm1
+    movdqu [rsp + 32], xmm2
+    movdqu [rsp + 48], xmm3
+    movdqu [rsp + 64], xmm4
+    movdqu [rsp + 80], xmm5
+    movdqu [rsp + 96], xmm6
+    movdqu [rsp + 112], xmm7
+    xor ecx, ecx
+.tail_byte:
+    mov al, [rsp + rcx]
+    xor [rdi + rcx], al
+    inc rcx
+    cmp rcx, rsi
+    jb .tail_byte
+    add rsp, 128
+    ret
+
+sigma: db "expand 32-byte k"
+one: dd 1, 0, 0, 0
+two: dd 2, 0, 0, 0
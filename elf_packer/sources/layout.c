@@ -0,0 +1,472 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   layout.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/16 10:42:18 by insub             #+#    #+#             */
+/*   Updated: 2026/02/16 17:25:03 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "print_utils.h"
+#include "elf_parser.h"
+#include "stub_image.h"
+#include "layout.h"
+#include "pack.h"
+#include <string.h>
+
+#define PAGE_SIZE 0x1000
+#define STUB_ALIGN 64   // extend / cave 의 stub 시작 (cache line)
+#define TRAILER_ALIGN 64    // 옮긴 section 들의 정렬이 깨지지 않도록 옮기는 거리를 맞춤
+#define EXTEND_MAX_BSS 0x100000
+
+#ifndef PT_GNU_PROPERTY
+# define PT_GNU_PROPERTY 0x6474e553
+#endif
+
+static const char *g_layout_names[] = { "auto", "cave", "extend", "note", "stack", "phdr" };
+
+const char *layout_name(t_layout_kind kind)
+{
+    return g_layout_names[kind];
+}
+
+int parse_layout(const char *name, t_layout_kind *kind)
+{
+    for (size_t i = 0; i < sizeof(g_layout_names) / sizeof(*g_layout_names); i++)
+    {
+        if (strcmp(name, g_layout_names[i]) == 0)
+        {
+            *kind = (t_layout_kind)i;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static int overlaps(uint64_t start, uint64_t end, uint64_t other, uint64_t other_end)
+{
+    return start < end && other < other_end && start < other_end && other < end;
+}
+
+static uint64_t align_down(uint64_t val, uint64_t align)
+{
+    return val & ~(align - 1);
+}
+
+static uint64_t load_end(const Elf64_Phdr *phdr)
+{
+    return phdr->p_vaddr + phdr->p_memsz;
+}
+
+static uint64_t max_vaddr(t_elf elf)
+{
+    uint64_t end = 0;
+
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+        if (elf.phdrs[i].p_type == PT_LOAD && load_end(&elf.phdrs[i]) > end)
+            end = load_end(&elf.phdrs[i]);
+    return end;
+}
+
+static int find_type(t_elf elf, uint32_t type)
+{
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+        if (elf.phdrs[i].p_type == type)
+            return i;
+    return -1;
+}
+
+// PT_GNU_PROPERTY 와 겹치지 않는 PT_NOTE 부터 (build-id 같은 note 는 실행에 필요 없음)
+static int find_note(t_elf elf)
+{
+    int property = find_type(elf, PT_GNU_PROPERTY);
+    int found = -1;
+
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+    {
+        const Elf64_Phdr *phdr = &elf.phdrs[i];
+
+        if (phdr->p_type != PT_NOTE)
+            continue;
+        if (found < 0)
+            found = i;
+        if (property < 0 || !overlaps(phdr->p_offset, phdr->p_offset + phdr->p_filesz,
+                elf.phdrs[property].p_offset,
+                elf.phdrs[property].p_offset + elf.phdrs[property].p_filesz))
+            return i;
+    }
+    return found;
+}
+
+// 비어 있는 파일 범위: 헤더 / 표 / 다른 segment / 내용이 있는 section 과 안 겹치고 모두 0
+static int is_free(t_elf elf, int self, uint64_t start, uint64_t end)
+{
+    const Elf64_Ehdr    *ehdr = elf.ehdr;
+    const char          *buffer = (const char *)ehdr;
+
+    if (overlaps(start, end, 0, sizeof(Elf64_Ehdr))
+        || overlaps(start, end, ehdr->e_phoff, ehdr->e_phoff + ehdr->e_phnum * sizeof(Elf64_Phdr))
+        || overlaps(start, end, ehdr->e_shoff, ehdr->e_shoff + ehdr->e_shnum * sizeof(Elf64_Shdr)))
+        return FALSE;
+    for (int i = 0; i < ehdr->e_phnum; i++)
+    {
+        const Elf64_Phdr *phdr = &elf.phdrs[i];
+
+        if (i != self && overlaps(start, end, phdr->p_offset, phdr->p_offset + phdr->p_filesz))
+            return FALSE;
+    }
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        const Elf64_Shdr *shdr = &elf.shdrs[i];
+
+        if (shdr->sh_type != SHT_NOBITS
+            && overlaps(start, end, shdr->sh_offset, shdr->sh_offset + shdr->sh_size))
+            return FALSE;
+    }
+    for (uint64_t i = start; i < end; i++)
+        if (buffer[i])
+            return FALSE;
+    return TRUE;
+}
+
+// 실행 segment 의 페이지 (stub 이 region 을 mprotect 하는 동안 stub 자신은 거기 있으면 안 됨)
+// 나 PT_GNU_RELRO (ld.so 가 stub 보다 먼저 읽기 전용으로 바꿈) 와 겹치면 그 뒤 페이지로 밀어냄
+static uint64_t skip_protected(t_elf elf, uint64_t vaddr, uint64_t size)
+{
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+    {
+        const Elf64_Phdr *phdr = &elf.phdrs[i];
+        uint64_t         start = align_down(phdr->p_vaddr, PAGE_SIZE);
+        uint64_t         end = align_up(load_end(phdr), PAGE_SIZE);
+
+        if (((phdr->p_type == PT_LOAD && (phdr->p_flags & PF_X)) || phdr->p_type == PT_GNU_RELRO)
+            && overlaps(vaddr, vaddr + size, start, end))
+        {
+            vaddr = end;
+            i = -1;
+        }
+    }
+    return vaddr;
+}
+
+// segment 뒤 padding: 다음 PT_LOAD 의 첫 페이지 전까지. segment 를 늘려서 덮으므로 bss 가 없어야 함
+static int plan_cave(t_elf elf, uint64_t file_size, uint64_t size, uint64_t bss, t_layout *layout)
+{
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+    {
+        const Elf64_Phdr    *phdr = &elf.phdrs[i];
+        uint64_t            limit = UINT64_MAX;
+
+        if (phdr->p_type != PT_LOAD || phdr->p_filesz != phdr->p_memsz
+            || phdr->p_offset > file_size || phdr->p_filesz > file_size - phdr->p_offset)
+            continue;
+        for (int j = 0; j < elf.ehdr->e_phnum; j++)
+        {
+            const Elf64_Phdr *next = &elf.phdrs[j];
+
+            if (j != i && next->p_type == PT_LOAD && load_end(next) > load_end(phdr)
+                && align_down(next->p_vaddr, PAGE_SIZE) < limit)
+                limit = align_down(next->p_vaddr, PAGE_SIZE);
+        }
+        uint64_t vaddr = skip_protected(elf, align_up(load_end(phdr), STUB_ALIGN), size + bss);
+        uint64_t offset = phdr->p_offset + (vaddr - phdr->p_vaddr);
+
+        // 마지막 segment 뒤는 cave 가 아니라 extend
+        if (limit == UINT64_MAX || vaddr + size + bss > limit || offset + size > file_size
+            || !is_free(elf, i, offset, offset + size))
+            continue;
+        *layout = (t_layout){ .kind = LAYOUT_CAVE, .phdr = i, .offset = offset, .vaddr = vaddr };
+        return TRUE;
+    }
+    return FALSE;
+}
+
+// 원본 끝 [start, 끝) 에 실행할 때 쓰는 것 (다른 segment, 헤더 표, 메모리에 올라가는 section) 이
+// 없으면 stub 뒤로 옮길 수 있음. 보통 .comment / .symtab / section header 표
+static int is_trailer(t_elf elf, uint64_t start, uint64_t file_size)
+{
+    const Elf64_Ehdr *ehdr = elf.ehdr;
+
+    if (overlaps(start, file_size, ehdr->e_phoff, ehdr->e_phoff + ehdr->e_phnum * sizeof(Elf64_Phdr)))
+        return FALSE;
+    for (int i = 0; i < ehdr->e_phnum; i++)
+    {
+        const Elf64_Phdr *phdr = &elf.phdrs[i];
+
+        if (overlaps(start, file_size, phdr->p_offset, phdr->p_offset + phdr->p_filesz))
+            return FALSE;
+    }
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        const Elf64_Shdr *shdr = &elf.shdrs[i];
+
+        if (shdr->sh_type == SHT_NOBITS)
+            continue;
+        // 걸쳐 있으면 통째로 못 옮김
+        if (shdr->sh_offset < start && shdr->sh_offset + shdr->sh_size > start)
+            return FALSE;
+        if ((shdr->sh_flags & SHF_ALLOC) && shdr->sh_size
+            && overlaps(start, file_size, shdr->sh_offset, shdr->sh_offset + shdr->sh_size))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+// 가장 높은 PT_LOAD 를 bss 뒤로 늘림. 늘린 파일 범위가 bss 자리에 올라오므로 그 자리에 있던
+// 원본 끝 (trailer) 은 stub 뒤로 옮기고 0 으로 채움. bss 가 통째로 파일에서 읽히게 되므로
+// (건드린 페이지마다 page cache 를 씀) 큰 bss 는 안 함
+static int plan_extend(t_elf elf, uint64_t file_size, t_layout *layout)
+{
+    int last = -1;
+
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+        if (elf.phdrs[i].p_type == PT_LOAD
+            && (last < 0 || load_end(&elf.phdrs[i]) > load_end(&elf.phdrs[last])))
+            last = i;
+    if (last < 0 || elf.phdrs[last].p_offset > file_size
+        || elf.phdrs[last].p_filesz > file_size - elf.phdrs[last].p_offset
+        || elf.phdrs[last].p_memsz - elf.phdrs[last].p_filesz > EXTEND_MAX_BSS)
+        return FALSE;
+
+    const Elf64_Phdr    *phdr = &elf.phdrs[last];
+    uint64_t            trailer = phdr->p_offset + phdr->p_filesz;
+    uint64_t            delta;
+
+    if (trailer < file_size && !is_trailer(elf, trailer, file_size))
+        return FALSE;
+    delta = align_up(phdr->p_memsz, (phdr->p_flags & PF_X) ? PAGE_SIZE : STUB_ALIGN);
+    *layout = (t_layout){ .kind = LAYOUT_EXTEND, .phdr = last, .offset = phdr->p_offset + delta,
+                          .vaddr = phdr->p_vaddr + delta,
+                          .trailer = trailer < file_size ? trailer : 0 };
+    layout->bytes = layout->offset - trailer;
+    return TRUE;
+}
+
+// PT_NOTE / PT_GNU_STACK 를 새 PT_LOAD 로: 파일 끝과 가장 높은 주소 뒤 (둘 다 페이지 정렬)
+static int plan_convert(t_elf elf, uint64_t file_size, int index, t_layout_kind kind,
+                        t_layout *layout)
+{
+    if (index < 0)
+        return FALSE;
+    *layout = (t_layout){ .kind = kind, .phdr = index, .offset = align_up(file_size, PAGE_SIZE),
+                          .vaddr = align_up(max_vaddr(elf), PAGE_SIZE), .mappings = 1 };
+    layout->bytes = layout->offset - file_size;
+    return TRUE;
+}
+
+// 빈 program header 가 없으면 표를 stub 옆으로 옮기고 새 PT_LOAD 를 마지막 PT_LOAD 뒤에 넣음.
+// 옛 kernel 은 AT_PHDR 를 첫 PT_LOAD 의 (vaddr - offset) + e_phoff 로 계산하므로 차이를 맞춤
+static int plan_phdr(t_elf elf, uint64_t file_size, t_layout *layout)
+{
+    int first = -1;
+    int last = -1;
+
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+    {
+        if (elf.phdrs[i].p_type != PT_LOAD)
+            continue;
+        if (first < 0)
+            first = i;
+        last = i;
+    }
+    if (first < 0 || elf.ehdr->e_phnum + 1 >= PN_XNUM)
+        return FALSE;
+
+    uint64_t bias = elf.phdrs[first].p_vaddr - elf.phdrs[first].p_offset;
+    uint64_t offset = align_up(file_size, PAGE_SIZE);
+    uint64_t vaddr = align_up(max_vaddr(elf), PAGE_SIZE);
+
+    if (vaddr - bias > offset)
+        offset = vaddr - bias;
+    *layout = (t_layout){ .kind = LAYOUT_PHDR, .phdr = last + 1, .offset = offset,
+                          .vaddr = offset + bias, .mappings = 1 };
+    layout->bytes = offset - file_size
+                  + align_up((elf.ehdr->e_phnum + 1) * sizeof(Elf64_Phdr), PACKED_ALIGN);
+    return TRUE;
+}
+
+// 파일 끝 뒤에 놓는 것들 (stub 크기와 상관없이 자리가 정해짐)
+static int plan_kind(t_elf elf, uint64_t file_size, t_layout_kind kind, t_layout *layout)
+{
+    switch (kind)
+    {
+    case LAYOUT_EXTEND:
+        return plan_extend(elf, file_size, layout);
+    case LAYOUT_NOTE:
+        return plan_convert(elf, file_size, find_note(elf), kind, layout);
+    case LAYOUT_STACK:
+        return plan_convert(elf, file_size, find_type(elf, PT_GNU_STACK), kind, layout);
+    case LAYOUT_PHDR:
+        return plan_phdr(elf, file_size, layout);
+    default:
+        return FALSE;   // cave 는 stub 크기를 안 뒤에 (refine_layout)
+    }
+}
+
+// stub 을 만들기 전에: want 가 AUTO 면 되는 것 중 mapping 수, 그 다음 bytes (stub 앞까지) 가
+// 가장 적은 것. --stream / --incremental 은 암호화하면서 stub 위치에 쓰거나 기록하므로 이것으로 끝
+int plan_layout(t_elf elf, uint64_t file_size, t_layout_kind want, t_layout *layout)
+{
+    t_layout    candidate;
+    int         found = FALSE;
+
+    for (t_layout_kind kind = LAYOUT_CAVE; kind <= LAYOUT_PHDR; kind++)
+    {
+        // AUTO: stack 은 안 고르고 cave 는 refine_layout 이 봄
+        if (want == LAYOUT_AUTO ? (kind == LAYOUT_STACK || kind == LAYOUT_CAVE) : kind != want)
+            continue;
+        if (!plan_kind(elf, file_size, kind, &candidate))
+        {
+            print_debug("    Layout %-6s: no room\n", layout_name(kind));
+            continue;
+        }
+        print_debug("    Layout %-6s: +%u mappings, +%lu bytes\n",
+            layout_name(kind), candidate.mappings, candidate.bytes);
+        if (!found || candidate.mappings < layout->mappings
+            || (candidate.mappings == layout->mappings && candidate.bytes < layout->bytes))
+            *layout = candidate;
+        found = TRUE;
+    }
+    if (!found)
+        return print_error(NO_LAYOUT, ERRNO_FALSE);
+    print_debug("    [+] Layout %s: stub at offset 0x%lx, vaddr 0x%lx\n",
+        layout_name(layout->kind), layout->offset, layout->vaddr);
+    return 0;
+}
+
+// stub 크기를 안 뒤: padding 에 들어가면 mapping 도 bytes 도 안 늘어나므로 그쪽으로 바꿈.
+// PHDR 로 잡아 둔 표 자리는 stub 안에 남음 (--lazy 의 상태 bytes 가 stub 끝 기준이라 못 뺌)
+int refine_layout(t_elf elf, uint64_t file_size, t_layout_kind want,
+                  const t_stub_image *stub, t_layout *layout)
+{
+    t_layout cave;
+
+    if (want != LAYOUT_AUTO && want != LAYOUT_CAVE)
+        return 0;
+    if (!plan_cave(elf, file_size, stub->size + stub->tail, stub->bss, &cave))
+    {
+        print_debug("    Layout cave  : no room for %lu bytes\n", stub->size + stub->tail);
+        return want == LAYOUT_CAVE ? print_error(NO_LAYOUT, ERRNO_FALSE) : 0;
+    }
+    *layout = cave;
+    print_debug("    [+] Layout cave: stub at offset 0x%lx, vaddr 0x%lx\n", layout->offset, layout->vaddr);
+    return 0;
+}
+
+// PHDR: 옮길 표 자리를 stub 에 잡아 둠 (--stream 은 chunk 가 stub 뒤에 바로 붙으므로 암호화 전에)
+int reserve_layout(t_elf elf, t_layout *layout, t_stub_image *stub)
+{
+    if (layout->kind != LAYOUT_PHDR)
+        return 0;
+
+    size_t  size = (elf.ehdr->e_phnum + 1) * sizeof(Elf64_Phdr);
+    void    *table = calloc(1, size);
+    int     ret;
+
+    if (!table)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    ret = append_stub(stub, table, size, &layout->table);
+    free(table);
+    return ret;
+}
+
+// 원본 표 + 새 PT_LOAD 를 stub 안에 쓰고 PT_PHDR / e_phoff 가 그쪽을 가리키게 함
+static void move_phdrs(t_elf elf, const t_layout *layout, t_stub_image *stub, Elf64_Phdr load)
+{
+    Elf64_Phdr  *table = (Elf64_Phdr *)(stub->code + layout->table);
+    int         count = elf.ehdr->e_phnum + 1;
+
+    memcpy(table, elf.phdrs, layout->phdr * sizeof(Elf64_Phdr));
+    table[layout->phdr] = load;
+    memcpy(table + layout->phdr + 1, elf.phdrs + layout->phdr,
+        (count - 1 - layout->phdr) * sizeof(Elf64_Phdr));
+    for (int i = 0; i < count; i++)
+    {
+        if (table[i].p_type != PT_PHDR)
+            continue;
+        table[i].p_offset = layout->offset + layout->table;
+        table[i].p_vaddr = layout->vaddr + layout->table;
+        table[i].p_paddr = table[i].p_vaddr;
+        table[i].p_filesz = count * sizeof(Elf64_Phdr);
+        table[i].p_memsz = table[i].p_filesz;
+    }
+    elf.ehdr->e_phoff = layout->offset + layout->table;
+    elf.ehdr->e_phnum = count;
+}
+
+// --huge-pages: 실행 PT_LOAD 의 p_align 을 2MB 로. kernel 이 PIE 의 load bias 를 가장 큰 p_align 에
+// 맞추므로 text 의 2MB 정렬 범위가 link 주소 그대로 정해짐 (코드는 못 옮기므로 주소는 그대로).
+// vaddr 과 offset 이 2MB 로 안 맞는 segment 는 그대로 둠
+int align_huge(t_elf elf, const t_file *file, t_output *out)
+{
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+    {
+        Elf64_Phdr *phdr = &elf.phdrs[i];
+
+        if (phdr->p_type != PT_LOAD || !(phdr->p_flags & PF_X) || phdr->p_align >= HUGE_PAGE_SIZE
+            || (phdr->p_vaddr - phdr->p_offset) % HUGE_PAGE_SIZE != 0)
+            continue;
+        phdr->p_align = HUGE_PAGE_SIZE;
+        if (add_patch(out, file, phdr, sizeof(Elf64_Phdr)) == FALSE)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+        print_debug("    [+] Segment %d aligned to 2MB\n", i);
+    }
+    return 0;
+}
+
+// EXTEND: 원본 끝을 stub 뒤로 옮기면서 section header 의 offset 과 e_shoff 를 고침.
+// 표는 옮기는 범위 안에 있으므로 out 은 buffer 에서 고친 내용 그대로 옮겨 씀
+static void move_trailer(t_elf elf, const t_layout *layout, uint64_t stub_end, t_output *out)
+{
+    uint64_t delta = align_up(stub_end - layout->trailer, TRAILER_ALIGN);
+
+    for (int i = 0; i < elf.ehdr->e_shnum; i++)
+        if (elf.shdrs[i].sh_type != SHT_NOBITS && elf.shdrs[i].sh_offset >= layout->trailer)
+            elf.shdrs[i].sh_offset += delta;
+    if (elf.ehdr->e_shoff >= layout->trailer)
+        elf.ehdr->e_shoff += delta;
+    out->trailer = layout->trailer;
+    out->trailer_to = layout->trailer + delta;
+    out->stub_end = stub_end;
+    print_debug("    [+] Moved 0x%lx.. past the stub to 0x%lx\n", out->trailer, out->trailer_to);
+}
+
+// stub 크기가 정해진 뒤: program header 와 entry 를 고치고 바뀐 범위를 out 에 기록
+int apply_layout(t_elf elf, const t_layout *layout, const t_file *file,
+                 t_output *out, t_stub_image *stub)
+{
+    uint64_t    filesz = stub->size + stub->tail;   // 스텁 + kernel (+ --stream 의 chunk)
+    Elf64_Phdr  load = { .p_type = PT_LOAD, .p_flags = PF_R | PF_W | PF_X,
+                         .p_offset = layout->offset, .p_vaddr = layout->vaddr,
+                         .p_paddr = layout->vaddr, .p_filesz = filesz,
+                         .p_memsz = filesz + stub->bss, .p_align = PAGE_SIZE };
+    Elf64_Phdr  *phdr = NULL;
+
+    if (layout->kind == LAYOUT_PHDR)
+        move_phdrs(elf, layout, stub, load);
+    else
+    {
+        phdr = &elf.phdrs[layout->phdr];
+        if (layout->kind == LAYOUT_CAVE || layout->kind == LAYOUT_EXTEND)
+        {
+            // stub 이 자기 자리에 쓰므로 segment 전체가 RWX 가 됨
+            phdr->p_filesz = layout->offset - phdr->p_offset + filesz;
+            phdr->p_memsz = phdr->p_filesz + stub->bss;
+            phdr->p_flags |= PF_R | PF_W | PF_X;
+            if (layout->kind == LAYOUT_EXTEND && layout->trailer)
+                move_trailer(elf, layout, layout->offset + filesz, out);
+        }
+        else
+            *phdr = load;
+    }
+    elf.ehdr->e_entry = layout->vaddr;
+    print_debug("    [+] Entry Point updated to 0x%lx\n", elf.ehdr->e_entry);
+    if (add_patch(out, file, elf.ehdr, sizeof(Elf64_Ehdr)) == FALSE
+        || (phdr && add_patch(out, file, phdr, sizeof(Elf64_Phdr)) == FALSE))
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    return 0;
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lz4.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/10 14:02:51 by insub             #+#    #+#             */
+/*   Updated: 2026/01/11 20:37:19 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "lz4.h"
+#include "arena.h"
+#include <string.h>
+
+#define HASH_LOG 16
+
+static uint32_t read32(const uint8_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t hash4(uint32_t seq)
+{
+    return (seq * 2654435761U) >> (32 - HASH_LOG);
+}
+
+static uint8_t *write_length(uint8_t *op, size_t len)
+{
+    while (len >= 255)
+    {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = (uint8_t)len;
+    return op;
+}
+
+// token | literal 길이 확장 | literals | offset(LE16) | match 길이 확장
+static uint8_t *write_sequence(uint8_t *op, const uint8_t *literals, size_t lit_len,
+                               uint32_t offset, size_t match_len)
+{
+    uint8_t *token = op++;
+
+    *token = (uint8_t)((lit_len < 15 ? lit_len : 15) << 4);
+    if (lit_len >= 15)
+        op = write_length(op, lit_len - 15);
+    memcpy(op, literals, lit_len);
+    op += lit_len;
+    if (match_len == 0)
+        return op;
+
+    *op++ = (uint8_t)offset;
+    *op++ = (uint8_t)(offset >> 8);
+    match_len -= LZ4_MIN_MATCH;
+    *token |= (uint8_t)(match_len < 15 ? match_len : 15);
+    if (match_len >= 15)
+        op = write_length(op, match_len - 15);
+    return op;
+}
+
+// greedy 한 번 보기 + 실패가 이어지면 건너뛰는 폭을 늘림 (압축 안 되는 구간을 빨리 지나감)
+size_t lz4_compress(const uint8_t *src, size_t size, uint8_t *dst)
+{
+    const uint8_t   *ip = src;
+    const uint8_t   *anchor = src;
+    const uint8_t   *mf_limit = src + size - LZ4_MF_LIMIT;
+    const uint8_t   *match_limit = src + size - LZ4_LAST_LITERALS;
+    uint8_t         *op = dst;
+
+    if (size <= LZ4_MF_LIMIT)
+        return write_sequence(op, src, size, 0, 0) - dst;
+
+    uint32_t *table = arena_calloc(1 << HASH_LOG, sizeof(uint32_t));
+    if (!table)
+        return 0;
+
+    uint32_t misses = 0;
+    while (ip < mf_limit)
+    {
+        uint32_t        seq = read32(ip);
+        uint32_t        h = hash4(seq);
+        const uint8_t   *ref = src + table[h];
+
+        table[h] = (uint32_t)(ip - src);
+        if (ref >= ip || ip - ref > LZ4_MAX_OFFSET || read32(ref) != seq)
+        {
+            ip += 1 + (misses++ >> 6);
+            continue;
+        }
+        misses = 0;
+
+        // match 를 뒤로 늘리고 (match_limit 까지), 앞쪽 literal 과 겹치는 만큼 앞으로도 늘림
+        const uint8_t *end = ip + LZ4_MIN_MATCH;
+        const uint8_t *mend = ref + LZ4_MIN_MATCH;
+        while (end < match_limit && *end == *mend)
+        {
+            end++;
+            mend++;
+        }
+        while (ip > anchor && ref > src && ip[-1] == ref[-1])
+        {
+            ip--;
+            ref--;
+        }
+
+        op = write_sequence(op, anchor, ip - anchor, (uint32_t)(ip - ref), end - ip);
+        anchor = ip = end;
+        if (ip < mf_limit)
+            table[hash4(read32(ip - 2))] = (uint32_t)(ip - 2 - src);
+    }
+    arena_free(table);
+    return write_sequence(op, anchor, src + size - anchor, 0, 0) - dst;
+}
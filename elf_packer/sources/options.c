@@ -0,0 +1,232 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/31 10:14:22 by insub             #+#    #+#             */
+/*   Updated: 2026/01/31 10:14:22 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "options.h"
+#include "stub_image.h"
+#include "layout.h"
+#include "watch.h"
+#include <string.h>
+
+static int parse_cipher(const char *name, t_cipher *cipher)
+{
+    if (strcmp(name, "chacha20") == 0)
+        *cipher = CIPHER_CHACHA20;
+    else if (strcmp(name, "aes128") == 0)
+        *cipher = CIPHER_AES128_CTR;
+    else if (strcmp(name, "aes256") == 0)
+        *cipher = CIPHER_AES256_CTR;
+    else
+        return FALSE;
+    return TRUE;
+}
+
+// --lazy-block: 페이지 이상의 2 의 거듭제곱
+static int parse_lazy_block(const char *arg, uint32_t *shift)
+{
+    char                *end;
+    unsigned long long  size = strtoull(arg, &end, 0);
+
+    if (*end != '\0' || size == 0 || (size & (size - 1)) != 0)
+        return FALSE;
+    *shift = __builtin_ctzll(size);
+    return *shift >= LAZY_MIN_SHIFT && *shift <= LAZY_MAX_SHIFT;
+}
+
+static int parse_count(const char *arg, int max, int *value)
+{
+    char *end;
+    long n = strtol(arg, &end, 10);
+
+    if (*end != '\0' || n < 1 || n > max)
+        return FALSE;
+    *value = (int)n;
+    return TRUE;
+}
+
+// --cache-size: bytes, K / M / G 접미사
+static int parse_size(const char *arg, uint64_t *size)
+{
+    char                *end;
+    unsigned long long  value = strtoull(arg, &end, 10);
+    int                 shift = 0;
+
+    if (end == arg)
+        return FALSE;
+    if (*end == 'K' || *end == 'k')
+        shift = 10;
+    else if (*end == 'M' || *end == 'm')
+        shift = 20;
+    else if (*end == 'G' || *end == 'g')
+        shift = 30;
+    if ((shift && *++end != '\0') || *end != '\0' || value == 0 || value > (UINT64_MAX >> shift))
+        return FALSE;
+    *size = (uint64_t)value << shift;
+    return TRUE;
+}
+
+// --key: 16 진수 64 글자
+static int parse_key(const char *arg, uint8_t *key)
+{
+    if (strlen(arg) != CACHE_KEY_SIZE * 2 || strspn(arg, "0123456789abcdefABCDEF") != CACHE_KEY_SIZE * 2)
+        return FALSE;
+    for (int i = 0; i < CACHE_KEY_SIZE; i++)
+        sscanf(arg + i * 2, "%2hhx", &key[i]);
+    return TRUE;
+}
+
+// packing 결과를 정하는 옵션 하나 (name 다음 인자가 value).
+// 반환: 쓴 인자 수 (1 / 2), 옵션은 맞는데 값이 틀리면 FALSE, packing 옵션이 아니면 -1
+int parse_pack_option(const char *name, const char *value, t_pack_config *pack, uint8_t *key)
+{
+    if (strcmp(name, "--compress") == 0)
+        pack->compress = TRUE;
+    else if (strcmp(name, "--bcj") == 0)
+    {
+        pack->compress = TRUE;
+        pack->filter = FILTER_BCJ;
+    }
+    else if (strcmp(name, "--lazy") == 0)
+    {
+        if (pack->lazy_shift == 0)
+            pack->lazy_shift = LAZY_DEFAULT_SHIFT;
+    }
+    else if (strcmp(name, "--stream") == 0)
+        pack->stream = TRUE;
+    else if (strcmp(name, "--telemetry") == 0)
+        pack->telemetry = TRUE;
+    else if (strcmp(name, "--huge-pages") == 0)
+        pack->huge_pages = TRUE;
+    else if (!value)
+        return -1;
+    else if (strcmp(name, "--cipher") == 0)
+        return parse_cipher(value, &pack->cipher) ? 2 : FALSE;
+    else if (strcmp(name, "--layout") == 0)
+        return parse_layout(value, &pack->layout) ? 2 : FALSE;
+    else if (strcmp(name, "--kernel") == 0)
+    {
+        pack->kernel = value;
+        return is_kernel_name(value) ? 2 : FALSE;
+    }
+    else if (strcmp(name, "--lazy-block") == 0)
+        return parse_lazy_block(value, &pack->lazy_shift) ? 2 : FALSE;
+    else if (strcmp(name, "--threads") == 0)
+    {
+        int threads;
+        if (parse_count(value, MAX_THREADS, &threads) == FALSE)
+            return FALSE;
+        pack->threads = threads;
+        return 2;
+    }
+    else if (strcmp(name, "--cache") == 0)
+    {
+        pack->cache_dir = value;
+        return 2;
+    }
+    else if (strcmp(name, "--cache-size") == 0)
+        return parse_size(value, &pack->cache_size) ? 2 : FALSE;
+    else if (strcmp(name, "--key") == 0)
+    {
+        if (parse_key(value, key) == FALSE)
+            return FALSE;
+        pack->key = key;
+        return 2;
+    }
+    else if (strcmp(name, "--incremental") == 0)
+    {
+        pack->incremental = value;
+        return 2;
+    }
+    else
+        return -1;
+    return 1;
+}
+
+int parse_args(int argc, char *argv[], t_options *opt)
+{
+    *opt = (t_options){ .pack.cipher = CIPHER_CHACHA20, .pack.cache_size = CACHE_DEFAULT_SIZE,
+                        .debounce = WATCH_DEBOUNCE_MS };
+    opt->batch.inputs = malloc(argc * sizeof(*opt->batch.inputs));
+    if (!opt->batch.inputs)
+        return FALSE;
+    for (int i = 1; i < argc; i++)
+    {
+        int used = parse_pack_option(argv[i], i + 1 < argc ? argv[i + 1] : NULL,
+                                     &opt->pack, opt->key);
+        if (used == FALSE)
+            return FALSE;
+        if (used > 0)
+            i += used - 1;
+        else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+            opt->profile = argv[++i];
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            opt->output = argv[++i];
+        else if (strcmp(argv[i], "--out-dir") == 0 && i + 1 < argc)
+            opt->batch.out_dir = argv[++i];
+        else if (strcmp(argv[i], "--manifest") == 0 && i + 1 < argc)
+            opt->batch.manifest = argv[++i];
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+        {
+            if (parse_count(argv[++i], BATCH_MAX_WORKERS, &opt->batch.workers) == FALSE)
+                return FALSE;
+        }
+        else if (strcmp(argv[i], "--no-uring") == 0)
+            opt->batch.no_uring = TRUE;
+        else if (strcmp(argv[i], "--watch") == 0 && i + 1 < argc)
+            opt->watch = argv[++i];
+        else if (strcmp(argv[i], "--serve") == 0 && i + 1 < argc)
+            opt->serve = argv[++i];
+        else if (strcmp(argv[i], "--stats") == 0 && i + 1 < argc)
+            opt->stats = argv[++i];
+        else if (strcmp(argv[i], "--stats-counters") == 0)
+            opt->stats_counters = TRUE;
+        else if (strcmp(argv[i], "--debounce") == 0 && i + 1 < argc)
+        {
+            if (parse_count(argv[++i], 60000, &opt->debounce) == FALSE)
+                return FALSE;
+        }
+        else if (argv[i][0] == '-')
+            return FALSE;
+        else
+            opt->batch.inputs[opt->batch.count++] = argv[i];
+    }
+    // profile 에 없는 block 은 lazy 로 남겨야 의미가 있음
+    if (opt->profile && opt->pack.lazy_shift == 0)
+        opt->pack.lazy_shift = LAZY_DEFAULT_SHIFT;
+
+    // --incremental 은 이전 출력에 이어 쓰므로 출력이 key 하나로 정해지는 --cache 와, 출력을
+    // 미리 열어 두는 --stream 과는 같이 못 씀
+    if (opt->pack.incremental && (opt->pack.cache_dir || opt->pack.stream))
+        return FALSE;
+    // cave 는 stub 크기를 안 뒤에 자리를 정하는데 둘은 그 전에 stub 위치를 씀
+    if (opt->pack.layout == LAYOUT_CAVE && (opt->pack.incremental || opt->pack.stream))
+        return FALSE;
+    if (opt->stats_counters && opt->stats == NULL)
+        return FALSE;
+
+    // --serve 는 요청마다 명령줄을 따로 받음. 여기서는 -j 만 씀
+    if (opt->serve)
+        return opt->batch.count == 0 && opt->batch.manifest == NULL && opt->output == NULL
+            && opt->profile == NULL && opt->pack.incremental == NULL && opt->watch == NULL;
+
+    // --watch 는 입력을 명령줄이 아니라 inotify 로 받음. 출력은 batch 처럼 (--out-dir / 입력.woody)
+    if (opt->watch)
+        return opt->batch.count == 0 && opt->batch.manifest == NULL && opt->output == NULL
+            && opt->profile == NULL && opt->pack.incremental == NULL;
+
+    // 입력이 여럿이거나 batch 옵션이 있으면 batch. profile / -o / --incremental 은 파일 하나에만
+    int batch = opt->batch.count > 1 || opt->batch.manifest || opt->batch.out_dir
+        || opt->batch.workers;
+    if (batch)
+        return opt->output == NULL && opt->profile == NULL && opt->pack.incremental == NULL;
+    return opt->batch.count == 1;
+}
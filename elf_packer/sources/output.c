@@ -0,0 +1,242 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/12/14 15:02:11 by insub             #+#    #+#             */
+/*   Updated: 2025/12/14 16:40:27 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "output.h"
+#include "print_utils.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+
+#define PATCH_ALIGN 0x1000
+
+int write_all(int fd, const char *buffer, size_t size, uint64_t offset)
+{
+    size_t total = 0;
+
+    while (total < size)
+    {
+        size_t  chunk = size - total;
+        if (chunk > READ_CHUNK_SIZE)
+            chunk = READ_CHUNK_SIZE;
+
+        ssize_t written = pwrite(fd, buffer + total, chunk, (off_t)(offset + total));
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return FALSE;
+        total += (size_t)written;
+    }
+    return TRUE;
+}
+
+// fd_in 의 [0, size) 를 커널 안에서 복사
+// 1) FICLONE: 같은 파일시스템의 reflink (btrfs, xfs) -> 데이터 블록 공유, I/O 없음
+// 2) copy_file_range: 서버 측 복사 / splice
+// 처음부터 둘 다 안 되면 FALSE (호출자가 fallback), 도중에 실패하면 -1
+int clone_file(int fd_out, int fd_in, uint64_t size)
+{
+    if (ioctl(fd_out, FICLONE, fd_in) == 0)
+    {
+        print_debug("    [+] Cloned with FICLONE\n");
+        return TRUE;
+    }
+
+    loff_t  off_in = 0;
+    loff_t  off_out = 0;
+    while ((uint64_t)off_in < size)
+    {
+        ssize_t copied = copy_file_range(fd_in, &off_in, fd_out, &off_out,
+                                         size - (uint64_t)off_in, 0);
+        if (copied < 0 && errno == EINTR)
+            continue;
+        if (copied > 0)
+            continue;
+        // EXDEV, ENOSYS, EOPNOTSUPP... 처음부터 안 되는 경우에만 FALSE
+        return (copied == 0 || off_in != 0) ? -1 : FALSE;
+    }
+    print_debug("    [+] Copied with copy_file_range\n");
+    return TRUE;
+}
+
+// 원본의 변하지 않은 바이트를 복사. 커널 안에서 안 되면 매핑된 버퍼에서 write
+static int copy_original(int fd_out, const t_file *file)
+{
+    int copied = clone_file(fd_out, file->fd, file->size);
+
+    if (copied != FALSE)
+        return copied == TRUE;
+    print_debug("    [!] copy_file_range unavailable, writing buffer\n");
+    return write_all(fd_out, file->buffer, file->size, 0);
+}
+
+// 통째로 0 인 온전한 페이지만 hole 후보
+static int is_zero_page(const t_file *file, uint64_t offset, uint64_t end)
+{
+    static const char zero[PATCH_ALIGN];
+
+    return offset + PATCH_ALIGN <= end
+        && memcmp(file->buffer + offset, zero, PATCH_ALIGN) == 0;
+}
+
+// [start, end) 를 다시 씀. 0 페이지가 이어진 구간 (--compress 로 비운 원본 자리) 은
+// 쓰지 않고 hole 을 뚫음. 파일시스템이 지원 안 하면 0 을 그대로 씀
+static int write_range(int fd_out, const t_file *file, uint64_t start, uint64_t end,
+                       uint64_t *punched)
+{
+    while (start < end)
+    {
+        int         zero = is_zero_page(file, start, end);
+        uint64_t    run = start;
+
+        do
+            run = (run + PATCH_ALIGN < end) ? run + PATCH_ALIGN : end;
+        while (run < end && is_zero_page(file, run, end) == zero);
+
+        if (zero && fallocate(fd_out, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                              (off_t)start, (off_t)(run - start)) == 0)
+            *punched += run - start;
+        else if (write_all(fd_out, file->buffer + start, run - start, start) == FALSE)
+            return FALSE;
+        start = run;
+    }
+    return TRUE;
+}
+
+// 출력의 [offset, offset + size) 를 0 으로. 온전한 페이지는 hole 을 뚫고 가장자리만 씀
+int zero_range(int fd_out, uint64_t offset, uint64_t size)
+{
+    static const char   zero[PATCH_ALIGN];
+    uint64_t            end = offset + size;
+    uint64_t            lo = (offset + PATCH_ALIGN - 1) & ~(uint64_t)(PATCH_ALIGN - 1);
+    uint64_t            hi = end & ~(uint64_t)(PATCH_ALIGN - 1);
+
+    if (lo < hi && fallocate(fd_out, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                             (off_t)lo, (off_t)(hi - lo)) == 0)
+    {
+        return write_all(fd_out, zero, lo - offset, offset)
+            && write_all(fd_out, zero, end - hi, hi);
+    }
+    for (uint64_t pos = offset; pos < end; pos += PATCH_ALIGN)
+    {
+        size_t n = end - pos < PATCH_ALIGN ? end - pos : PATCH_ALIGN;
+        if (write_all(fd_out, zero, n, pos) == FALSE)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static int compare_patch(const void *a, const void *b)
+{
+    const t_patch *pa = a;
+    const t_patch *pb = b;
+
+    return (pa->offset > pb->offset) - (pa->offset < pb->offset);
+}
+
+int add_patch(t_output *out, const t_file *file, const void *ptr, size_t size)
+{
+    if (out->patch_count == MAX_PATCHES)
+        return FALSE;
+
+    uint64_t offset = (uint64_t)((const char *)ptr - file->buffer);
+    assert(offset + size <= file->size);
+    out->patches[out->patch_count++] = (t_patch){ offset, size };
+    return TRUE;
+}
+
+// 출력을 만들고 원본 내용을 복사 (수정 전 바이트). 성공하면 *fd_out 에 열린 fd.
+// 있던 출력은 O_TRUNC 로 덮지 않고 지움 (--cache 가 hardlink 로 꺼낸 파일이면 cache 까지 망가짐)
+int begin_output(const char *out_name, const t_file *file, int *fd_out)
+{
+    if (unlink(out_name) < 0 && errno != ENOENT)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    *fd_out = open(out_name, O_WRONLY | O_CREAT | O_TRUNC, 0755);
+    if (*fd_out < 0)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    if (copy_original(*fd_out, file) == FALSE)
+    {
+        close(*fd_out);
+        *fd_out = -1;
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    }
+    return 0;
+}
+
+// 수정된 페이지와 스텁을 쓰고 fd_out 을 닫음
+int finish_output(int fd_out, const t_file *file, const t_output *out)
+{
+    // 1) 수정된 헤더가 포함된 페이지만 다시 쓰기 (같은 페이지는 한 번만)
+    t_patch patches[MAX_PATCHES];
+    memcpy(patches, out->patches, sizeof(t_patch) * out->patch_count);
+    qsort(patches, out->patch_count, sizeof(t_patch), compare_patch);
+
+    uint64_t rewritten = 0;
+    uint64_t punched = 0;
+    uint64_t written_end = 0;
+    for (int i = 0; i < out->patch_count; i++)
+    {
+        uint64_t start = patches[i].offset & ~(uint64_t)(PATCH_ALIGN - 1);
+        uint64_t end = (patches[i].offset + patches[i].size + PATCH_ALIGN - 1)
+                       & ~(uint64_t)(PATCH_ALIGN - 1);
+        // --stream 은 같은 페이지의 region 을 이미 암호화해서 써 두었으므로 헤더 바이트만
+        if (out->fd >= 0)
+        {
+            start = patches[i].offset;
+            end = patches[i].offset + patches[i].size;
+        }
+        if (start < written_end)
+            start = written_end;
+        if (end > file->size)
+            end = file->size;
+        if (start >= end)
+            continue;
+        if (write_range(fd_out, file, start, end, &punched) == FALSE)
+            goto fail;
+        rewritten += end - start;
+        written_end = end;
+    }
+
+    // 2) 패딩은 쓰지 않음: 파일 끝 너머에 pwrite 하면 그 사이는 hole 로 남음
+    // 3) 스텁 코드 쓰기
+    if (write_all(fd_out, out->stub, out->stub_size, out->stub_offset) == FALSE)
+        goto fail;
+
+    // 4) --layout extend: 원본 끝은 stub 뒤로 옮기고 bss 에 올라오는 원래 자리는 0
+    if (out->trailer_to
+        && (write_all(fd_out, file->buffer + out->trailer, file->size - out->trailer,
+                      out->trailer_to) == FALSE
+            || zero_range(fd_out, out->trailer, out->stub_offset - out->trailer) == FALSE
+            || zero_range(fd_out, out->stub_end, out->trailer_to - out->stub_end) == FALSE))
+        goto fail;
+
+    print_debug("    [+] Rewrote %lu bytes (%lu punched), hole %lu bytes, stub %lu bytes\n",
+        rewritten, punched, out->stub_offset > file->size ? out->stub_offset - file->size : 0,
+        out->stub_size);
+    close(fd_out);
+    return 0;
+
+fail:
+    close(fd_out);
+    return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+}
+
+int write_output(const char *out_name, const t_file *file, const t_output *out)
+{
+    int fd_out;
+
+    if (begin_output(out_name, file, &fd_out) < 0)
+        return -1;
+    return finish_output(fd_out, file, out);
+}
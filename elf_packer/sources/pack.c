@@ -0,0 +1,218 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pack.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/16 11:20:37 by insub             #+#    #+#             */
+/*   Updated: 2026/01/16 19:05:12 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "file.h"
+#include "print_utils.h"
+#include "elf_parser.h"
+#include "output.h"
+#include "payload.h"
+#include "stub_image.h"
+#include "layout.h"
+#include "pack.h"
+#include "cache.h"
+#include "repack.h"
+#include "arena.h"
+#include "stats.h"
+#include "xxh64.h"
+
+uint64_t align_up(uint64_t val, uint64_t align)
+{
+    return (val + align - 1) & ~(align - 1);
+}
+
+// encode 단계가 처리한 원본 bytes
+static uint64_t region_bytes(const t_stub_params *params)
+{
+    uint64_t total = 0;
+
+    for (uint32_t i = 0; i < params->region_count; i++)
+        total += params->regions[i].size;
+    return total;
+}
+
+// 메모리에 올린 file 을 packing: 헤더는 file->buffer 에서 고치고 바뀐 범위를 out 에 기록.
+// out->fd 가 열려 있으면 (--stream) 실행 region 은 buffer 대신 거기로 바로 씀.
+// 성공하면 out->stub 이 stub->code 를 가리키므로 다 쓴 뒤 free_stub. 실패하면 -1
+int pack_image(t_file *file, const t_pack_config *config, t_output *out, t_stub_image *stub)
+{
+    size_t          file_size = file->size;
+    t_stats_timer   timer;
+
+    // Parse ELF (batch 에서 이상한 파일 하나가 전체를 죽이지 않도록 범위부터 확인)
+    stats_begin(&timer);
+    if (check_elf(file->buffer, file->size) == FALSE)
+        return print_error(INVALID_ELF, ERRNO_FALSE);
+    t_elf elf = parse_elf(file->buffer);
+
+    // Check EP (stub 을 실을 자리는 plan_layout 이 정함)
+    if (elf.ehdr->e_entry == 0)
+        return print_error(INVALID_ELF, ERRNO_FALSE);
+    stats_end(&timer, PHASE_PARSE, file_size);
+
+    print_debug("\n[+] Starting Packing Process...\n");
+
+    // 원본 Entry Point 저장
+    Elf64_Addr original_entry = elf.ehdr->e_entry;
+    print_debug("    Original Entry: 0x%lx\n", original_entry);
+
+    // stub 자리: 먼저 파일 끝 뒤로 정하고 (--stream / --incremental 은 암호화하면서 그 위치에
+    // 쓰거나 기록함), 아니면 stub 크기를 안 뒤에 padding (cave) 에 들어가는지 다시 봄
+    t_layout    layout = { .kind = LAYOUT_CAVE };
+    int         late = out->fd < 0 && !config->repack;
+
+    stats_begin(&timer);
+    if ((!late || config->layout != LAYOUT_CAVE)
+        && plan_layout(elf, file_size, config->layout, &layout) < 0)
+        return -1;
+    stats_end(&timer, PHASE_LAYOUT, file_size);
+
+    stats_begin(&timer);
+    if (build_stub(stub, config->cipher, config->kernel, config->telemetry) < 0)
+        return -1;
+    if (config->telemetry)
+        set_telemetry_id(stub, xxh64(file->buffer, file_size, 0));
+    if (reserve_layout(elf, &layout, stub) < 0)
+    {
+        free_stub(stub);
+        return -1;
+    }
+    t_stub_params *params = stub->params;
+    params->oep = original_entry;
+    print_debug("    [+] Stub patched at offset %ld with OEP 0x%lx\n",
+        (long)((unsigned char *)params - stub->code), original_entry);
+    stats_end(&timer, PHASE_STUB, stub->size);
+
+    // 실행 segment 암호화 (stub 이 OEP 로 점프하기 전에 복호화)
+    // --compress 면 압축한 blob 이 stub 뒤에 붙어서 stub.size 가 늘어남
+    out->stub_offset = layout.offset;
+    stats_begin(&timer);
+    if (encrypt_payload(elf, file, out, stub, config) < 0)
+    {
+        free_stub(stub);
+        return -1;
+    }
+    stats_end(&timer, PHASE_ENCODE, region_bytes(stub->params));
+
+    if (late && refine_layout(elf, file_size, config->layout, stub, &layout) < 0)
+    {
+        free_stub(stub);
+        return -1;
+    }
+    if (stub->params->huge_pages && align_huge(elf, file, out) < 0)
+    {
+        free_stub(stub);
+        return -1;
+    }
+    stub->params->stub_vaddr = layout.vaddr;
+    out->stub_offset = layout.offset;
+    if (apply_layout(elf, &layout, file, out, stub) < 0)
+    {
+        free_stub(stub);
+        return -1;
+    }
+    out->stub = stub->code;
+    out->stub_size = stub->size;
+    return 0;
+}
+
+// input 을 packing 해서 output 에 씀 (원본은 건드리지 않음). 실패하면 -1, cache 에서 꺼냈으면 PACK_CACHED
+// --stream 은 출력을 먼저 열어 두고 실행 region 을 chunk 단위로 흘려 보냄 (메모리 고정)
+// --cache / --key 는 key 를 cache key 에서 유도하므로 같은 입력과 옵션이면 출력도 같음
+// --incremental 은 이전 출력에서 바뀌지 않은 chunk 를 가져오고 출력 옆에 manifest 를 새로 씀
+static int pack_job(const char *input, const char *output, const t_pack_config *config)
+{
+    t_file          file;
+    t_output        out = { .fd = -1 };
+    t_stub_image    stub;
+    t_stats_timer   timer;
+    t_pack_config   job = *config;
+    t_repack        repack;
+    uint8_t         key[CACHE_KEY_SIZE];
+    uint64_t        out_size = 0;
+    int             exit_code;
+
+    stats_begin(&timer);
+    if (open_file(input, &file) < 0)
+        return -1;
+    stats_end(&timer, PHASE_READ, file.size);
+    if (config->cache_dir || config->key)
+    {
+        stats_begin(&timer);
+        cache_key(&file, config, key);
+        job.seed = key;
+        if (config->cache_dir && cache_fetch(config, key, output))
+        {
+            stats_end(&timer, PHASE_CACHE, file.size);
+            close_file(&file);
+            return PACK_CACHED;
+        }
+        stats_end(&timer, PHASE_CACHE, file.size);
+    }
+    if (config->incremental)
+    {
+        open_repack(&repack, config->incremental, config);
+        job.repack = &repack;
+    }
+    if (config->stream && begin_output(output, &file, &out.fd) < 0)
+    {
+        if (job.repack)
+            close_repack(&repack);
+        close_file(&file);
+        return -1;
+    }
+    exit_code = pack_image(&file, &job, &out, &stub);
+    if (exit_code == 0)
+    {
+        // 원본은 clone / copy_file_range, 헤더 페이지만 다시 쓰고 패딩은 hole 로 남김
+        stats_begin(&timer);
+        if (out.fd >= 0)
+            exit_code = finish_output(out.fd, &file, &out);
+        else
+            exit_code = write_output(output, &file, &out);
+        out_size = out.stub_offset + stub.size + stub.tail;
+        if (out_size < file.size)
+            out_size = file.size;   // --layout cave
+        if (out.trailer_to)
+            out_size = out.trailer_to + file.size - out.trailer;   // --layout extend
+        stats_end(&timer, PHASE_WRITE, out_size);
+        free_stub(&stub);
+    }
+    else if (out.fd >= 0)
+        close(out.fd);
+    if (exit_code == 0)
+        print_debug("\n[SUCCESS] Packed file created: %s\n", output);
+    if (exit_code == 0 && config->cache_dir)
+    {
+        stats_begin(&timer);
+        cache_store(config, key, output);
+        stats_end(&timer, PHASE_CACHE, out_size);
+    }
+    if (job.repack)
+    {
+        if (exit_code == 0)
+            exit_code = save_repack(&repack, output);
+        close_repack(&repack);
+    }
+    close_file(&file);
+    return exit_code;
+}
+
+// job 하나가 쓴 memory 는 thread 의 arena 에서 받고 끝나면 한꺼번에 돌려줌 (slab 은 다음 job 이 씀)
+int pack_file(const char *input, const char *output, const t_pack_config *config)
+{
+    int exit_code = pack_job(input, output, config);
+
+    arena_reset(arena_current());
+    stats_file(exit_code);
+    return exit_code;
+}
@@ -0,0 +1,907 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   payload.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/12/20 13:24:51 by insub             #+#    #+#             */
+/*   Updated: 2025/12/21 18:02:36 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "payload.h"
+#include "chacha20.h"
+#include "lz4.h"
+#include "bcj.h"
+#include "stub_image.h"
+#include "print_utils.h"
+#include "stream.h"
+#include "blake2b.h"
+#include "cache.h"
+#include "repack.h"
+#include "xxh64.h"
+#include "arena.h"
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/random.h>
+
+#define PAGE_SIZE 0x1000
+
+typedef struct s_pack_stats
+{
+    uint64_t    raw;            // 압축한 region 들의 원래 크기
+    uint64_t    packed;
+    int         compressed;
+    int         skipped;
+}   t_pack_stats;
+
+t_stub_params *find_stub_params(unsigned char *stub, size_t stub_len)
+{
+    uint64_t placeholder = PLACEHOLDER;
+
+    for (size_t i = 0; i + sizeof(t_stub_params) <= stub_len; i++)
+    {
+        if (memcmp(&stub[i], &placeholder, sizeof(placeholder)) == 0)
+            return (t_stub_params *)&stub[i];
+    }
+    return NULL;
+}
+
+static uint32_t flags_to_prot(uint32_t p_flags)
+{
+    return ((p_flags & PF_R) ? PROT_READ : 0)
+         | ((p_flags & PF_W) ? PROT_WRITE : 0)
+         | ((p_flags & PF_X) ? PROT_EXEC : 0);
+}
+
+static void print_key(const uint32_t key[8], int key_size)
+{
+    const uint8_t *bytes = (const uint8_t *)key;
+
+    printf("key_value: ");
+    for (int i = 0; i < key_size; i++)
+        printf("%02X", bytes[i]);
+    printf("\n");
+}
+
+static void xor_keystream(t_stub_params *params, const t_aes *aes,
+                          uint32_t counter, uint8_t *buffer, size_t size)
+{
+    if (params->cipher == CIPHER_CHACHA20)
+        chacha20_xor(params->key, &params->nonce[1], counter, buffer, size);
+    else
+        aes_ctr_xor(aes, (const uint8_t *)&params->nonce[1], counter, buffer, size);
+}
+
+// size bytes 를 덮는 cipher block 수 (= counter 를 얼마나 쓰는지)
+static uint32_t cipher_blocks(const t_stub_params *params, uint64_t size)
+{
+    size_t block = params->cipher == CIPHER_CHACHA20 ? CHACHA_BLOCK_SIZE : AES_BLOCK_SIZE;
+
+    return (uint32_t)((size + block - 1) / block);
+}
+
+// keystream 은 buffer 를 64 bytes 로 내린 자리부터 이어짐 (head = 그 안의 위치)
+// stub 이 region 중간의 아무 block 이나 따로 복호화할 수 있도록 주소에 맞춤
+// 반환: 쓴 cipher block 수
+static uint32_t encrypt_region(t_stub_params *params, const t_aes *aes, uint32_t counter,
+                               uint8_t *buffer, size_t size, size_t head)
+{
+    size_t      block = params->cipher == CIPHER_CHACHA20 ? CHACHA_BLOCK_SIZE : AES_BLOCK_SIZE;
+    uint32_t    used = cipher_blocks(params, head + size);
+
+    if (head)
+    {
+        uint8_t bounce[CHACHA_BLOCK_SIZE] = {0};
+        size_t  n = CHACHA_BLOCK_SIZE - head < size ? CHACHA_BLOCK_SIZE - head : size;
+
+        memcpy(bounce + head, buffer, n);
+        xor_keystream(params, aes, counter, bounce, sizeof(bounce));
+        memcpy(buffer, bounce + head, n);
+        counter += CHACHA_BLOCK_SIZE / block;
+        buffer += n;
+        size -= n;
+    }
+    xor_keystream(params, aes, counter, buffer, size);
+    return used;
+}
+
+// block 수 (stub.s 의 block_span 과 같은 계산)
+static uint64_t lazy_block_count(const t_region *region, uint32_t shift)
+{
+    return ((region->vaddr + region->size - 1) >> shift) - (region->vaddr >> shift) + 1;
+}
+
+// region 의 block k 가 덮는 [*lo, *hi) (link 주소, region 안으로 자름)
+static void block_bounds(const t_region *region, uint32_t shift, uint64_t k,
+                         uint64_t *lo, uint64_t *hi)
+{
+    *lo = (region->vaddr >> shift << shift) + (k << shift);
+    *hi = *lo + (1ULL << shift);
+    if (*lo < region->vaddr)
+        *lo = region->vaddr;
+    if (*hi > region->vaddr + region->size)
+        *hi = region->vaddr + region->size;
+}
+
+// 필터를 거친 사본을 압축 (원본은 압축이 안 될 때 그대로 암호화해야 하므로 두고)
+static size_t compress_region(const uint8_t *plain, size_t size, t_filter filter,
+                              uint8_t *packed)
+{
+    if (filter == FILTER_NONE)
+        return lz4_compress(plain, size, packed);
+
+    uint8_t *filtered = arena_alloc(size);
+    if (!filtered)
+        return 0;
+    memcpy(filtered, plain, size);
+    bcj_x86_encode(filtered, size);
+    size_t packed_size = lz4_compress(filtered, size, packed);
+    arena_free(filtered);
+    return packed_size;
+}
+
+// region 을 LZ4 로 압축해 stub 뒤에 붙임. 한 페이지도 못 줄이면 (파일에서 hole 로
+// 만들 수 있는 게 없으면) 건너뛰고 FALSE
+static int pack_region(t_stub_image *stub, t_region *region, const uint8_t *plain,
+                       t_filter filter, t_pack_stats *stats)
+{
+    if (region->size > UINT32_MAX)
+        return FALSE;
+    uint8_t *packed = arena_alloc(LZ4_COMPRESS_BOUND(region->size));
+    if (!packed)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+
+    size_t packed_size = compress_region(plain, region->size, filter, packed);
+    if (packed_size == 0 || packed_size + PAGE_SIZE > region->size)
+    {
+        arena_free(packed);
+        if (packed_size == 0)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+        print_debug("    [!] 0x%lx bytes at 0x%lx do not compress (0x%lx), stored as is\n",
+            region->size, region->vaddr, packed_size);
+        stats->skipped++;
+        return FALSE;
+    }
+    int ret = append_stub(stub, packed, packed_size, &region->packed_offset);
+    arena_free(packed);
+    if (ret < 0)
+        return -1;
+    region->packed_size = (uint32_t)packed_size;
+    stats->raw += region->size;
+    stats->packed += packed_size;
+    stats->compressed++;
+    return TRUE;
+}
+
+// page (link 주소) 가 region 에 걸치면 그 block 번호
+static int profile_block(const t_region *region, uint32_t shift, uint64_t page, uint64_t *block)
+{
+    if (page + PAGE_SIZE <= region->vaddr || page >= region->vaddr + region->size)
+        return FALSE;
+    if (page < region->vaddr)
+        page = region->vaddr;
+    *block = (page >> shift) - (region->vaddr >> shift);
+    return TRUE;
+}
+
+// blob 안의 chunk 순서: 바로 푸는 처음/마지막 block, profile 의 touch 순서, 나머지
+// (시작할 때 읽는 chunk 들이 붙어 있도록. stub 은 표로 찾으므로 순서는 자유)
+static uint64_t *chunk_order(const t_region *region, uint32_t shift, const t_profile *profile,
+                             uint64_t count)
+{
+    uint64_t    *order = arena_alloc(count * sizeof(*order));
+    uint8_t     *placed = arena_calloc(count, 1);
+    uint64_t    n = 0;
+    uint64_t    block;
+
+    if (!order || !placed)
+    {
+        arena_free(order);
+        arena_free(placed);
+        return NULL;
+    }
+    order[n++] = 0;
+    placed[0] = 1;
+    if (!placed[count - 1])
+    {
+        order[n++] = count - 1;
+        placed[count - 1] = 1;
+    }
+    for (size_t i = 0; profile && i < profile->count; i++)
+    {
+        if (profile_block(region, shift, profile->pages[i], &block) && !placed[block])
+        {
+            order[n++] = block;
+            placed[block] = 1;
+        }
+    }
+    for (uint64_t k = 0; k < count; k++)
+        if (!placed[k])
+            order[n++] = k;
+    arena_free(placed);
+    return order;
+}
+
+// --incremental: block 하나의 plain hash 와, 이전 출력에서 가져왔으면 그때의 counter
+typedef struct s_reuse
+{
+    uint64_t    hash;
+    uint64_t    encoded_hash;
+    uint32_t    counter;
+    int         reused;
+}   t_reuse;
+
+// 이전 출력에 같은 block 의 압축 chunk 가 있으면 (이전 counter 로 암호화된 채) dst 로 가져옴.
+// 반환: chunk 크기, 없으면 0 (새로 압축)
+static size_t reuse_block(t_repack *repack, t_reuse *reuse, uint64_t vaddr,
+                          const uint8_t *plain, size_t size, uint8_t *dst)
+{
+    t_chunk_record  want = { .vaddr = vaddr, .size = size, .compressed = TRUE };
+    t_chunk_record  found;
+
+    want.hash = xxh64(plain, size, 0);
+    reuse->hash = want.hash;
+    if (!repack_reuse(repack, &want, dst, LZ4_COMPRESS_BOUND(size), &found))
+        return 0;
+    reuse->reused = TRUE;
+    reuse->counter = found.counter;
+    reuse->encoded_hash = found.encoded_hash;
+    return found.encoded_size;
+}
+
+// --incremental: blob 을 통째로 암호화하는 대신 chunk 마다. 가져온 chunk 는 counter 가 같으면
+// 그대로 두고, 앞의 chunk 크기가 바뀌어 밀렸으면 이전 keystream 을 벗기고 다시 씌움
+static int encrypt_blocks(t_stub_image *stub, const t_region *region, t_repack *repack,
+                          const t_aes *aes, const t_reuse *reuse, uint32_t shift,
+                          uint32_t data_offset)
+{
+    t_stub_params   *params = stub->params;
+    uint32_t        *entries = (uint32_t *)(stub->code + region->packed_offset);
+    uint64_t        lo;
+    uint64_t        hi;
+
+    for (uint64_t k = 0; k < lazy_block_count(region, shift); k++)
+    {
+        uint8_t     *data = stub->code + entries[k * 2];
+        uint32_t    size = entries[k * 2 + 1];
+        uint32_t    counter = region->counter + cipher_blocks(params, entries[k * 2] - data_offset);
+        int         same = reuse[k].reused && reuse[k].counter == counter;
+
+        block_bounds(region, shift, k, &lo, &hi);
+        if (!same)
+        {
+            if (reuse[k].reused)
+                encrypt_region(params, aes, reuse[k].counter, data, size, 0);
+            encrypt_region(params, aes, counter, data, size, 0);
+        }
+        if (!reuse[k].reused)
+            repack->encoded += hi - lo;
+        t_chunk_record record = { lo, hi - lo, reuse[k].hash, repack->stub_offset + entries[k * 2],
+                                  size, same ? reuse[k].encoded_hash : xxh64(data, size, 0),
+                                  counter, TRUE };
+        if (repack_add(repack, &record) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+// --incremental 의 제자리 암호화: region 을 block 단위로 나눠 plain 과 counter 가 같은 block 은
+// 이전 출력의 암호문을 그대로 가져옴 (encrypt_region 한 번과 같은 결과). 반환: 쓴 cipher block 수
+static int encrypt_plain_blocks(t_stub_params *params, const t_aes *aes, t_repack *repack,
+                                const t_region *region, uint8_t *plain, uint64_t file_offset,
+                                uint32_t shift, uint32_t *used)
+{
+    uint64_t        lo;
+    uint64_t        hi;
+    t_chunk_record  found;
+
+    for (uint64_t k = 0; k < lazy_block_count(region, shift); k++)
+    {
+        block_bounds(region, shift, k, &lo, &hi);
+        uint8_t *data = plain + (lo - region->vaddr);
+        uint64_t skip = (lo & ~(uint64_t)63) - (region->vaddr & ~(uint64_t)63);
+        t_chunk_record record = { .vaddr = lo, .size = hi - lo, .hash = xxh64(data, hi - lo, 0),
+                                  .offset = file_offset + (lo - region->vaddr),
+                                  .encoded_size = hi - lo,
+                                  .counter = region->counter + cipher_blocks(params, skip) };
+
+        if (repack_reuse(repack, &record, data, hi - lo, &found))
+            record.encoded_hash = found.encoded_hash;
+        else
+        {
+            encrypt_region(params, aes, record.counter, data, hi - lo, lo % CHACHA_BLOCK_SIZE);
+            record.encoded_hash = xxh64(data, hi - lo, 0);
+            repack->encoded += hi - lo;
+        }
+        if (repack_add(repack, &record) < 0)
+            return -1;
+    }
+    *used = cipher_blocks(params, region->vaddr % CHACHA_BLOCK_SIZE + region->size);
+    return 0;
+}
+
+// block 으로 나눈 pack_region: block 마다 따로 압축해서 stub 이 아무 block 이나
+// (--lazy 는 처음 건드릴 때, 아니면 여러 thread 가 동시에) 풀 수 있게 함
+// blob = {uint32 offset (stub 기준), uint32 크기} x block 수 + 64 bytes 정렬된 chunk 들
+// *data_offset 은 첫 chunk 위치 (여기서부터 끝까지가 암호화 대상). 첫 chunk 는 항상 block 0
+static int pack_region_blocks(t_stub_image *stub, t_region *region, const uint8_t *plain,
+                              const t_pack_config *config, const t_aes *aes, uint32_t shift,
+                              t_pack_stats *stats, uint32_t *data_offset)
+{
+    uint64_t    count = lazy_block_count(region, shift);
+    size_t      table = (count * sizeof(uint32_t) * 2 + 63) & ~(size_t)63;
+
+    if (region->size > UINT32_MAX)
+        return FALSE;
+    uint8_t *blob = arena_alloc(table + LZ4_COMPRESS_BOUND(region->size) + count * (16 + 64));
+    uint64_t *order = chunk_order(region, shift, config->profile, count);
+    t_reuse *reuse = config->repack ? arena_calloc(count, sizeof(*reuse)) : NULL;
+    if (!blob || !order || (config->repack && !reuse))
+    {
+        arena_free(blob);
+        arena_free(order);
+        arena_free(reuse);
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    }
+
+    uint32_t    *entries = (uint32_t *)blob;
+    size_t      pos = table;
+    size_t      end = table;
+    memset(blob, 0, table);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        uint64_t k = order[i];
+        uint64_t lo;
+        uint64_t hi;
+        block_bounds(region, shift, k, &lo, &hi);
+
+        size_t n = 0;
+        if (reuse)
+            n = reuse_block(config->repack, &reuse[k], lo, plain + (lo - region->vaddr),
+                hi - lo, blob + pos);
+        if (n == 0)
+            n = compress_region(plain + (lo - region->vaddr), hi - lo, config->filter, blob + pos);
+        if (n == 0)
+        {
+            arena_free(blob);
+            arena_free(order);
+            arena_free(reuse);
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+        }
+        entries[k * 2] = pos;
+        entries[k * 2 + 1] = n;
+        end = pos + n;
+        pos = (end + 63) & ~(size_t)63;
+        memset(blob + end, 0, pos - end);   // 출력에 heap 쓰레기가 섞이지 않도록
+    }
+    arena_free(order);
+    if (end + PAGE_SIZE > region->size)
+    {
+        arena_free(blob);
+        arena_free(reuse);
+        print_debug("    [!] 0x%lx bytes at 0x%lx do not compress (0x%lx), stored as is\n",
+            region->size, region->vaddr, end);
+        stats->skipped++;
+        return FALSE;
+    }
+
+    int ret = append_stub(stub, blob, end, &region->packed_offset);
+    arena_free(blob);
+    if (ret < 0)
+    {
+        arena_free(reuse);
+        return -1;
+    }
+    entries = (uint32_t *)(stub->code + region->packed_offset);
+    for (uint64_t k = 0; k < count; k++)
+        entries[k * 2] += region->packed_offset;
+    region->packed_size = (uint32_t)end;
+    *data_offset = region->packed_offset + table;
+    if (reuse)
+    {
+        ret = encrypt_blocks(stub, region, config->repack, aes, reuse, shift, *data_offset);
+        arena_free(reuse);
+        if (ret < 0)
+            return -1;
+    }
+    stats->raw += region->size;
+    stats->packed += end;
+    stats->compressed++;
+    return TRUE;
+}
+
+static void print_ratio(const t_pack_stats *stats)
+{
+    if (stats->compressed == 0)
+    {
+        printf("compress: no region compressed (%d skipped)\n", stats->skipped);
+        return;
+    }
+    printf("compress: %lu -> %lu bytes (%.1f%%), %d region(s), %d skipped\n",
+        stats->raw, stats->packed, 100.0 * stats->packed / stats->raw,
+        stats->compressed, stats->skipped);
+}
+
+// --profile: 시작할 때 건드리는 block 목록 (처음 건드린 순서) 을 stub 뒤에 붙임
+// 처음/마지막 block 은 어차피 바로 풀기 때문에 뺌
+static int add_hot_blocks(t_stub_image *stub, const t_profile *profile, uint32_t shift)
+{
+    t_stub_params   *params = stub->params;
+    uint64_t        first[MAX_REGIONS];     // region 의 첫 block 의 전체 번호
+    uint64_t        total = 0;
+    uint32_t        count = 0;
+    uint64_t        block;
+
+    for (uint32_t r = 0; r < params->region_count; r++)
+    {
+        first[r] = total;
+        total += lazy_block_count(&params->regions[r], shift);
+    }
+    uint32_t *hot = arena_alloc(profile->count * sizeof(*hot) + 1);
+    uint8_t *seen = arena_calloc(total, 1);
+    if (!hot || !seen)
+    {
+        arena_free(hot);
+        arena_free(seen);
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    }
+    for (size_t i = 0; i < profile->count; i++)
+    {
+        for (uint32_t r = 0; r < params->region_count; r++)
+        {
+            const t_region *region = &params->regions[r];
+            if (!profile_block(region, shift, profile->pages[i], &block)
+                || block == 0 || block + 1 == lazy_block_count(region, shift)
+                || block >= (1U << HOT_BLOCK_BITS) || seen[first[r] + block])
+                continue;
+            seen[first[r] + block] = 1;
+            hot[count++] = r << HOT_BLOCK_BITS | (uint32_t)block;
+        }
+    }
+    arena_free(seen);
+
+    uint32_t offset = 0;
+    int ret = count ? append_stub(stub, hot, count * sizeof(*hot), &offset) : 0;
+    arena_free(hot);
+    if (ret < 0)
+        return -1;
+    stub->params->hot_offset = offset;
+    stub->params->hot_count = count;
+    print_debug("    [+] Profile: %zu page(s) -> %u hot block(s) unpacked at startup\n",
+        profile->count, count);
+    return 0;
+}
+
+// 실행 segment i 에서 실행 section 들이 걸친 범위를 region 으로 (*offset = 파일 위치)
+static int exec_region(t_elf elf, int i, t_region *region, uint64_t *offset)
+{
+    Elf64_Phdr  *phdr = &elf.phdrs[i];
+    uint64_t    start;
+    uint64_t    end;
+
+    if (phdr->p_type != PT_LOAD || !(phdr->p_flags & PF_X))
+        return FALSE;
+    if (!find_exec_range(elf, phdr, &start, &end))
+    {
+        print_debug("    [!] No executable sections in segment %d, skipped\n", i);
+        return FALSE;
+    }
+    *region = (t_region){0};
+    region->vaddr = phdr->p_vaddr + (start - phdr->p_offset);
+    region->size = end - start;
+    region->prot = flags_to_prot(phdr->p_flags);
+    *offset = start;
+    return TRUE;
+}
+
+// --stream 으로 흘려 보내는 region 하나
+typedef struct s_stream_region
+{
+    t_stub_params   *params;
+    const t_aes     *aes;
+    t_region        *region;
+    uint64_t        file_offset;    // region 의 입력 파일 위치
+    t_stub_image    *stub;
+    const uint64_t  *order;         // 압축: chunk 순서 (chunk_order)
+    uint32_t        shift;
+    uint64_t        stub_offset;    // 출력에서 stub 이 놓이는 위치
+    uint64_t        first;          // 첫 chunk 의 stub 기준 위치 (tail)
+    uint64_t        pos;            // 다음 chunk 자리
+    uint64_t        end;            // 마지막 chunk 의 끝
+}   t_stream_region;
+
+// 통째로 암호화: chunk 마다 keystream 을 주소에 맞춰 이어 붙임 (encrypt_region 한 번과 같은 결과)
+static int encrypt_chunk(t_chunk *chunk, size_t index, void *arg)
+{
+    t_stream_region *s = arg;
+    uint64_t        vaddr = s->region->vaddr + (chunk->offset - s->file_offset);
+    uint64_t        skip = (vaddr & ~(uint64_t)63) - (s->region->vaddr & ~(uint64_t)63);
+
+    (void)index;
+    encrypt_region(s->params, s->aes, s->region->counter + cipher_blocks(s->params, skip),
+        chunk->in, chunk->size, vaddr % CHACHA_BLOCK_SIZE);
+    return 0;
+}
+
+// block 하나를 압축해 tail 의 다음 자리에 암호화해서 놓음 (pack_region_blocks 와 같은 배치)
+static int pack_chunk(t_chunk *chunk, size_t index, void *arg)
+{
+    t_stream_region *s = arg;
+    uint32_t        *entries = (uint32_t *)(s->stub->code + s->region->packed_offset);
+    uint64_t        k = s->order[index];
+
+    size_t n = compress_region(chunk->in, chunk->size, s->params->filter, chunk->out);
+    if (n == 0)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    entries[k * 2] = (uint32_t)s->pos;
+    entries[k * 2 + 1] = (uint32_t)n;
+    encrypt_region(s->params, s->aes, s->region->counter + cipher_blocks(s->params, s->pos - s->first),
+        chunk->out, n, 0);
+    chunk->data = chunk->out;
+    chunk->data_size = n;
+    chunk->write_offset = s->stub_offset + s->pos;
+    s->end = s->pos + n;
+    s->pos = (s->end + 63) & ~(uint64_t)63;
+    return 0;
+}
+
+static int stream_plain(const t_file *file, const t_output *out, t_stream_region *s)
+{
+    uint64_t    size = s->region->size;
+    size_t      count = (size + STREAM_CHUNK - 1) / STREAM_CHUNK;
+    t_patch     *spans = arena_alloc(count * sizeof(*spans));
+
+    if (!spans)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t done = i * STREAM_CHUNK;
+        spans[i] = (t_patch){ s->file_offset + done,
+                              size - done < STREAM_CHUNK ? size - done : STREAM_CHUNK };
+    }
+    int ret = stream_spans(file->fd, out->fd, spans, count, 0, encrypt_chunk, s);
+    arena_free(spans);
+    return ret;
+}
+
+// 압축 region: block 을 chunk_order 순서로 읽어 압축한 chunk 를 stub 의 tail (s->first 부터) 에 씀.
+// 한 페이지도 못 줄이면 써 둔 tail 을 잘라 내고 FALSE
+static int stream_blocks(const t_file *file, const t_output *out, t_stream_region *s,
+                         const t_profile *profile, t_pack_stats *stats)
+{
+    t_region    *region = s->region;
+    uint64_t    count = lazy_block_count(region, s->shift);
+    size_t      table = (count * sizeof(uint32_t) * 2 + 63) & ~(size_t)63;
+    uint64_t    lo;
+    uint64_t    hi;
+
+    // chunk 위치는 stub 기준 uint32
+    if (s->first + LZ4_COMPRESS_BOUND(region->size) + count * 64 > UINT32_MAX)
+        return FALSE;
+    uint64_t *order = chunk_order(region, s->shift, profile, count);
+    t_patch *spans = arena_alloc(count * sizeof(*spans));
+    if (!order || !spans)
+    {
+        arena_free(order);
+        arena_free(spans);
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    }
+    for (uint64_t i = 0; i < count; i++)
+    {
+        block_bounds(region, s->shift, order[i], &lo, &hi);
+        spans[i] = (t_patch){ s->file_offset + (lo - region->vaddr), hi - lo };
+    }
+    s->order = order;
+    s->pos = s->first;
+    s->end = s->first;
+    int ret = stream_spans(file->fd, out->fd, spans, count,
+        LZ4_COMPRESS_BOUND(1UL << s->shift), pack_chunk, s);
+    arena_free(order);
+    arena_free(spans);
+    if (ret < 0)
+        return -1;
+
+    uint64_t packed = table + (s->end - s->first);
+    if (packed + PAGE_SIZE > region->size)
+    {
+        print_debug("    [!] 0x%lx bytes at 0x%lx do not compress (0x%lx), stored as is\n",
+            region->size, region->vaddr, packed);
+        stats->skipped++;
+        if (ftruncate(out->fd, (off_t)(s->stub_offset + s->first)) < 0)
+            return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+        return FALSE;
+    }
+    region->packed_size = (uint32_t)packed;
+    stats->raw += region->size;
+    stats->packed += packed;
+    stats->compressed++;
+    return TRUE;
+}
+
+// --stream: region 을 모두 params 에 올리고 chunk 표와 hot 목록까지 붙여 stub 크기를 고정한 뒤,
+// region 마다 입력 fd 에서 읽어 암호화 (압축) 한 결과를 out->fd 에 바로 씀.
+// 압축한 chunk 는 stub 뒤 (tail) 에 쌓이므로 메모리에는 chunk 표만 남음
+static int stream_regions(t_elf elf, const t_file *file, const t_output *out, t_stub_image *stub,
+                          const t_pack_config *config, const t_aes *aes, uint32_t shift,
+                          t_pack_stats *stats)
+{
+    uint64_t    offsets[MAX_REGIONS];
+    t_region    region;
+    uint32_t    count = 0;
+
+    for (int i = 0; i < elf.ehdr->e_phnum && count < MAX_REGIONS; i++)
+    {
+        if (!exec_region(elf, i, &region, &offsets[count]))
+            continue;
+        if (config->compress && region.size <= UINT32_MAX)
+        {
+            size_t  table = (lazy_block_count(&region, shift) * sizeof(uint32_t) * 2 + 63) & ~(size_t)63;
+            void    *zero = arena_calloc(1, table);
+            int     ret = zero ? append_stub(stub, zero, table, &region.packed_offset)
+                               : print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+            arena_free(zero);
+            if (ret < 0)
+                return -1;
+        }
+        stub->params->regions[count++] = region;
+    }
+    stub->params->region_count = count;
+    if (config->lazy_shift && config->profile && add_hot_blocks(stub, config->profile, shift) < 0)
+        return -1;
+
+    t_stream_region s = { .params = stub->params, .aes = aes, .stub = stub, .shift = shift,
+                          .stub_offset = out->stub_offset };
+    uint64_t tail = (stub->size + 63) & ~(size_t)63;
+    uint32_t counter = 0;
+    for (uint32_t r = 0; r < count; r++)
+    {
+        s.region = &s.params->regions[r];
+        s.region->counter = counter;
+        s.file_offset = offsets[r];
+        s.first = tail;
+
+        int packed = s.region->packed_offset ? stream_blocks(file, out, &s, config->profile, stats) : FALSE;
+        if (packed < 0)
+            return -1;
+        if (packed)
+        {
+            // 원본 자리는 0 으로 (hole)
+            counter += cipher_blocks(s.params, s.end - s.first);
+            tail = (s.end + 63) & ~(uint64_t)63;
+            stub->tail = s.end - stub->size;
+            if (zero_range(out->fd, offsets[r], s.region->size) == FALSE)
+                return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+        }
+        else
+        {
+            s.region->packed_offset = 0;    // 잡아 둔 표 자리는 비운 채 남음
+            if (stream_plain(file, out, &s) < 0)
+                return -1;
+            counter += cipher_blocks(s.params, s.region->vaddr % CHACHA_BLOCK_SIZE + s.region->size);
+        }
+        print_debug("    [+] Streamed 0x%lx bytes at 0x%lx%s\n",
+            s.region->size, s.region->vaddr, packed ? " (compressed)" : "");
+    }
+    return 0;
+}
+
+// 실행 region 들의 크기 합 (--threads 를 안 줬을 때 나눠 풀지 정하는 기준)
+static uint64_t exec_size(t_elf elf)
+{
+    uint64_t    total = 0;
+    uint64_t    start;
+    uint64_t    end;
+
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+    {
+        Elf64_Phdr *phdr = &elf.phdrs[i];
+        if (phdr->p_type == PT_LOAD && (phdr->p_flags & PF_X)
+            && find_exec_range(elf, phdr, &start, &end))
+            total += end - start;
+    }
+    return total;
+}
+
+static int exec_count(t_elf elf)
+{
+    int         count = 0;
+    uint64_t    start;
+    uint64_t    end;
+
+    for (int i = 0; i < elf.ehdr->e_phnum; i++)
+    {
+        Elf64_Phdr *phdr = &elf.phdrs[i];
+        if (phdr->p_type == PT_LOAD && (phdr->p_flags & PF_X)
+            && find_exec_range(elf, phdr, &start, &end))
+            count++;
+    }
+    return count;
+}
+
+// --huge-pages: region 안에서 2MB 정렬된 bytes (load bias 가 2MB 정렬일 때)
+static uint64_t huge_bytes(const t_stub_params *params)
+{
+    uint64_t total = 0;
+
+    for (uint32_t r = 0; r < params->region_count; r++)
+    {
+        const t_region  *region = &params->regions[r];
+        uint64_t        start = (region->vaddr + HUGE_PAGE_SIZE - 1) & ~(uint64_t)(HUGE_PAGE_SIZE - 1);
+        uint64_t        end = (region->vaddr + region->size) & ~(uint64_t)(HUGE_PAGE_SIZE - 1);
+
+        if (start < end)
+            total += end - start;
+    }
+    return total;
+}
+
+// --cache / --key: 같은 입력과 옵션이면 같은 출력이 나오도록 key 와 nonce 를 seed 에서 유도.
+// --key 를 줬으면 key 는 그대로 쓰고 nonce 만 (입력마다 다르게) 유도
+static void derive_key(t_stub_params *params, const t_pack_config *config)
+{
+    uint8_t derived[sizeof(params->key) + 12];
+
+    blake2b(derived, sizeof(derived), config->seed, CACHE_KEY_SIZE);
+    memcpy(params->key, config->key ? config->key : derived, sizeof(params->key));
+    memcpy(&params->nonce[1], derived + sizeof(params->key), 12);
+}
+
+int encrypt_payload(t_elf elf, t_file *file, t_output *out,
+                    t_stub_image *stub, const t_pack_config *config)
+{
+    t_aes           aes = {0};
+    t_pack_stats    stats = {0};
+    t_stub_params   *params = stub->params;
+    uint32_t        shift = config->lazy_shift;
+    uint32_t        threads = config->threads ? config->threads : PARALLEL_DEFAULT_THREADS;
+    uint64_t        states = 0;
+
+    // stub 의 region 표는 MAX_REGIONS 개. 넘는 segment 를 평문으로 남기지 않도록 실패
+    if (exec_count(elf) > MAX_REGIONS)
+        return print_error(TOO_MANY_REGIONS, ERRNO_FALSE);
+
+    // lazy 가 아니면 큰 region (또는 --threads) 을 block 으로 나눠 stub 이 여러 thread 로 품
+    if (!shift && threads > 1 && (config->threads || exec_size(elf) >= PARALLEL_MIN_SIZE))
+        shift = PARALLEL_SHIFT;
+    // --stream 은 region 을 통째로 압축할 수 없으므로 (메모리에 다 올려야 함) block 마다.
+    // --incremental 도 block 단위로 바뀐 것만 다시 압축하므로 같은 배치
+    if (!shift && (out->fd >= 0 || config->repack) && config->compress)
+        shift = PARALLEL_SHIFT;
+
+    // --incremental: 이전 출력의 key / nonce 를 이어 써야 바뀌지 않은 암호문을 그대로 쓸 수 있음
+    if (config->repack && config->repack->valid)
+    {
+        memcpy(params->key, config->repack->key, sizeof(params->key));
+        memcpy(&params->nonce[1], config->repack->nonce, 12);
+    }
+    else if (config->seed)
+        derive_key(params, config);
+    else if (getrandom(params->key, sizeof(params->key), 0) != sizeof(params->key)
+        || getrandom(&params->nonce[1], 12, 0) != 12)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    params->nonce[0] = 0;
+    params->region_count = 0;
+    if (config->repack)
+    {
+        memcpy(config->repack->key, params->key, sizeof(params->key));
+        memcpy(config->repack->nonce, &params->nonce[1], 12);
+        config->repack->stub_offset = out->stub_offset;
+    }
+    params->cipher = config->cipher;
+    params->filter = config->compress ? config->filter : FILTER_NONE;
+    if (config->profile && config->profile->entry != elf.ehdr->e_entry)
+        return print_error(INVALID_PROFILE, ERRNO_FALSE);
+
+    // AES 는 key schedule 을 여기서 확장해 stub 옆에 심음 (stub 은 AESENC 만 수행)
+    if (config->cipher != CIPHER_CHACHA20)
+    {
+        aes_expand_key(&aes, (const uint8_t *)params->key,
+                       config->cipher == CIPHER_AES128_CTR ? 128 : 256);
+        params->aes_rounds = aes.rounds;
+        memcpy(params->round_keys, aes.round_keys, sizeof(params->round_keys));
+    }
+
+    uint32_t counter = 0;
+    for (int i = 0; i < elf.ehdr->e_phnum && out->fd < 0; i++)
+    {
+        t_region    region;
+        uint64_t    start;
+
+        if (!exec_region(elf, i, &region, &start))
+            continue;
+
+        uint8_t     *plain = (uint8_t *)file->buffer + start;
+        uint32_t    data_offset = 0;
+        region.counter = counter;
+
+        int packed = FALSE;
+        if (config->compress && shift)
+            packed = pack_region_blocks(stub, &region, plain, config, &aes, shift, &stats, &data_offset);
+        else if (config->compress)
+        {
+            packed = pack_region(stub, &region, plain, params->filter, &stats);
+            data_offset = region.packed_offset;
+        }
+        if (packed < 0)
+            return -1;
+        params = stub->params;
+        if (packed && config->repack)
+        {
+            // chunk 마다 이미 암호화함 (encrypt_blocks)
+            counter += cipher_blocks(params, region.packed_offset + region.packed_size - data_offset);
+            memset(plain, 0, region.size);
+        }
+        else if (packed)
+        {
+            // 암호화는 stub 안의 blob 에, 원본 자리는 0 으로 (출력에서 hole 이 됨)
+            counter += encrypt_region(params, &aes, counter, stub->code + data_offset,
+                region.packed_offset + region.packed_size - data_offset, 0);
+            memset(plain, 0, region.size);
+        }
+        else if (config->repack)
+        {
+            uint32_t used;
+            if (encrypt_plain_blocks(params, &aes, config->repack, &region, plain, start,
+                                     shift ? shift : PARALLEL_SHIFT, &used) < 0)
+                return -1;
+            counter += used;
+        }
+        else
+        {
+            // MAP_PRIVATE 버퍼에 바로 암호화 (해당 페이지만 copy-on-write)
+            counter += encrypt_region(params, &aes, counter, plain, region.size,
+                region.vaddr % CHACHA_BLOCK_SIZE);
+        }
+        if (add_patch(out, file, plain, region.size) == FALSE)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+        params->regions[params->region_count++] = region;
+
+        print_debug("    [+] Encrypted 0x%lx bytes at 0x%lx (segment %d%s)\n",
+            region.size, region.vaddr, i, packed ? ", compressed" : "");
+    }
+    // --stream: 출력이 열려 있으면 region 을 메모리에 올리지 않고 바로 씀
+    if (out->fd >= 0 && stream_regions(elf, file, out, stub, config, &aes, shift, &stats) < 0)
+        return -1;
+    params = stub->params;
+
+    if (params->region_count == 0)
+        return print_error(INVALID_ELF, ERRNO_FALSE);
+
+    if (out->fd < 0 && config->lazy_shift && config->profile
+        && add_hot_blocks(stub, config->profile, shift) < 0)
+        return -1;
+    params = stub->params;
+
+    // block 상태 byte 는 파일에 없이 stub segment 의 bss 로 (p_memsz 만 늘어남)
+    if (shift)
+    {
+        for (uint32_t r = 0; r < params->region_count; r++)
+            states += lazy_block_count(&params->regions[r], shift);
+        params->block_shift = shift;
+        params->state_offset = (uint32_t)(stub->size + stub->tail);
+        params->lazy = config->lazy_shift != 0;
+        params->max_threads = threads;
+        stub->bss = states;
+        if (params->lazy)
+            print_debug("    [+] Lazy unpack: %lu block(s) of 0x%x bytes\n", states, 1U << shift);
+        else
+            print_debug("    [+] Parallel unpack: %lu block(s) of 0x%x bytes, up to %u threads\n",
+                states, 1U << shift, threads);
+    }
+    // --lazy 는 block 마다 mprotect 해서 huge page 가 다시 쪼개지므로 무시
+    if (config->huge_pages && !params->lazy)
+    {
+        params->huge_pages = TRUE;
+        print_debug("    [+] Huge pages: 0x%lx bytes of text in 2MB pages\n", huge_bytes(params));
+    }
+    if (config->quiet)
+        return 0;
+    if (config->compress)
+        print_ratio(&stats);
+    print_key(params->key, config->cipher == CIPHER_AES128_CTR ? 16 : 32);
+    return 0;
+}
@@ -10,35 +10,71 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "main.h"
 #include "print_utils.h"
+#include <errno.h>
 
-inline int print_error(error_t error, int use_errno)
+static int g_debug = 1;    // batch 는 파일마다의 진행 상황을 끔
+static __thread t_last_error *g_capture;   // libwoody: 찍지 않고 여기에 남김
+
+const char *error_message(t_error error)
 {
-    if (use_errno)
-        perror("Error");
     switch (error)
     {
     case WRONG_ARGS:
-            fprintf(stderr, "Usage: elf_packer <input_elf_file>\n");
-            break;
+        return "Invalid arguments.";
     case FILE_NOT_FOUND:
-            fprintf(stderr, "Error: File not found.\n");
-            break;
+        return "File not found.";
     case INVALID_ELF:
-            fprintf(stderr, "Error: Invalid ELF file.\n");
-            break;
+        return "Invalid ELF file.";
     case MEMORY_ALLOCATION_FAILED:
-            fprintf(stderr, "Error: Memory allocation failed.\n");
+        return "Memory allocation failed.";
+    case INVALID_PROFILE:
+        return "Invalid or mismatched page profile.";
+    case NO_LAYOUT:
+        return "No room for the stub with this --layout.";
+    case TOO_MANY_REGIONS:
+        return "Too many executable segments (at most 8 can be encrypted).";
+    default:
+        assert(0 && "Unknown error type");
+    }
+    return NULL;
+}
+
+// 이 thread 의 print_error 를 last 에 남김 (처음 것만, 원인에 가까움). NULL 이면 다시 stderr 로
+void capture_errors(t_last_error *last)
+{
+    g_capture = last;
+}
+
+inline int print_error(t_error error, int use_errno)
+{
+    if (g_capture)
+    {
+        if (!g_capture->set)
+            *g_capture = (t_last_error){ TRUE, error, use_errno ? errno : 0 };
+        return -1;
+    }
+    if (use_errno)
+        perror("Error");
+    switch (error)
+    {
+    case WRONG_ARGS:
+            fprintf(stderr, "Usage: woody_woodpacker [--cipher chacha20|aes128|aes256] [--kernel <name>] [--compress] [--bcj] [--lazy] [--lazy-block <bytes>] [--profile <file>] [--threads <n>] [--stream] [--telemetry] [--huge-pages] [--layout auto|cave|extend|note|stack|phdr] [--cache <dir>] [--cache-size <n>[K|M|G]] [--key <64 hex>] [--incremental <previous output>] [-o <output>] <input_elf_file>\n"
+                            "       woody_woodpacker [options] [-j <n>] [--out-dir <dir>] [--manifest <file>] [--no-uring] <input>...\n"
+                            "       woody_woodpacker [options] [-j <n>] [--out-dir <dir>] [--debounce <ms>] --watch <dir>\n"
+                            "       woody_woodpacker [-j <n>] --serve <socket>\n"
+                            "       (any mode) [--stats <file|->] [--stats-counters]\n");
             break;
     default:
-        assert(0 && "Unknown error type");        
+            fprintf(stderr, "Error: %s\n", error_message(error));
     }
     return -1;
 }
 
 inline int print_debug(const char *format, ...)
 {
-    if (!DEBUG)
+    if (!DEBUG || !g_debug)
         return 0;
     
     va_list args;
@@ -46,4 +82,9 @@ inline int print_debug(const char *format, ...)
     int ret = vprintf(format, args);
     va_end(args);
     return ret;
-}
\ No newline at end of file
+}
+
+void set_debug(int enabled)
+{
+    g_debug = enabled;
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/14 10:12:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/14 16:48:05 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "profile.h"
+#include "print_utils.h"
+#include <string.h>
+
+int load_profile(const char *path, t_profile *profile)
+{
+    char    line[128];
+    size_t  cap = 0;
+
+    *profile = (t_profile){0};
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    while (fgets(line, sizeof(line), fp))
+    {
+        char        *end;
+        uint64_t    value;
+
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+        if (strncmp(line, "entry ", 6) == 0)
+        {
+            profile->entry = strtoull(line + 6, &end, 16);
+            continue;
+        }
+        value = strtoull(line, &end, 16);
+        if (end == line)
+        {
+            fclose(fp);
+            free_profile(profile);
+            return print_error(INVALID_PROFILE, ERRNO_FALSE);
+        }
+        if (profile->count == cap)
+        {
+            cap = cap ? cap * 2 : 256;
+            uint64_t *pages = realloc(profile->pages, cap * sizeof(*pages));
+            if (!pages)
+            {
+                fclose(fp);
+                free_profile(profile);
+                return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+            }
+            profile->pages = pages;
+        }
+        profile->pages[profile->count++] = value;
+    }
+    fclose(fp);
+    return 0;
+}
+
+int save_profile(const char *path, const t_profile *profile)
+{
+    FILE *fp = fopen(path, "w");
+    if (!fp)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    fprintf(fp, "%s (%zu pages, first touch order)\n", PROFILE_MAGIC, profile->count);
+    fprintf(fp, "entry 0x%lx\n", profile->entry);
+    for (size_t i = 0; i < profile->count; i++)
+        fprintf(fp, "0x%lx\n", profile->pages[i]);
+    if (fclose(fp) != 0)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    return 0;
+}
+
+void free_profile(t_profile *profile)
+{
+    free(profile->pages);
+    profile->pages = NULL;
+    profile->count = 0;
+}
@@ -0,0 +1,220 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   repack.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/27 16:41:19 by insub             #+#    #+#             */
+/*   Updated: 2026/01/27 16:41:19 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "repack.h"
+#include "xxh64.h"
+#include "print_utils.h"
+#include "arena.h"
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <inttypes.h>
+
+static int parse_hex(const char *str, uint8_t *out, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+        if (sscanf(str + i * 2, "%2hhx", &out[i]) != 1)
+            return FALSE;
+    return str[size * 2] == '\n' || str[size * 2] == '\0';
+}
+
+static void print_hex(FILE *fp, const char *name, const void *data, size_t size)
+{
+    fprintf(fp, "%s ", name);
+    for (size_t i = 0; i < size; i++)
+        fprintf(fp, "%02x", ((const uint8_t *)data)[i]);
+    fprintf(fp, "\n");
+}
+
+static int push_record(t_chunk_record **records, size_t *count, size_t *cap,
+                       const t_chunk_record *record)
+{
+    if (*count == *cap)
+    {
+        size_t          grown = *cap ? *cap * 2 : 256;
+        t_chunk_record  *tmp = arena_realloc(*records, grown * sizeof(*tmp));
+        if (!tmp)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        *records = tmp;
+        *cap = grown;
+    }
+    (*records)[(*count)++] = *record;
+    return 0;
+}
+
+static int compare_vaddr(const void *a, const void *b)
+{
+    const t_chunk_record *ra = a;
+    const t_chunk_record *rb = b;
+
+    return (ra->vaddr > rb->vaddr) - (ra->vaddr < rb->vaddr);
+}
+
+// 이전 manifest 를 읽음. 형식이 틀리거나 옵션이 다르면 FALSE (전부 새로 pack)
+static int load_manifest(t_repack *repack, const char *path)
+{
+    char            line[256];
+    uint8_t         config[CACHE_KEY_SIZE];
+    size_t          cap = 0;
+    int             have = 0;
+    t_chunk_record  r;
+    char            kind;
+
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return FALSE;
+    if (!fgets(line, sizeof(line), fp) || strncmp(line, REPACK_MAGIC, strlen(REPACK_MAGIC)) != 0)
+    {
+        fclose(fp);
+        return FALSE;
+    }
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (strncmp(line, "config ", 7) == 0)
+            have |= parse_hex(line + 7, config, sizeof(config))
+                && memcmp(config, repack->config, sizeof(config)) == 0;
+        else if (strncmp(line, "key ", 4) == 0)
+            have |= parse_hex(line + 4, (uint8_t *)repack->key, sizeof(repack->key)) << 1;
+        else if (strncmp(line, "nonce ", 6) == 0)
+            have |= parse_hex(line + 6, (uint8_t *)repack->nonce, sizeof(repack->nonce)) << 2;
+        else if (sscanf(line, "chunk %" SCNx64 " %" SCNu64 " %" SCNx64 " %" SCNu64 " %" SCNu64
+                        " %" SCNx64 " %" SCNu32 " %c", &r.vaddr, &r.size, &r.hash, &r.offset,
+                        &r.encoded_size, &r.encoded_hash, &r.counter, &kind) == 8)
+        {
+            r.compressed = kind == 'c';
+            if (push_record(&repack->old, &repack->old_count, &cap, &r) < 0)
+                break;
+        }
+    }
+    fclose(fp);
+    if (have != 7)
+        return FALSE;
+    qsort(repack->old, repack->old_count, sizeof(*repack->old), compare_vaddr);
+    return TRUE;
+}
+
+// 이전 출력과 manifest 를 열어 둠. 없거나 옵션이 달라도 실패는 아님 (처음 pack 하는 것과 같음)
+void open_repack(t_repack *repack, const char *previous, const t_pack_config *config)
+{
+    char        path[PATH_MAX];
+    t_blake2b   ctx;
+
+    *repack = (t_repack){ .fd = -1 };
+    blake2b_init(&ctx, CACHE_KEY_SIZE);
+    blake2b_update(&ctx, REPACK_VERSION, strlen(REPACK_VERSION));
+    hash_config(&ctx, config);
+    blake2b_final(&ctx, repack->config);
+
+    // 출력이 previous 와 같아도 begin_output 이 지우고 새로 만드므로 이 fd 는 이전 내용을 가리킴
+    repack->fd = open(previous, O_RDONLY | O_CLOEXEC);
+    if (repack->fd >= 0 && snprintf(path, sizeof(path), "%s%s", previous, REPACK_SUFFIX) < (int)sizeof(path))
+        repack->valid = load_manifest(repack, path);
+    if (repack->valid)
+        print_debug("[+] Incremental: %zu chunk(s) in %s\n", repack->old_count, path);
+    else
+    {
+        print_debug("[!] Incremental: no usable manifest for %s, packing everything\n", previous);
+        repack->old_count = 0;
+    }
+}
+
+// want 와 같은 plain 을 인코딩해 둔 chunk 를 이전 출력에서 dst 로 읽음.
+// 제자리 암호화는 counter 까지 같아야 그대로 쓸 수 있음. 읽은 bytes 가 manifest 와 다르면 FALSE
+int repack_reuse(t_repack *repack, const t_chunk_record *want, uint8_t *dst,
+                 size_t capacity, t_chunk_record *found)
+{
+    t_chunk_record  *old = repack->old;
+    size_t          lo = 0;
+    size_t          hi = repack->old_count;
+
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (old[mid].vaddr < want->vaddr)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    for (; lo < repack->old_count && old[lo].vaddr == want->vaddr; lo++)
+    {
+        t_chunk_record *r = &old[lo];
+        if (r->size != want->size || r->hash != want->hash || r->compressed != want->compressed
+            || (!r->compressed && r->counter != want->counter) || r->encoded_size > capacity)
+            continue;
+        if (r->encoded_size > repack->scratch_size)
+        {
+            uint8_t *grown = arena_realloc(repack->scratch, r->encoded_size);
+            if (!grown)
+                return FALSE;
+            repack->scratch = grown;
+            repack->scratch_size = r->encoded_size;
+        }
+        if (pread(repack->fd, repack->scratch, r->encoded_size, (off_t)r->offset)
+                != (ssize_t)r->encoded_size
+            || xxh64(repack->scratch, r->encoded_size, 0) != r->encoded_hash)
+            return FALSE;
+        memcpy(dst, repack->scratch, r->encoded_size);
+        *found = *r;
+        repack->reused++;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+int repack_add(t_repack *repack, const t_chunk_record *record)
+{
+    return push_record(&repack->records, &repack->count, &repack->cap, record);
+}
+
+// 출력 옆에 manifest 를 씀 (임시 이름으로 쓰고 rename)
+int save_repack(const t_repack *repack, const char *output)
+{
+    char path[PATH_MAX];
+    char tmp[PATH_MAX];
+
+    if (snprintf(path, sizeof(path), "%s%s", output, REPACK_SUFFIX) >= (int)sizeof(path)
+        || snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp))
+        return print_error(FILE_NOT_FOUND, ERRNO_FALSE);
+    FILE *fp = fopen(tmp, "w");
+    if (!fp)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    fprintf(fp, "%s (%zu chunks)\n", REPACK_MAGIC, repack->count);
+    print_hex(fp, "config", repack->config, sizeof(repack->config));
+    print_hex(fp, "key", repack->key, sizeof(repack->key));
+    print_hex(fp, "nonce", repack->nonce, sizeof(repack->nonce));
+    for (size_t i = 0; i < repack->count; i++)
+    {
+        const t_chunk_record *r = &repack->records[i];
+        fprintf(fp, "chunk %" PRIx64 " %" PRIu64 " %016" PRIx64 " %" PRIu64 " %" PRIu64
+            " %016" PRIx64 " %" PRIu32 " %c\n", r->vaddr, r->size, r->hash, r->offset,
+            r->encoded_size, r->encoded_hash, r->counter, r->compressed ? 'c' : 'p');
+    }
+    if (fclose(fp) != 0 || rename(tmp, path) < 0)
+    {
+        unlink(tmp);
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    }
+    print_debug("[+] Incremental: %zu of %zu chunk(s) reused, %.1f MB re-encoded (%s)\n",
+        repack->reused, repack->count, repack->encoded / 1e6, path);
+    return 0;
+}
+
+void close_repack(t_repack *repack)
+{
+    if (repack->fd >= 0)
+        close(repack->fd);
+    arena_free(repack->old);
+    arena_free(repack->records);
+    arena_free(repack->scratch);
+    *repack = (t_repack){ .fd = -1 };
+}
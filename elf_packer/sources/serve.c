@@ -0,0 +1,430 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   serve.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/31 10:14:22 by insub             #+#    #+#             */
+/*   Updated: 2026/01/31 10:14:22 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "serve.h"
+#include "pack.h"
+#include "print_utils.h"
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+static volatile sig_atomic_t g_stop;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    g_stop = TRUE;
+}
+
+static uint64_t now_us(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static int read_full(int fd, void *buffer, size_t size)
+{
+    size_t done = 0;
+
+    while (done < size)
+    {
+        ssize_t n = read(fd, (char *)buffer + done, size - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FALSE;
+        done += n;
+    }
+    return TRUE;
+}
+
+// 연결이 끝날 때 같이 지울 문자열
+static const char *keep(t_serve_conn *conn, char *str)
+{
+    char **grown;
+
+    if (!str)
+        return NULL;
+    grown = realloc(conn->owned, (conn->owned_count + 1) * sizeof(*conn->owned));
+    if (!grown)
+    {
+        free(str);
+        return NULL;
+    }
+    conn->owned = grown;
+    conn->owned[conn->owned_count++] = str;
+    return str;
+}
+
+// 상대 경로는 client 의 cwd 기준 (받은 cwd fd 를 /proc/self/fd 로 거쳐 감)
+static const char *resolve(t_serve_conn *conn, const char *path)
+{
+    char *joined;
+
+    if (path[0] == '/')
+        return path;
+    if (conn->fd_count == 0 || asprintf(&joined, "/proc/self/fd/%d/%s", conn->fds[0], path) < 0)
+        return NULL;
+    return keep(conn, joined);
+}
+
+static void free_conn(t_serve_conn *conn)
+{
+    for (size_t i = 0; i < conn->fd_count; i++)
+        close(conn->fds[i]);
+    for (size_t i = 0; i < conn->owned_count; i++)
+        free(conn->owned[i]);
+    free(conn->owned);
+    free(conn->opt.batch.inputs);
+    free_profile(&conn->profile);
+    free(conn->jobs);
+    free(conn->argv);
+    free(conn->body);
+    close(conn->fd);
+    pthread_mutex_destroy(&conn->send_lock);
+    free(conn);
+}
+
+// worker 여럿이 같은 연결에 쓰므로 답 하나는 잠근 채로 한 번에
+static void reply(t_serve_conn *conn, const t_serve_reply *answer)
+{
+    pthread_mutex_lock(&conn->send_lock);
+    if (!conn->broken && send(conn->fd, answer, sizeof(*answer), MSG_NOSIGNAL) != sizeof(*answer))
+        conn->broken = TRUE;
+    pthread_mutex_unlock(&conn->send_lock);
+}
+
+static void finish_conn(t_serve_conn *conn, int result)
+{
+    reply(conn, &(t_serve_reply){ .index = SERVE_DONE, .result = result });
+    free_conn(conn);
+}
+
+// 헤더 (+ fd) 와 argv 를 읽음. 한 연결을 읽는 동안 accept 가 멈추므로 SO_RCVTIMEO 로 끊음
+static int recv_request(t_serve_conn *conn)
+{
+    t_serve_request req;
+    char            control[CMSG_SPACE(SERVE_MAX_FDS * sizeof(int))];
+    struct iovec    iov = { .iov_base = &req, .iov_len = sizeof(req) };
+    struct msghdr   msg = { .msg_iov = &iov, .msg_iovlen = 1,
+                            .msg_control = control, .msg_controllen = sizeof(control) };
+    ssize_t         n = recvmsg(conn->fd, &msg, MSG_CMSG_CLOEXEC | MSG_WAITALL);
+
+    for (struct cmsghdr *c = CMSG_FIRSTHDR(&msg); n > 0 && c; c = CMSG_NXTHDR(&msg, c))
+    {
+        if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS)
+            continue;
+        size_t count = (c->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        if (count > SERVE_MAX_FDS - conn->fd_count)
+            count = SERVE_MAX_FDS - conn->fd_count;
+        memcpy(conn->fds + conn->fd_count, CMSG_DATA(c), count * sizeof(int));
+        conn->fd_count += count;
+    }
+    if (n != sizeof(req) || (msg.msg_flags & MSG_CTRUNC) || req.magic != SERVE_MAGIC
+        || req.argc == 0 || req.size > SERVE_MAX_REQUEST || req.fd_count != conn->fd_count)
+        return FALSE;
+
+    size_t indices = req.fd_count ? req.fd_count - 1 : 0;
+    conn->body = malloc(req.size + 1);
+    conn->argv = calloc(req.argc + 1, sizeof(*conn->argv));
+    if (!conn->body || !conn->argv || !read_full(conn->fd, conn->body, req.size))
+        return FALSE;
+    conn->body[req.size] = '\0';
+
+    // argv 문자열 argc 개 다음에 fd 마다 argv 번호
+    size_t pos = 0;
+    for (uint32_t i = 0; i < req.argc; i++)
+    {
+        if (pos >= req.size)
+            return FALSE;
+        conn->argv[i] = conn->body + pos;
+        pos += strlen(conn->body + pos) + 1;
+    }
+    if (pos + indices * sizeof(uint32_t) != req.size)
+        return FALSE;
+    memcpy(conn->fd_args + 1, conn->body + pos, indices * sizeof(uint32_t));
+    conn->argc = req.argc;
+    return TRUE;
+}
+
+// 받은 fd 가 있는 입력은 그 fd 를, 없으면 경로를 씀
+static const char *input_path(t_serve_conn *conn, uint32_t arg, const char *name)
+{
+    char *path;
+
+    for (size_t i = 1; i < conn->fd_count; i++)
+        if (conn->fd_args[i] == arg)
+            return asprintf(&path, "/proc/self/fd/%d", conn->fds[i]) < 0 ? NULL : keep(conn, path);
+    return name;
+}
+
+// 받은 명령줄을 woody_woodpacker 와 같은 규칙으로 읽고 입력마다 job 을 만듦
+static int prepare(t_serve_conn *conn)
+{
+    t_options   *opt = &conn->opt;
+    const char  *out_dir = NULL;
+    uint32_t    arg = 0;
+
+    if (parse_args(conn->argc, conn->argv, opt) == FALSE
+        || opt->serve || opt->watch || opt->batch.manifest || opt->stats)
+        return FALSE;
+    conn->config = opt->pack;
+    conn->config.quiet = TRUE;
+    if ((opt->pack.cache_dir && !(conn->config.cache_dir = resolve(conn, opt->pack.cache_dir)))
+        || (opt->pack.incremental && !(conn->config.incremental = resolve(conn, opt->pack.incremental)))
+        || (opt->batch.out_dir && !(out_dir = resolve(conn, opt->batch.out_dir))))
+        return FALSE;
+    if (opt->profile)
+    {
+        const char *profile = resolve(conn, opt->profile);
+        if (!profile || load_profile(profile, &conn->profile) < 0)
+            return FALSE;
+        conn->config.profile = &conn->profile;
+    }
+
+    int single = opt->batch.count == 1 && !opt->batch.out_dir && !opt->batch.workers;
+    conn->jobs = calloc(opt->batch.count ? opt->batch.count : 1, sizeof(*conn->jobs));
+    if (!conn->jobs)
+        return FALSE;
+    for (size_t i = 0; i < opt->batch.count; i++)
+    {
+        // inputs 는 argv 의 포인터를 순서대로 담고 있음
+        while (conn->argv[arg] != opt->batch.inputs[i])
+            arg++;
+        t_serve_job *job = &conn->jobs[conn->job_count++];
+        const char  *name = resolve(conn, opt->batch.inputs[i]);
+        job->arg = arg;
+        job->input = name ? input_path(conn, arg, name) : NULL;
+        if (single)
+            job->output = resolve(conn, opt->output ? opt->output : "woody");
+        else if (name)
+            job->output = keep(conn, default_output(name, out_dir));
+        if (!job->input || !job->output)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+// 아직 줄 job 이 남은 연결을 고리 끝에 붙임 (serve->lock 을 잡은 채로)
+static void push_conn(t_serve *serve, t_serve_conn *conn)
+{
+    conn->link = NULL;
+    if (serve->tail)
+        serve->tail->link = conn;
+    else
+        serve->head = conn;
+    serve->tail = conn;
+}
+
+// 맨 앞 연결에서 job 하나를 꺼내고 그 연결은 (남았으면) 맨 뒤로 보냄
+static t_serve_conn *take_job(t_serve *serve, size_t *index)
+{
+    t_serve_conn *conn = serve->head;
+
+    serve->head = conn->link;
+    if (!serve->head)
+        serve->tail = NULL;
+    *index = conn->next++;
+    if (conn->next < conn->job_count)
+        push_conn(serve, conn);
+    return conn;
+}
+
+// worker 는 끝날 때까지 살아 있음 (thread, heap 에 남긴 buffer 를 요청마다 다시 만들지 않음)
+static void *serve_worker(void *arg)
+{
+    t_serve *serve = arg;
+
+    pthread_mutex_lock(&serve->lock);
+    while (TRUE)
+    {
+        while (!serve->head && !serve->stop)
+            pthread_cond_wait(&serve->ready, &serve->lock);
+        if (!serve->head)
+            break;
+        size_t          index;
+        t_serve_conn    *conn = take_job(serve, &index);
+        t_serve_job     *job = &conn->jobs[index];
+        pthread_mutex_unlock(&serve->lock);
+
+        uint64_t start = now_us();
+        int result = pack_file(job->input, job->output, &conn->config);
+        uint64_t end = now_us();
+        reply(conn, &(t_serve_reply){ .index = job->arg, .result = result,
+                                      .queued_us = start - conn->received,
+                                      .packed_us = end - start });
+
+        pthread_mutex_lock(&serve->lock);
+        serve->packed += result >= 0;
+        serve->failed += result < 0;
+        if (++conn->done == conn->job_count)
+        {
+            pthread_mutex_unlock(&serve->lock);
+            finish_conn(conn, 0);
+            pthread_mutex_lock(&serve->lock);
+        }
+    }
+    pthread_mutex_unlock(&serve->lock);
+    return NULL;
+}
+
+static void accept_conn(t_serve *serve)
+{
+    struct timeval  timeout = { SERVE_TIMEOUT_MS / 1000, SERVE_TIMEOUT_MS % 1000 * 1000 };
+    int             fd = accept4(serve->fd, NULL, NULL, SOCK_CLOEXEC);
+    t_serve_conn    *conn;
+
+    if (fd < 0)
+        return;
+    conn = calloc(1, sizeof(*conn));
+    if (!conn)
+    {
+        close(fd);
+        return;
+    }
+    conn->fd = fd;
+    conn->received = now_us();
+    pthread_mutex_init(&conn->send_lock, NULL);
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    if (recv_request(conn) == FALSE || prepare(conn) == FALSE)
+    {
+        finish_conn(conn, -1);
+        return;
+    }
+    if (conn->job_count == 0)
+    {
+        finish_conn(conn, 0);
+        return;
+    }
+    pthread_mutex_lock(&serve->lock);
+    push_conn(serve, conn);
+    serve->requests++;
+    pthread_cond_broadcast(&serve->ready);
+    pthread_mutex_unlock(&serve->lock);
+}
+
+// 남아 있는 socket 파일은 받는 쪽이 없을 때만 지우고 씀 (떠 있는 server 를 가로채지 않음)
+static int listen_socket(const char *path)
+{
+    struct sockaddr_un  addr = { .sun_family = AF_UNIX };
+    int                 fd;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+        return -1;
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+    {
+        close(fd);
+        errno = EADDRINUSE;
+        return -1;
+    }
+    if (errno == ECONNREFUSED)
+        unlink(path);
+    close(fd);
+
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    if (fd < 0)
+        return -1;
+    mode_t mask = umask(077);   // 같은 사용자만 붙을 수 있게
+    int bound = bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+    umask(mask);
+    if (bound < 0 || listen(fd, SERVE_BACKLOG) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// SIGINT / SIGTERM 이 올 때까지 path 에서 pack 요청을 받음. 시그널은 ppoll 안에서만 받음
+// (worker 들은 막힌 mask 를 물려받음). 끝낼 때는 받은 요청까지 마치고 socket 을 지움
+int run_serve(const char *path, int workers)
+{
+    t_serve     serve = { .fd = -1, .lock = PTHREAD_MUTEX_INITIALIZER,
+                          .ready = PTHREAD_COND_INITIALIZER };
+    pthread_t   threads[BATCH_MAX_WORKERS];
+    sigset_t    block;
+    sigset_t    old;
+    struct rlimit limit;
+
+    set_debug(FALSE);
+    warm_heap();
+    // 연결마다 fd 를 SERVE_MAX_FDS 개까지 잡고 있음
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+    serve.fd = listen_socket(path);
+    if (serve.fd < 0)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+
+    sigemptyset(&block);
+    sigaddset(&block, SIGINT);
+    sigaddset(&block, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &block, &old);
+    struct sigaction sa = { .sa_handler = on_signal };
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    if (workers == 0)
+        workers = cpu_count();
+    if (workers > BATCH_MAX_WORKERS)
+        workers = BATCH_MAX_WORKERS;
+    int started = 0;
+    while (started < workers && pthread_create(&threads[started], NULL, serve_worker, &serve) == 0)
+        started++;
+    printf("serve: %s (%d workers)\n", path, started);
+    fflush(stdout);
+
+    struct pollfd pfd = { .fd = serve.fd, .events = POLLIN };
+    while (!g_stop && started > 0)
+    {
+        int ready = ppoll(&pfd, 1, NULL, &old);
+
+        if (ready < 0 && errno != EINTR)
+            break;
+        if (ready > 0)
+            accept_conn(&serve);
+    }
+    close(serve.fd);
+    unlink(path);
+
+    pthread_mutex_lock(&serve.lock);
+    serve.stop = TRUE;
+    pthread_cond_broadcast(&serve.ready);
+    pthread_mutex_unlock(&serve.lock);
+    for (int i = 0; i < started; i++)
+        pthread_join(threads[i], NULL);
+    printf("serve: %zu requests, %zu packed, %zu failed\n", serve.requests, serve.packed, serve.failed);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    pthread_mutex_destroy(&serve.lock);
+    pthread_cond_destroy(&serve.ready);
+    return started > 0 ? 0 : print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+}
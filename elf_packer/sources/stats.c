@@ -0,0 +1,197 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 16:08:31 by insub             #+#    #+#             */
+/*   Updated: 2026/02/06 16:08:31 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "stats.h"
+#include "pack.h"
+#include "print_utils.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+
+typedef struct s_counter_def
+{
+    uint32_t    type;
+    uint64_t    config;
+    const char  *name;      // JSON key
+}   t_counter_def;
+
+static const t_counter_def g_defs[COUNTER_COUNT] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles" },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions" },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "cache_misses" },
+    { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, "page_faults" },
+};
+
+static const char *g_phase_names[PHASE_COUNT] = {
+    "read", "parse", "layout", "stub", "encode", "write", "cache",
+};
+
+static int              g_enabled;
+static int              g_counters;                 // --stats-counters
+static int              g_available[COUNTER_COUNT]; // 한 thread 에서라도 열렸으면 TRUE
+static uint64_t         g_start;
+static t_phase_stats    g_phases[PHASE_COUNT];      // 모든 thread 의 합
+static uint64_t         g_files;
+static uint64_t         g_cached;
+static uint64_t         g_failed;
+
+// perf counter 는 연 thread 만 세므로 thread 마다 (0: 아직 안 엶, -1: 못 엶)
+static __thread int     g_fds[COUNTER_COUNT];
+static __thread int     g_opened;
+static pthread_key_t    g_key;
+static pthread_once_t   g_once = PTHREAD_ONCE_INIT;
+
+static uint64_t now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void close_counters(void *arg)
+{
+    (void)arg;
+    for (int i = 0; i < COUNTER_COUNT; i++)
+        if (g_fds[i] > 0)
+            close(g_fds[i]);
+}
+
+static void make_key(void)
+{
+    pthread_key_create(&g_key, close_counters);
+}
+
+// 사용자 공간만 셈 (perf_event_paranoid 2 에서도 열림). PMU 가 없는 VM 이면 hardware 는 못 엶
+static void open_counters(void)
+{
+    g_opened = TRUE;
+    pthread_once(&g_once, make_key);
+    pthread_setspecific(g_key, &g_opened);
+    for (int i = 0; i < COUNTER_COUNT; i++)
+    {
+        struct perf_event_attr attr = { .type = g_defs[i].type, .size = sizeof(attr),
+                                        .config = g_defs[i].config,
+                                        .exclude_kernel = 1, .exclude_hv = 1 };
+        g_fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+        if (g_fds[i] >= 0)
+            __atomic_store_n(&g_available[i], TRUE, __ATOMIC_RELAXED);
+        else
+            g_fds[i] = -1;
+    }
+}
+
+static void read_counters(uint64_t *values)
+{
+    if (!g_opened)
+        open_counters();
+    for (int i = 0; i < COUNTER_COUNT; i++)
+        if (g_fds[i] < 0 || read(g_fds[i], &values[i], sizeof(values[i])) != sizeof(values[i]))
+            values[i] = 0;
+}
+
+void stats_read(uint64_t counters[COUNTER_COUNT])
+{
+    read_counters(counters);
+}
+
+int stats_available(t_counter counter)
+{
+    return __atomic_load_n(&g_available[counter], __ATOMIC_RELAXED);
+}
+
+void stats_enable(int counters)
+{
+    g_enabled = TRUE;
+    g_counters = counters;
+    g_start = now_ns();
+}
+
+void stats_begin(t_stats_timer *timer)
+{
+    if (!g_enabled)
+        return;
+    if (g_counters)
+        read_counters(timer->counters);
+    timer->ns = now_ns();
+}
+
+void stats_end(const t_stats_timer *timer, t_phase phase, uint64_t bytes)
+{
+    t_phase_stats   *total = &g_phases[phase];
+    uint64_t        counters[COUNTER_COUNT];
+
+    if (!g_enabled)
+        return;
+    __atomic_fetch_add(&total->ns, now_ns() - timer->ns, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&total->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&total->bytes, bytes, __ATOMIC_RELAXED);
+    if (!g_counters)
+        return;
+    read_counters(counters);
+    for (int i = 0; i < COUNTER_COUNT; i++)
+        __atomic_fetch_add(&total->counters[i], counters[i] - timer->counters[i], __ATOMIC_RELAXED);
+}
+
+// pack_file 하나의 결과
+void stats_file(int result)
+{
+    if (!g_enabled)
+        return;
+    __atomic_fetch_add(&g_files, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_cached, result == PACK_CACHED, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_failed, result < 0, __ATOMIC_RELAXED);
+}
+
+static void write_phase(FILE *fp, t_phase phase)
+{
+    const t_phase_stats *p = &g_phases[phase];
+
+    fprintf(fp, "    \"%s\": { \"calls\": %lu, \"ns\": %lu, \"bytes\": %lu, \"mb_per_s\": %.1f",
+        g_phase_names[phase], p->calls, p->ns, p->bytes, p->ns ? p->bytes * 1e3 / p->ns : 0.0);
+    for (int i = 0; g_counters && i < COUNTER_COUNT; i++)
+    {
+        if (g_available[i])
+            fprintf(fp, ", \"%s\": %lu", g_defs[i].name, p->counters[i]);
+        else
+            fprintf(fp, ", \"%s\": null", g_defs[i].name);
+    }
+    fprintf(fp, " }%s\n", phase + 1 < PHASE_COUNT ? "," : "");
+}
+
+// ns 는 thread 들의 합 (batch 면 wall_ns 보다 클 수 있음). mb_per_s 는 그 단계의 thread 하나당 처리량.
+// path 가 "-" 면 stdout
+int stats_write(const char *path)
+{
+    FILE        *fp = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    uint64_t    wall = now_ns() - g_start;
+
+    if (!fp)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    fprintf(fp, "{\n  \"version\": %d,\n  \"wall_ns\": %lu,\n", STATS_VERSION, wall);
+    fprintf(fp, "  \"files\": %lu,\n  \"cached\": %lu,\n  \"failed\": %lu,\n",
+        g_files, g_cached, g_failed);
+    fprintf(fp, "  \"input_bytes\": %lu,\n  \"output_bytes\": %lu,\n  \"mb_per_s\": %.1f,\n",
+        g_phases[PHASE_READ].bytes, g_phases[PHASE_WRITE].bytes,
+        wall ? g_phases[PHASE_READ].bytes * 1e3 / wall : 0.0);
+    fprintf(fp, "  \"counters\": %s,\n  \"phases\": {\n", g_counters ? "true" : "false");
+    for (int i = 0; i < PHASE_COUNT; i++)
+        write_phase(fp, i);
+    fprintf(fp, "  }\n}\n");
+    if (fp == stdout)
+        return fflush(fp) == 0 ? 0 : print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    return fclose(fp) == 0 ? 0 : print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stream.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/22 09:48:13 by insub             #+#    #+#             */
+/*   Updated: 2026/01/22 18:12:40 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "print_utils.h"
+#include "stream.h"
+#include "arena.h"
+#include <errno.h>
+#include <pthread.h>
+
+enum e_chunk_state
+{
+    CHUNK_FREE,
+    CHUNK_READ,     // 읽기 끝, 변환 대기
+    CHUNK_READY,    // 변환 끝, 쓰기 대기
+};
+
+// 구간 i 는 chunks[i % STREAM_DEPTH] 를 씀. 세 단계가 각자 순서대로 돌면서
+// 앞 단계가 넘겨 준 chunk 만 만지므로 잠금은 상태 전환에만 필요
+typedef struct s_stream
+{
+    int             in_fd;
+    int             out_fd;
+    const t_patch   *spans;
+    size_t          count;
+    t_chunk         chunks[STREAM_DEPTH];
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    int             failed;
+    int             io_error;   // 읽기 / 쓰기 thread 의 errno (errno 는 thread 마다 따로)
+}   t_stream;
+
+static int pread_all(int fd, uint8_t *buffer, size_t size, uint64_t offset)
+{
+    while (size > 0)
+    {
+        ssize_t n = pread(fd, buffer, size, (off_t)offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FALSE;
+        buffer += n;
+        size -= n;
+        offset += n;
+    }
+    return TRUE;
+}
+
+// chunk 가 state 가 될 때까지 기다림. 다른 단계가 실패했으면 FALSE
+static int wait_state(t_stream *s, t_chunk *chunk, int state)
+{
+    pthread_mutex_lock(&s->lock);
+    while (chunk->state != state && !s->failed)
+        pthread_cond_wait(&s->cond, &s->lock);
+    int ok = !s->failed;
+    pthread_mutex_unlock(&s->lock);
+    return ok;
+}
+
+static void set_state(t_stream *s, t_chunk *chunk, int state, int ok)
+{
+    pthread_mutex_lock(&s->lock);
+    if (ok)
+        chunk->state = state;
+    else
+        s->failed = TRUE;
+    if (!ok && state != CHUNK_READY && !s->io_error)
+        s->io_error = errno ? errno : EIO;
+    pthread_cond_broadcast(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+}
+
+static void *reader_main(void *arg)
+{
+    t_stream *s = arg;
+
+    for (size_t i = 0; i < s->count; i++)
+    {
+        t_chunk *chunk = &s->chunks[i % STREAM_DEPTH];
+        if (!wait_state(s, chunk, CHUNK_FREE))
+            break;
+        chunk->offset = s->spans[i].offset;
+        chunk->size = s->spans[i].size;
+        chunk->data = chunk->in;
+        chunk->data_size = chunk->size;
+        chunk->write_offset = chunk->offset;
+        set_state(s, chunk, CHUNK_READ,
+            pread_all(s->in_fd, chunk->in, chunk->size, chunk->offset));
+    }
+    return NULL;
+}
+
+static void *writer_main(void *arg)
+{
+    t_stream *s = arg;
+
+    for (size_t i = 0; i < s->count; i++)
+    {
+        t_chunk *chunk = &s->chunks[i % STREAM_DEPTH];
+        if (!wait_state(s, chunk, CHUNK_READY))
+            break;
+        set_state(s, chunk, CHUNK_FREE,
+            write_all(s->out_fd, (const char *)chunk->data, chunk->data_size, chunk->write_offset));
+    }
+    return NULL;
+}
+
+// spans 를 순서대로 읽어 transform 한 뒤 출력에 씀. 읽기 / 쓰기는 따로 thread 를 두고
+// 변환은 이 thread 에서 하므로 STREAM_DEPTH 개 chunk 만큼만 메모리를 씀
+int stream_spans(int in_fd, int out_fd, const t_patch *spans, size_t count,
+                 size_t out_size, t_transform transform, void *arg)
+{
+    t_stream    s = { .in_fd = in_fd, .out_fd = out_fd, .spans = spans, .count = count };
+    pthread_t   reader;
+    pthread_t   writer;
+    size_t      in_size = 0;
+    int         ret = 0;
+
+    for (size_t i = 0; i < count; i++)
+        if (spans[i].size > in_size)
+            in_size = spans[i].size;
+    for (int i = 0; i < STREAM_DEPTH; i++)
+    {
+        s.chunks[i].in = arena_alloc(in_size + out_size);
+        s.chunks[i].out = s.chunks[i].in + in_size;
+        if (!s.chunks[i].in)
+        {
+            while (i-- > 0)
+                arena_free(s.chunks[i].in);
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        }
+    }
+    pthread_mutex_init(&s.lock, NULL);
+    pthread_cond_init(&s.cond, NULL);
+
+    if (pthread_create(&reader, NULL, reader_main, &s) != 0)
+        ret = print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    else if (pthread_create(&writer, NULL, writer_main, &s) != 0)
+    {
+        set_state(&s, &s.chunks[0], CHUNK_READY, FALSE);   // reader 를 멈춤
+        pthread_join(reader, NULL);
+        ret = print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            t_chunk *chunk = &s.chunks[i % STREAM_DEPTH];
+            if (!wait_state(&s, chunk, CHUNK_READ))
+                break;
+            set_state(&s, chunk, CHUNK_READY, transform(chunk, i, arg) == 0);
+        }
+        pthread_join(reader, NULL);
+        pthread_join(writer, NULL);
+    }
+    if (s.failed)
+        ret = -1;
+    if (s.io_error)
+    {
+        errno = s.io_error;
+        print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    }
+
+    pthread_cond_destroy(&s.cond);
+    pthread_mutex_destroy(&s.lock);
+    for (int i = 0; i < STREAM_DEPTH; i++)
+        arena_free(s.chunks[i].in);
+    return ret;
+}
@@ -1,13 +1,188 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*                                                        :::      ::::::::   */
-/*   main.c                                             :+:      :+:    :+:   */
+/*   stub.c                                             :+:      :+:    :+:   */
 /*                                                    +:+ +:+         +:+     */
 /*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 20:51:01 by insub             #+#    #+#             */
-/*   Updated: 2025/11/17 21:07:58 by insub            ###   ########.fr       */
+/*   Updated: 2026/01/04 19:02:13 by insub            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-// #include "stub.h"
+#include "main.h"
+#include "stub_image.h"
+#include "print_utils.h"
+#include "stub.h"
+#include "arena.h"
+#include "telemetry.h"
+#include <string.h>
+
+typedef struct s_kernel_bin
+{
+    const char          *name;
+    int                 aes;        // AES-CTR 용이면 TRUE, ChaCha20 용이면 FALSE
+    uint32_t            features;
+    const unsigned char *code;
+    const unsigned int  *len;
+}   t_kernel_bin;
+
+// cipher 별로 빠른 것부터. 마지막 kernel 은 어떤 x86-64 에서도 돌아야 함
+static const t_kernel_bin g_kernels[] = {
+    { "chacha20_avx512", FALSE, FEAT_AVX512, kernel_chacha20_avx512_bin, &kernel_chacha20_avx512_bin_len },
+    { "chacha20_avx2", FALSE, FEAT_AVX2, kernel_chacha20_avx2_bin, &kernel_chacha20_avx2_bin_len },
+    { "chacha20_sse2", FALSE, 0, kernel_chacha20_sse2_bin, &kernel_chacha20_sse2_bin_len },
+    { "aes_vaes_avx512", TRUE, FEAT_AESNI | FEAT_VAES | FEAT_AVX512, kernel_aes_vaes_avx512_bin, &kernel_aes_vaes_avx512_bin_len },
+    { "aes_vaes_avx2", TRUE, FEAT_AESNI | FEAT_VAES | FEAT_AVX2, kernel_aes_vaes_avx2_bin, &kernel_aes_vaes_avx2_bin_len },
+    { "aes_ni", TRUE, FEAT_AESNI, kernel_aes_ni_bin, &kernel_aes_ni_bin_len },
+    { "aes_soft", TRUE, 0, kernel_aes_soft_bin, &kernel_aes_soft_bin_len },
+};
+
+# define KERNEL_BIN_COUNT (sizeof(g_kernels) / sizeof(g_kernels[0]))
+
+// woody_kbench 용: index 번째 kernel. 없으면 NULL
+const char *kernel_bin(size_t index, int *aes, uint32_t *features, const unsigned char **code, size_t *len)
+{
+    if (index >= KERNEL_BIN_COUNT)
+        return NULL;
+    *aes = g_kernels[index].aes;
+    *features = g_kernels[index].features;
+    *code = g_kernels[index].code;
+    *len = *g_kernels[index].len;
+    return g_kernels[index].name;
+}
+
+int is_kernel_name(const char *name)
+{
+    for (size_t i = 0; i < KERNEL_BIN_COUNT; i++)
+        if (strcmp(g_kernels[i].name, name) == 0)
+            return TRUE;
+    return FALSE;
+}
+
+static int kernel_selected(const t_kernel_bin *kernel, t_cipher cipher, const char *kernel_name)
+{
+    if (kernel->aes != (cipher != CIPHER_CHACHA20))
+        return FALSE;
+    return kernel_name == NULL || strcmp(kernel->name, kernel_name) == 0;
+}
+
+// --telemetry 면 TSC 를 기록하는 dispatcher (stub_telemetry.bin)
+static const unsigned char *dispatcher(int telemetry, size_t *len)
+{
+    *len = telemetry ? stub_telemetry_bin_len : stub_bin_len;
+    return telemetry ? stub_telemetry_bin : stub_bin;
+}
+
+// kernel_name 이 NULL 이면 cipher 의 모든 variant 를 넣고 stub 이 CPUID 로 고름
+// 아니면 그 kernel 하나만 (기능 검사 없이) 넣음
+int build_stub(t_stub_image *image, t_cipher cipher, const char *kernel_name, int telemetry)
+{
+    size_t              stub_len;
+    const unsigned char *stub_code = dispatcher(telemetry, &stub_len);
+    size_t              size = stub_len;
+    int                 count = 0;
+
+    for (size_t i = 0; i < KERNEL_BIN_COUNT; i++)
+        if (kernel_selected(&g_kernels[i], cipher, kernel_name))
+            size = ((size + KERNEL_ALIGN - 1) & ~(size_t)(KERNEL_ALIGN - 1)) + *g_kernels[i].len;
+
+    image->code = arena_calloc(1, size);
+    if (!image->code)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    image->size = size;
+    image->bss = 0;
+    image->tail = 0;
+    memcpy(image->code, stub_code, stub_len);
+
+    image->params = find_stub_params(image->code, stub_len);
+    if (!image->params)
+    {
+        print_debug("    [!] Error: Placeholder pattern not found in stub!\n");
+        free_stub(image);
+        return -1;
+    }
+
+    size = stub_len;
+    for (size_t i = 0; i < KERNEL_BIN_COUNT; i++)
+    {
+        const t_kernel_bin *kernel = &g_kernels[i];
+
+        if (!kernel_selected(kernel, cipher, kernel_name))
+            continue;
+        if (count == MAX_KERNELS)
+            break;
+        size = (size + KERNEL_ALIGN - 1) & ~(size_t)(KERNEL_ALIGN - 1);
+        memcpy(image->code + size, kernel->code, *kernel->len);
+        image->params->kernels[count].offset = size;
+        image->params->kernels[count].features = kernel_name ? 0 : kernel->features;
+        print_debug("    [+] Kernel %s at stub+0x%lx\n", kernel->name, size);
+        size += *kernel->len;
+        count++;
+    }
+    image->params->kernel_count = count;
+    if (count == 0)
+    {
+        free_stub(image);
+        return print_error(WRONG_ARGS, ERRNO_FALSE);
+    }
+    return 0;
+}
+
+// stub 뒤에 data 를 PACKED_ALIGN 정렬로 붙임 (code 가 옮겨질 수 있어 params 도 다시 잡음)
+int append_stub(t_stub_image *image, const void *data, size_t size, uint32_t *offset)
+{
+    size_t  params_offset = (unsigned char *)image->params - image->code;
+    size_t  start = (image->size + PACKED_ALIGN - 1) & ~(size_t)(PACKED_ALIGN - 1);
+
+    if (start + size > UINT32_MAX)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    unsigned char *code = arena_realloc(image->code, start + size);
+    if (!code)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    memset(code + image->size, 0, start - image->size);
+    memcpy(code + start, data, size);
+    image->code = code;
+    image->size = start + size;
+    image->params = (t_stub_params *)(code + params_offset);
+    *offset = (uint32_t)start;
+    return 0;
+}
+
+// --telemetry: 실행할 때 쓰는 record 에 binary 를 구분할 id 를 넣어 둠 (dispatcher 안의 template)
+void set_telemetry_id(t_stub_image *image, uint64_t id)
+{
+    size_t  end = (unsigned char *)image->params - image->code;
+    uint8_t header[8];
+
+    *(uint32_t *)header = TELEMETRY_MAGIC;
+    *(uint16_t *)(header + 4) = TELEMETRY_VERSION;
+    *(uint16_t *)(header + 6) = TSC_POINTS;
+    for (size_t i = 0; i + sizeof(t_telemetry_record) <= end; i += 8)
+    {
+        if (memcmp(image->code + i, header, sizeof(header)) == 0)
+        {
+            ((t_telemetry_record *)(image->code + i))->id = id;
+            return;
+        }
+    }
+}
+
+// --cache 의 key 용: build_stub 이 이어 붙일 dispatcher 와 kernel 코드
+void hash_stub(t_blake2b *ctx, t_cipher cipher, const char *kernel_name, int telemetry)
+{
+    size_t              stub_len;
+    const unsigned char *stub_code = dispatcher(telemetry, &stub_len);
+
+    blake2b_update(ctx, stub_code, stub_len);
+    for (size_t i = 0; i < KERNEL_BIN_COUNT; i++)
+        if (kernel_selected(&g_kernels[i], cipher, kernel_name))
+            blake2b_update(ctx, g_kernels[i].code, *g_kernels[i].len);
+}
+
+void free_stub(t_stub_image *image)
+{
+    arena_free(image->code);
+    image->code = NULL;
+    image->params = NULL;
+}
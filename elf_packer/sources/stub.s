@@ -1,7 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/17 20:51:01 by insub             #+#    #+#             */
+/*   Updated: 2025/12/21 18:02:36 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// #include "stub.h"
 [BITS 64]
 
+%include "stub.inc"
+
+%define PAGE_MASK       -4096
+%define PROT_RW         3
+%define SYS_WRITE       1
+%define SYS_OPEN        2
+%define SYS_CLOSE       3
+%define SYS_MPROTECT    10
+%define SYS_RT_SIGACTION 13
+%define SYS_RT_SIGRETURN 15
+%define SYS_EXIT_GROUP  231
+%define SYS_MMAP        9
+%define SYS_MUNMAP      11
+%define SYS_MREMAP      25
+%define SYS_MADVISE     28
+%define SYS_CLONE       56
+%define SYS_EXIT        60
+%define SYS_FUTEX       202
+%define SYS_SCHED_GETAFFINITY 204
+%define SIGSEGV         11
+%define SA_SIGINFO      0x4
+%define SA_RESTORER     0x4000000
+%define UC_ERR          192     ; ucontext_t.uc_mcontext.gregs[REG_ERR] (page fault error code)
+%define PF_WRITE        2
+%define MAP_PRIVATE     0x02
+%define MAP_ANONYMOUS   0x20
+%define MADV_HUGEPAGE   14
+%define MREMAP_MOVE     3           ; MREMAP_MAYMOVE | MREMAP_FIXED
+%define FUTEX_WAIT      0
+; CLONE_VM | FS | FILES | SIGHAND | THREAD | SYSVSEM | PARENT_SETTID | CHILD_CLEARTID
+%define CLONE_WORKER    0x350f00
+%define THREAD_STACK_SIZE 0x10000
+%define O_TELEMETRY     0x80441     ; O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC
+
+; --telemetry 로 만든 stub 만 (-DTELEMETRY) 그 시점의 TSC 를 record 에 기록
+%macro TSC 1
+%ifdef TELEMETRY
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    mov [rel telemetry_tsc + %1 * 8], rax
+%endif
+%endmacro
+
 global _start
 
+%ifdef BENCH
+; woody_kbench 용 variant (stub_bench.bin, pack 에는 안 씀): 내부 routine 의 위치 (표 시작 기준)
+bench_table:
+    dd BENCH_MAGIC
+    dd lz4_decompress - bench_table
+%endif
+
 _start:
     ; 1. 레지스터 저장
     push rdi
@@ -13,15 +77,133 @@ _start:
     push r9
     push r10
     push r11
+    push rbx
+    push rbp
+    push r12
+    push r13
+    push r14
+    push r15
+    TSC TSC_ENTRY
 
     ; 2. "inskim" 출력
-    mov rax, 1                  ; sys_write
+    mov rax, SYS_WRITE          ; sys_write
     mov rdi, 1                  ; fd = 1
     lea rsi, [rel msg]          ; RIP-relative address
     mov rdx, 7                  ; length
     syscall
 
-    ; 3. 레지스터 복구
+    ; 3. CPU 에 맞는 복호화 kernel 선택 (packer 가 좋은 것부터 넣어 둠)
+    call detect_features
+%ifdef TELEMETRY
+    mov [rel telemetry_features], eax
+%endif
+    lea rbx, [rel kernels]
+    mov ecx, [rel kernel_count]
+.next_kernel:
+    test ecx, ecx
+    jz fail
+    mov edx, [rbx + 4]          ; 필요한 기능
+    and edx, eax
+    cmp edx, [rbx + 4]
+    je .found
+    add rbx, KERNEL_SIZE
+    dec ecx
+    jmp .next_kernel
+.found:
+    mov r15d, [rbx]
+    lea rbx, [rel _start]
+    add r15, rbx                ; r15 = kernel 진입점
+%ifdef TELEMETRY
+    mov edx, [rel kernel_count]
+    sub edx, ecx
+    mov [rel telemetry_kernel], edx
+%endif
+    TSC TSC_KERNEL
+
+    ; 4. 암호화된 region 복호화 (lazy 모드는 처음 건드릴 때 handler 가 block 단위로,
+    ;    block 으로 나뉜 큰 region 은 여러 thread 가 나눠서)
+    lea r12, [rel _start]
+    sub r12, [rel stub_vaddr]   ; r12 = load bias (ET_EXEC 는 0)
+    call huge_remap
+    cmp dword [rel lazy], 0
+    jne .lazy
+    cmp dword [rel block_shift], 0
+    je .regions
+    call parallel_unpack
+    jmp .done
+.lazy:
+    mov [rel load_bias], r12
+    mov [rel kernel_entry], r15
+    lea rdi, [rel lazy_handler]
+    call install_handler
+.regions:
+    lea r13, [rel regions]
+    mov r14d, [rel region_count]
+
+.next_region:
+    test r14d, r14d
+    jz .done
+
+    cmp dword [rel lazy], 0
+    je .whole
+    call lazy_region
+    jmp .region_done
+
+.whole:
+    mov edx, PROT_RW
+    call region_mprotect
+    cmp dword [r13 + 28], 0
+    jne .packed
+    mov rdi, [r13]              ; vaddr
+    add rdi, r12
+    mov rsi, [r13 + 8]          ; size
+    call decrypt_range
+    jmp .restore
+
+.packed:
+    ; 압축된 region: stub 뒤의 blob 을 제자리 복호화한 뒤 region 에 풀어 씀
+    lea rbx, [rel _start]
+    mov edi, [r13 + 20]         ; blob 위치 (stub 기준)
+    add rdi, rbx
+    mov esi, [r13 + 28]         ; blob 크기
+    mov edx, [r13 + 16]         ; 첫 block counter
+    lea rcx, [rel params]
+    call r15
+    mov esi, [r13 + 20]
+    add rsi, rbx
+    mov ecx, [r13 + 28]
+    mov rdi, [r13]
+    add rdi, r12
+    mov rdx, [r13 + 8]
+    mov eax, [rel filter]
+    call lz4_decompress
+
+.restore:
+    mov edx, [r13 + 24]         ; 원래 권한으로 복구
+    call region_mprotect
+
+.region_done:
+    add r13, REGION_SIZE
+    dec r14d
+    jmp .next_region
+
+.done:
+    TSC TSC_UNPACK
+    call unpack_hot
+    TSC TSC_HOT
+    TSC TSC_OEP
+%ifdef TELEMETRY
+    lea rdi, [rsp + 15 * 8]     ; 진입 시 rsp (argc)
+    call telemetry_write
+%endif
+
+    ; 5. 레지스터 복구
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbp
+    pop rbx
     pop r11
     pop r10
     pop r9
@@ -32,9 +214,1048 @@ _start:
     pop rsi
     pop rdi
 
-    ; 4. 원본 OEP로 점프
-    mov rax, 0x1122334455667788 ; Placeholder
+    ; 6. 원본 OEP로 점프 (load bias 보정)
+    lea rax, [rel _start]
+    sub rax, [rel stub_vaddr]
+    add rax, [rel oep]
     jmp rax
 
-    ; 데이터 (코드 바로 뒤에 밀착)
-msg: db "inskim", 0x0a
\ No newline at end of file
+; out: ecx = log2(cipher block 크기), counter 1 이 keystream 몇 bytes 인지
+cipher_shift:
+    mov ecx, 6                  ; ChaCha20 64 bytes
+    cmp dword [rel cipher], CIPHER_CHACHA20
+    je .ret
+    mov ecx, 4                  ; AES 16 bytes
+.ret:
+    ret
+
+; region 의 keystream 은 region 시작을 64 bytes 로 내린 주소부터 이어짐 (payload.c)
+; in: r12, r13, rdi = 64 bytes 정렬된 실제 주소 / out: edx = 그 위치의 counter
+keystream_counter:
+    mov rdx, [r13]
+    add rdx, r12
+    and rdx, -64
+    neg rdx
+    add rdx, rdi
+    call cipher_shift
+    shr rdx, cl
+    add edx, [r13 + 16]
+    ret
+
+; region 안의 [rdi, rdi + rsi) 를 제자리 복호화 (아무 위치에서나 시작 가능)
+; 64 bytes 경계에 걸친 앞부분은 stack 에 옮겨서 64 bytes 로 맞춰 복호화
+; in: r12 = load bias, r13 = region, r15 = kernel
+decrypt_range:
+    push rbx
+    push rbp
+    sub rsp, 80
+    mov rbx, rdi
+    mov rbp, rsi
+    mov ecx, edi
+    and ecx, 63                 ; 64 bytes block 안의 위치 (keystream 시작이 64 정렬)
+    jz .aligned
+    mov r8d, 64
+    sub r8, rcx
+    cmp r8, rbp
+    cmova r8, rbp               ; 이 block 에 들어 있는 byte 수
+    mov [rsp + 64], rcx
+    mov [rsp + 72], r8
+    pxor xmm0, xmm0
+    movdqu [rsp], xmm0
+    movdqu [rsp + 16], xmm0
+    movdqu [rsp + 32], xmm0
+    movdqu [rsp + 48], xmm0
+    lea rdi, [rsp + rcx]
+    mov rsi, rbx
+    mov rcx, r8
+    rep movsb
+    mov rdi, rbx
+    sub rdi, [rsp + 64]
+    call keystream_counter
+    mov rdi, rsp
+    mov esi, 64
+    lea rcx, [rel params]
+    call r15
+    mov rdi, rbx
+    mov rsi, rsp
+    add rsi, [rsp + 64]
+    mov rcx, [rsp + 72]
+    rep movsb
+    add rbx, [rsp + 72]
+    sub rbp, [rsp + 72]
+.aligned:
+    test rbp, rbp
+    jz .ret
+    mov rdi, rbx
+    call keystream_counter
+    mov rdi, rbx
+    mov rsi, rbp
+    lea rcx, [rel params]
+    call r15
+.ret:
+    add rsp, 80
+    pop rbp
+    pop rbx
+    ret
+
+; block: region 의 link 주소를 (1 << block_shift) 로 자른 조각 (--lazy, 여러 thread 로 풀 때)
+; in: r13 = region / out: rdx = 첫 block 시작 (link 주소), rax = block 수
+block_span:
+    mov ecx, [rel block_shift]
+    mov rdx, [r13]
+    shr rdx, cl
+    shl rdx, cl
+    mov rax, [r13]
+    add rax, [r13 + 8]
+    dec rax                     ; 마지막 byte
+    sub rax, rdx
+    shr rax, cl
+    inc rax
+    ret
+
+; block 상태 byte (0 = 암호화된 채, 1 = 푸는 중, 2 = 풀림) 는 stub 뒤 bss 에 region 순서대로
+; in: r13 = region / out: rax = 이 region 의 첫 block 상태
+block_states:
+    push r13
+    mov r10, r13
+    lea r8, [rel _start]
+    mov r9d, [rel state_offset]
+    add r8, r9
+    lea r13, [rel regions]
+.next:
+    cmp r13, r10
+    je .ret
+    call block_span
+    add r8, rax
+    add r13, REGION_SIZE
+    jmp .next
+.ret:
+    mov rax, r8
+    pop r13
+    ret
+
+; in: r13 = region, rbx = block / out: rdi = chunk, esi = 크기, edx = counter
+; block 으로 나눈 --compress region 은 block 마다 따로 압축됨. region 의 blob 은
+; {uint32 offset (stub 기준), uint32 크기} x block 수 의 표이고, chunk 는 64 bytes 정렬
+chunk_address:
+    lea rax, [rel _start]
+    mov ecx, [r13 + 20]
+    add rcx, rax                ; chunk 표
+    mov edi, [rcx + rbx * 8]
+    mov esi, [rcx + rbx * 8 + 4]
+    mov edx, edi
+    sub edx, [rcx]              ; 첫 chunk 부터의 거리
+    add rdi, rax
+    call cipher_shift
+    shr edx, cl
+    add edx, [r13 + 16]
+    ret
+
+; in: r12 = load bias, r13 = region, rbx = block / out: [rdi, rsi) = block 의 실제 주소
+block_range:
+    call block_span
+    mov ecx, [rel block_shift]
+    mov rdi, rbx
+    shl rdi, cl
+    add rdi, rdx                ; block 시작
+    mov esi, 1
+    shl rsi, cl
+    add rsi, rdi                ; block 끝
+    mov r8, [r13]
+    cmp rdi, r8
+    cmovb rdi, r8               ; region 안으로 자름
+    add r8, [r13 + 8]
+    cmp rsi, r8
+    cmova rsi, r8
+    add rdi, r12
+    add rsi, r12
+    ret
+
+; block 하나를 복호화 (+ 압축 해제). 페이지는 이미 쓸 수 있어야 함
+; in: r12 = load bias, r13 = region, r15 = kernel, rbx = block
+decode_block:
+    push rbp
+    push r14
+    call block_range
+    mov rbp, rdi
+    mov r14, rsi
+    cmp dword [r13 + 28], 0
+    jne .packed
+    sub rsi, rdi
+    call decrypt_range
+    jmp .ret
+.packed:
+    call chunk_address
+    lea rcx, [rel params]
+    call r15
+    call chunk_address
+    mov ecx, esi
+    mov rsi, rdi
+    mov rdi, rbp
+    mov rdx, r14
+    sub rdx, rbp
+    mov eax, [rel filter]
+    call lz4_decompress
+.ret:
+    pop r14
+    pop rbp
+    ret
+
+; lazy: block 의 페이지만 잠깐 쓸 수 있게 해서 풀고 원래 권한으로 돌림
+unpack_block:
+    call block_range
+    mov edx, PROT_RW
+    call mprotect_range
+    call decode_block
+    call block_range
+    mov edx, [r13 + 24]
+    jmp mprotect_range
+
+; 처음과 마지막 block 은 region 밖 데이터와 페이지를 같이 쓸 수 있어 바로 풀고
+; 나머지는 PROT_NONE 으로 두었다가 처음 건드릴 때 lazy_handler 가 품
+; in: r12, r13, r15
+lazy_region:
+    push rbx
+    push rbp
+    push r14
+    call block_states
+    mov rbp, rax
+    call block_span
+    mov r14, rax
+    cmp r14, 2
+    jbe .all
+    mov ecx, [rel block_shift]
+    mov edi, 1
+    shl rdi, cl
+    add rdi, rdx
+    add rdi, r12                ; 두 번째 block 시작
+    lea rsi, [r14 - 1]
+    shl rsi, cl
+    add rsi, rdx
+    add rsi, r12                ; 마지막 block 시작
+    xor edx, edx                ; PROT_NONE
+    call mprotect_range
+    xor ebx, ebx
+    call unpack_block
+    mov byte [rbp], 2
+    lea rbx, [r14 - 1]
+    call unpack_block
+    mov byte [rbp + rbx], 2
+    jmp .ret
+.all:
+    xor ebx, ebx
+.next:
+    cmp rbx, r14
+    jae .ret
+    call unpack_block
+    mov byte [rbp + rbx], 2
+    inc rbx
+    jmp .next
+.ret:
+    pop r14
+    pop rbp
+    pop rbx
+    ret
+
+; --profile: 시작할 때 건드리는 block 을 처음 건드린 순서대로 미리 품 (fault 없이)
+; 아직 thread 가 하나뿐이라 상태 byte 를 잠그지 않음
+unpack_hot:
+    push rbx
+    push rbp
+    push r13
+    push r14
+    lea rbp, [rel _start]
+    mov eax, [rel hot_offset]
+    add rbp, rax
+    mov r14d, [rel hot_count]
+.next:
+    test r14d, r14d
+    jz .ret
+    mov eax, [rbp]
+    mov ebx, eax
+    and ebx, (1 << HOT_BLOCK_BITS) - 1
+    shr eax, HOT_BLOCK_BITS
+    imul eax, eax, REGION_SIZE
+    lea r13, [rel regions]
+    add r13, rax
+    call block_states
+    cmp byte [rax + rbx], 0
+    jne .skip
+    mov byte [rax + rbx], 2
+    call unpack_block
+.skip:
+    add rbp, 4
+    dec r14d
+    jmp .next
+.ret:
+    pop r14
+    pop r13
+    pop rbp
+    pop rbx
+    ret
+
+; --huge-pages: region 안의 2MB 정렬 범위를 MADV_HUGEPAGE 인 익명 mapping 으로 바꿔 둠.
+; 2MB 정렬 자리에 내용 (암호문, 압축했으면 0) 을 옮기고 mremap 으로 원래 자리에 덮으므로
+; 복호화 / 압축 해제가 4KB copy-on-write fault 없이 huge page 에 바로 씀.
+; 실패하면 그 범위는 원래 mapping 그대로
+; in: r12 = load bias
+huge_remap:
+    cmp dword [rel huge_pages], 0
+    je .ret
+    push rbx
+    push rbp
+    push r13
+    push r14
+    push r15
+    lea r13, [rel regions]
+    mov r14d, [rel region_count]
+.next:
+    test r14d, r14d
+    jz .done
+    mov rbx, [r13]              ; vaddr
+    add rbx, r12
+    mov r15, [r13 + 8]
+    add r15, rbx                ; region end
+    add rbx, HUGE_PAGE_SIZE - 1
+    and rbx, -HUGE_PAGE_SIZE    ; rbx = 안쪽 시작
+    and r15, -HUGE_PAGE_SIZE
+    cmp rbx, r15
+    jae .skip
+    sub r15, rbx                ; r15 = 크기 (2MB 배수)
+
+    xor edi, edi
+    lea rsi, [r15 + HUGE_PAGE_SIZE]
+    mov edx, PROT_RW
+    mov r10d, MAP_PRIVATE | MAP_ANONYMOUS
+    mov r8, -1
+    xor r9d, r9d
+    mov eax, SYS_MMAP
+    syscall
+    cmp rax, -4095
+    jae .skip
+    mov rbp, rax
+    lea r9, [rax + HUGE_PAGE_SIZE - 1]
+    and r9, -HUGE_PAGE_SIZE     ; r9 = 2MB 정렬 자리 (syscall 이 안 건드림)
+
+    mov rdi, r9
+    mov rsi, r15
+    mov edx, MADV_HUGEPAGE
+    mov eax, SYS_MADVISE
+    syscall                     ; THP 가 꺼져 있어도 그냥 4KB 로 진행
+    mov rdi, r9
+    mov rsi, rbx
+    mov rcx, r15
+    rep movsb
+    mov rdi, r9
+    mov rsi, r15
+    mov rdx, r15
+    mov r10d, MREMAP_MOVE
+    mov r8, rbx
+    mov eax, SYS_MREMAP
+    syscall
+    ; 남은 앞뒤 (mremap 이 실패했으면 전부) 를 돌려줌
+    mov rdi, rbp
+    lea rsi, [r15 + HUGE_PAGE_SIZE]
+    mov eax, SYS_MUNMAP
+    syscall
+.skip:
+    add r13, REGION_SIZE
+    dec r14d
+    jmp .next
+.done:
+    pop r15
+    pop r14
+    pop r13
+    pop rbp
+    pop rbx
+.ret:
+    ret
+
+; sched_getaffinity 로 이 프로세스가 쓸 수 있는 CPU 수 (실패하면 1)
+; out: eax
+cpu_count:
+    sub rsp, 128                ; CPU 1024 개까지
+    xor edi, edi
+    mov esi, 128
+    mov rdx, rsp
+    mov eax, SYS_SCHED_GETAFFINITY
+    syscall
+    mov ecx, 1
+    test rax, rax
+    jle .ret
+    xor ecx, ecx
+    mov rsi, rsp
+    lea rdi, [rsp + rax]        ; 커널이 채운 만큼 (long 단위)
+.word:
+    cmp rsi, rdi
+    jae .ret
+    mov r8, [rsi]
+.bit:
+    test r8, r8                 ; POPCNT 는 baseline x86-64 가 아님
+    jz .next
+    lea r9, [r8 - 1]
+    and r8, r9
+    inc ecx
+    jmp .bit
+.next:
+    add rsi, 8
+    jmp .word
+.ret:
+    mov eax, ecx
+    add rsp, 128
+    ret
+
+; 상태 byte 를 lock cmpxchg 로 먼저 잡은 thread 가 그 block 을 풂
+; in: r12, r15
+unpack_worker:
+    push rbx
+    push rbp
+    push r13
+    push r14
+    sub rsp, 8                  ; [rsp] = 이 region 의 block 수
+    lea r13, [rel regions]
+    mov r14d, [rel region_count]
+.region:
+    test r14d, r14d
+    jz .ret
+    call block_states
+    mov rbp, rax
+    call block_span
+    mov [rsp], rax
+    xor ebx, ebx
+.block:
+    cmp rbx, [rsp]
+    jae .next_region
+    xor eax, eax
+    mov ecx, 1
+    lock cmpxchg [rbp + rbx], cl
+    jne .skip
+    call decode_block
+    mov byte [rbp + rbx], 2
+.skip:
+    inc rbx
+    jmp .block
+.next_region:
+    add r13, REGION_SIZE
+    dec r14d
+    jmp .region
+.ret:
+    add rsp, 8
+    pop r14
+    pop r13
+    pop rbp
+    pop rbx
+    ret
+
+; ebx 번 worker 를 raw clone 으로 띄움 (libc 초기화 전이라 pthread 없음)
+; stack 은 mmap, tid 는 thread_tids[ebx] (CLONE_CHILD_CLEARTID 로 끝나면 0 + futex wake)
+spawn_worker:
+    xor edi, edi
+    mov esi, THREAD_STACK_SIZE
+    mov edx, PROT_RW
+    mov r10d, MAP_PRIVATE | MAP_ANONYMOUS
+    mov r8, -1
+    xor r9d, r9d
+    mov eax, SYS_MMAP
+    syscall
+    test rax, rax
+    js fail
+    lea rcx, [rel thread_stacks]
+    mov [rcx + rbx * 8], rax
+    lea rsi, [rax + THREAD_STACK_SIZE]
+    mov edi, CLONE_WORKER
+    lea rdx, [rel thread_tids]
+    lea rdx, [rdx + rbx * 4]    ; parent_tid
+    mov r10, rdx                ; child_tid
+    xor r8d, r8d
+    mov eax, SYS_CLONE
+    syscall
+    test rax, rax
+    js fail
+    jz .child
+    ret
+.child:
+    ; 새 stack 에서 시작 (레지스터는 부모와 같음: r12, r15)
+    call unpack_worker
+    mov eax, SYS_EXIT
+    xor edi, edi
+    syscall
+
+; block 으로 나눈 region 들을 min(CPU 수, max_threads) 개 thread 로 나눠 품
+; 자기 자신도 worker 로 일하고, 나머지를 기다린 뒤 권한을 되돌림
+; in: r12 = load bias, r15 = kernel
+parallel_unpack:
+    push rbx
+    push rbp
+    push r13
+    push r14
+    ; region 전체를 한 번에 RW 로 (block 마다 mprotect 하면 VMA 가 잘게 쪼개짐)
+    lea r13, [rel regions]
+    mov r14d, [rel region_count]
+.rw:
+    test r14d, r14d
+    jz .spawn
+    mov edx, PROT_RW
+    call region_mprotect
+    add r13, REGION_SIZE
+    dec r14d
+    jmp .rw
+.spawn:
+    call cpu_count
+    cmp eax, [rel max_threads]
+    cmova eax, [rel max_threads]
+    mov ecx, MAX_THREADS
+    cmp eax, ecx
+    cmova eax, ecx
+    test eax, eax
+    jnz .count
+    inc eax
+.count:
+    lea ebp, [rax - 1]          ; 띄울 worker 수
+    xor ebx, ebx
+.next_spawn:
+    cmp ebx, ebp
+    jae .work
+    call spawn_worker
+    inc ebx
+    jmp .next_spawn
+.work:
+    call unpack_worker
+    xor ebx, ebx
+.join:
+    cmp ebx, ebp
+    jae .restore
+    lea rdi, [rel thread_tids]
+    lea rdi, [rdi + rbx * 4]
+.wait:
+    mov edx, [rdi]
+    test edx, edx
+    jz .joined
+    mov esi, FUTEX_WAIT         ; *rdi 가 아직 edx 면 잠듦 (syscall 은 rdi 를 보존)
+    xor r10d, r10d
+    mov eax, SYS_FUTEX
+    syscall
+    jmp .wait
+.joined:
+    lea rax, [rel thread_stacks]
+    mov rdi, [rax + rbx * 8]
+    mov esi, THREAD_STACK_SIZE
+    mov eax, SYS_MUNMAP
+    syscall
+    inc ebx
+    jmp .join
+.restore:
+    lea r13, [rel regions]
+    mov r14d, [rel region_count]
+.prot:
+    test r14d, r14d
+    jz .ret
+    mov edx, [r13 + 24]
+    call region_mprotect
+    add r13, REGION_SIZE
+    dec r14d
+    jmp .prot
+.ret:
+    pop r14
+    pop r13
+    pop rbp
+    pop rbx
+    ret
+
+; SIGSEGV handler (SA_SIGINFO, rsi = siginfo, si_addr 은 +16)
+; 아직 안 풀린 lazy block 이면 풀고 돌아가서 그 명령을 다시 실행
+; 아니면 SIG_DFL 로 되돌리고 돌아감 -> 같은 fault 가 원래대로 프로세스를 끝냄
+; 여러 thread 가 같은 block 을 건드리면 상태 byte 를 먼저 잡은 쪽이 풀고 나머지는 기다림
+lazy_handler:
+    push rbx
+    push rbp
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 16                 ; [rsp] = page fault error code (16 으로 정렬 유지)
+    mov rax, [rdx + UC_ERR]
+    mov [rsp], rax
+    mov r12, [rel load_bias]
+    mov r15, [rel kernel_entry]
+    mov r14, [rsi + 16]
+    sub r14, r12                ; link 주소
+    lea r13, [rel regions]
+    mov ebp, [rel region_count]
+.find:
+    test ebp, ebp
+    jz .not_ours
+    mov rax, [r13]
+    and rax, PAGE_MASK
+    cmp r14, rax
+    jb .next
+    mov rax, [r13]
+    add rax, [r13 + 8]
+    add rax, ~PAGE_MASK
+    and rax, PAGE_MASK
+    cmp r14, rax
+    jb .found
+.next:
+    add r13, REGION_SIZE
+    dec ebp
+    jmp .find
+.found:
+    call block_span
+    mov rbx, r14
+    sub rbx, rdx
+    mov ecx, [rel block_shift]
+    shr rbx, cl
+    call block_states
+    lea rbp, [rax + rbx]
+    xor eax, eax
+    mov ecx, 1
+    lock cmpxchg [rbp], cl
+    jne .busy
+    call unpack_block
+    mov byte [rbp], 2
+    jmp .ret
+.busy:
+    ; 1: 다른 thread 가 푸는 중. 다 풀 때까지 기다렸다가 돌아가서 fault 난 명령을 다시 실행
+    cmp al, 1
+    je .wait
+    ; 2: 이미 풀린 block 의 fault 는 진짜 (읽기 전용 text 에 store 등) 이므로 SIG_DFL 로 죽게 함.
+    ; 읽기 / 실행 fault 만은 fault 와 handler 사이에 다른 thread 가 푼 것일 수 있어서 다시 실행
+    ; (풀린 block 은 읽기 / 실행이 되므로 같은 fault 가 되풀이되지 않음)
+    test byte [rsp], PF_WRITE
+    jnz .not_ours
+    jmp .ret
+.wait:
+    pause
+    cmp byte [rbp], 2
+    jne .wait
+    jmp .ret
+.not_ours:
+    xor edi, edi                ; SIG_DFL
+    call install_handler
+.ret:
+    add rsp, 16
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbp
+    pop rbx
+    ret
+
+; rt_sigaction(SIGSEGV, { rdi, SA_SIGINFO | SA_RESTORER, sigreturn, 0 }, NULL, 8)
+install_handler:
+    sub rsp, 32
+    mov [rsp], rdi
+    mov qword [rsp + 8], SA_SIGINFO | SA_RESTORER
+    lea rax, [rel sigreturn]
+    mov [rsp + 16], rax
+    mov qword [rsp + 24], 0
+    mov edi, SIGSEGV
+    mov rsi, rsp
+    xor edx, edx
+    mov r10d, 8
+    mov eax, SYS_RT_SIGACTION
+    syscall
+    add rsp, 32
+    test rax, rax
+    js fail
+    ret
+
+sigreturn:
+    mov eax, SYS_RT_SIGRETURN
+    syscall
+
+; out: eax = FEAT_* 비트 (OS 가 ymm/zmm 상태를 저장해 주는 경우만 AVX 계열을 켬)
+; rbx 를 바꾸므로 호출 전에 저장되어 있어야 함
+detect_features:
+    xor r8d, r8d
+    mov eax, 1
+    cpuid
+    bt ecx, 25                  ; AES-NI
+    jnc .no_aesni
+    or r8d, FEAT_AESNI
+.no_aesni:
+    bt ecx, 27                  ; OSXSAVE
+    jnc .ret
+    bt ecx, 28                  ; AVX
+    jnc .ret
+    xor ecx, ecx
+    xgetbv
+    mov r9d, eax                ; XCR0
+    and eax, 6
+    cmp eax, 6                  ; xmm + ymm
+    jne .ret
+
+    mov eax, 7
+    xor ecx, ecx
+    cpuid
+    bt ebx, 5                   ; AVX2
+    jnc .ret
+    or r8d, FEAT_AVX2
+    bt ecx, 9                   ; VAES
+    jnc .no_vaes
+    or r8d, FEAT_VAES
+.no_vaes:
+    mov eax, r9d
+    and eax, 0xe6
+    cmp eax, 0xe6               ; opmask + zmm 상위 + zmm16-31
+    jne .ret
+    bt ebx, 16                  ; AVX512F
+    jnc .ret
+    bt ebx, 30                  ; AVX512BW
+    jnc .ret
+    or r8d, FEAT_AVX512
+.ret:
+    mov eax, r8d
+    ret
+
+; LZ4 block 해제 (lz4.c 가 만든 형식)
+; in: rsi = src, rcx = src 크기, rdi = dst, rdx = dst 크기, eax = FILTER_*
+; literal/match 는 16 bytes 씩 넘치게 복사하고 (끝에 여유가 있을 때만), 끝부분은 rep movsb
+; 겹치는 match 는 offset 8..15 면 8 bytes 씩, 1 이면 rep stosb, 나머지는 rep movsb
+; (rep movsb 는 앞에서부터 한 byte 씩 복사한 것과 같은 결과)
+; FILTER_BCJ 면 match 가 더 이상 참조할 수 없는 (64KB 보다 뒤처진) 출력을 풀면서 바로
+; bcj_unfilter 로 되돌림. 아직 cache 에 있을 때 처리해서 region 을 따로 다시 읽지 않음
+lz4_decompress:
+    push rbx
+    push rbp
+    cld
+    mov rbx, rdi                ; region 시작 (BCJ 위치 기준)
+    xor ebp, ebp                ; BCJ 로 되돌릴 다음 위치, 0 이면 필터 없음
+    cmp eax, FILTER_BCJ
+    cmove rbp, rdi
+    lea r8, [rsi + rcx]         ; src 끝
+    lea r9, [rdi + rdx]         ; dst 끝
+.sequence:
+    test rbp, rbp
+    jz .token
+    mov rax, rdi
+    sub rax, rbp
+    cmp rax, BCJ_LAG + BCJ_BATCH
+    jb .token
+    push rsi
+    push rdi
+    lea rdx, [rdi - BCJ_LAG]
+    mov rsi, rbp
+    mov rdi, rbx
+    call bcj_unfilter
+    mov rbp, rsi
+    pop rdi
+    pop rsi
+.token:
+    movzx eax, byte [rsi]       ; token
+    inc rsi
+    mov ecx, eax
+    shr ecx, 4                  ; literal 길이
+    cmp ecx, 15
+    jne .literal
+.literal_len:
+    movzx edx, byte [rsi]
+    inc rsi
+    add rcx, rdx
+    cmp edx, 255
+    je .literal_len
+.literal:
+    lea r11, [rdi + rcx]        ; literal 끝 (dst)
+    lea rdx, [rsi + rcx]        ; literal 끝 (src)
+    lea r10, [r11 + 16]
+    cmp r10, r9
+    ja .literal_tail
+    lea r10, [rdx + 16]
+    cmp r10, r8
+    ja .literal_tail
+.literal_copy:
+    movdqu xmm0, [rsi]
+    movdqu [rdi], xmm0
+    add rsi, 16
+    add rdi, 16
+    cmp rdi, r11
+    jb .literal_copy
+    mov rsi, rdx
+    mov rdi, r11
+    jmp .literal_done
+.literal_tail:
+    rep movsb
+.literal_done:
+    cmp rsi, r8                 ; 마지막 sequence 는 literal 만 있음
+    jae .ret
+
+    movzx edx, word [rsi]       ; offset
+    add rsi, 2
+    and eax, 15                 ; match 길이 - 4
+    cmp eax, 15
+    jne .match
+.match_len:
+    movzx ecx, byte [rsi]
+    inc rsi
+    add rax, rcx
+    cmp ecx, 255
+    je .match_len
+.match:
+    lea rcx, [rax + 4]
+    mov r10, rdi
+    sub r10, rdx                ; match 시작
+    lea r11, [rdi + rcx]        ; match 끝
+    lea rax, [r11 + 16]
+    cmp rax, r9
+    ja .match_tail
+    cmp rdx, 16
+    jb .match_short_offset
+.match_copy16:
+    movdqu xmm0, [r10]
+    movdqu [rdi], xmm0
+    add r10, 16
+    add rdi, 16
+    cmp rdi, r11
+    jb .match_copy16
+    mov rdi, r11
+    jmp .sequence
+.match_short_offset:
+    cmp rdx, 8
+    jb .match_tail
+.match_copy8:
+    mov rax, [r10]
+    mov [rdi], rax
+    add r10, 8
+    add rdi, 8
+    cmp rdi, r11
+    jb .match_copy8
+    mov rdi, r11
+    jmp .sequence
+.match_tail:
+    cmp rdx, 1
+    jne .match_movsb
+    movzx eax, byte [r10]       ; 같은 byte 반복 (0 으로 채운 padding 등)
+    rep stosb
+    jmp .sequence
+.match_movsb:
+    mov r11, rsi
+    mov rsi, r10
+    rep movsb
+    mov rsi, r11
+    jmp .sequence
+.ret:
+    test rbp, rbp
+    jz .out
+    mov rsi, rbp                ; 남은 부분 (opcode 뒤 4 bytes 가 region 안에 있는 곳까지)
+    lea rdx, [r9 - 4]
+    mov rdi, rbx
+    call bcj_unfilter
+.out:
+    pop rbp
+    pop rbx
+    ret
+
+; bcj.c 의 역변환. [rsi, rdx) 에서 시작하는 E8/E9 의 rel32 를 되돌림
+; in: rsi = 시작, rdx = 끝 (opcode 위치 기준), rdi = region 시작
+; out: rsi = 다음 시작 위치 (마지막 operand 를 건너뛰어 rdx 보다 클 수 있음)
+; rax, rcx, r10, r11, xmm0-3 사용
+; SSE2 로 16 bytes 의 E8/E9 위치를 mask 로 만들고, mask 안의 후보를 차례로 처리
+bcj_unfilter:
+    mov eax, 0xe8e8e8e8
+    movd xmm1, eax
+    pshufd xmm1, xmm1, 0
+    mov eax, 0xe9e9e9e9
+    movd xmm2, eax
+    pshufd xmm2, xmm2, 0
+.scan:
+    cmp rsi, rdx
+    jae .ret
+    lea rax, [rsi + 16]
+    cmp rax, rdx
+    ja .scan_byte
+    movdqu xmm0, [rsi]
+    movdqa xmm3, xmm0
+    pcmpeqb xmm0, xmm1
+    pcmpeqb xmm3, xmm2
+    por xmm0, xmm3
+    pmovmskb r10d, xmm0
+    test r10d, r10d
+    jz .next16
+.candidate:
+    bsf ecx, r10d
+    lea r11, [rsi + rcx]        ; opcode 위치
+    call .convert
+    lea rcx, [r11 + 5]
+    sub rcx, rsi                ; operand 다음 위치 (이 16 bytes 기준)
+    cmp ecx, 16
+    jae .next_operand
+    shr r10d, cl                ; operand 안의 후보는 버림
+    shl r10d, cl
+    jnz .candidate
+.next16:
+    add rsi, 16
+    jmp .scan
+.next_operand:
+    lea rsi, [r11 + 5]
+    jmp .scan
+
+.scan_byte:
+    mov al, [rsi]
+    and al, 0xfe
+    cmp al, 0xe8
+    je .byte_candidate
+    inc rsi
+    jmp .scan
+.byte_candidate:
+    mov r11, rsi
+    call .convert
+    jmp .next_operand
+
+; in: r11 = E8/E9 위치. 범위 밖의 operand 는 그대로 둠 (bcj.c 와 같은 판단)
+.convert:
+    mov eax, [r11 + 1]
+    lea ecx, [rax + BCJ_RANGE]
+    test ecx, ~BCJ_MASK
+    jnz .ret
+    mov rcx, r11
+    sub rcx, rdi
+    add ecx, 5                  ; 다음 명령 위치
+    sub eax, ecx
+    add eax, BCJ_RANGE
+    and eax, BCJ_MASK
+    sub eax, BCJ_RANGE
+    mov [r11 + 1], eax
+.ret:
+    ret
+
+; mprotect(page_start(region), page_len(region), rdx)
+; in: r12 = load bias, r13 = region, rdx = prot
+region_mprotect:
+    mov rdi, [r13]
+    add rdi, r12
+    mov rsi, [r13 + 8]
+    add rsi, rdi                ; region end
+
+; [rdi, rsi) 를 덮는 페이지들에 mprotect(rdx)
+mprotect_range:
+    and rdi, PAGE_MASK
+    add rsi, ~PAGE_MASK
+    and rsi, PAGE_MASK
+    sub rsi, rdi
+    mov eax, SYS_MPROTECT
+    syscall
+    test rax, rax
+    js fail
+    ret
+
+%ifdef TELEMETRY
+; 환경 변수 WOODY_TELEMETRY=<fd> 면 그 fd 에, =/path 면 그 파일 끝에 record 를 씀. 없거나 실패하면 그냥 넘어감
+; in: rdi = 진입 시 rsp (argc, argv..., 0, envp..., 0)
+telemetry_write:
+    mov rax, [rdi]
+    lea rdi, [rdi + rax * 8 + 16]   ; envp
+.next_env:
+    mov rsi, [rdi]
+    test rsi, rsi
+    jz .ret
+    add rdi, 8
+    lea rcx, [rel telemetry_env]
+    xor edx, edx
+.compare:
+    movzx eax, byte [rcx + rdx]
+    test eax, eax
+    jz .found
+    cmp al, [rsi + rdx]
+    jne .next_env
+    inc edx
+    jmp .compare
+.found:
+    add rsi, rdx                ; 값
+    movzx eax, byte [rsi]
+    cmp eax, 0x2f               ; '/'
+    je .path
+    sub eax, 0x30               ; '0'
+    cmp eax, 9
+    ja .ret
+    xor edi, edi
+.digit:
+    imul edi, edi, 10
+    add edi, eax
+    inc rsi
+    movzx eax, byte [rsi]
+    sub eax, 0x30
+    cmp eax, 9
+    jbe .digit
+    jmp write_record
+.path:
+    mov rdi, rsi
+    mov esi, O_TELEMETRY
+    mov edx, 0x1a4              ; 0644
+    mov eax, SYS_OPEN
+    syscall
+    test eax, eax
+    js .ret
+    push rax
+    mov edi, eax
+    call write_record
+    pop rdi
+    mov eax, SYS_CLOSE
+    syscall
+.ret:
+    ret
+
+; in: edi = fd
+write_record:
+    lea rsi, [rel telemetry_record]
+    mov edx, TELEMETRY_SIZE
+    mov eax, SYS_WRITE
+    syscall
+    ret
+%endif
+
+fail:
+    mov edi, 127
+    mov eax, SYS_EXIT_GROUP
+    syscall
+
+msg: db "inskim", 0x0a
+
+; lazy_handler 가 쓰는 값 (stub 이 시작할 때 채움)
+align 8
+load_bias: dq 0
+kernel_entry: dq 0
+
+; parallel_unpack 의 worker
+thread_stacks: times MAX_THREADS dq 0
+thread_tids: times MAX_THREADS dd 0
+
+%ifdef TELEMETRY
+telemetry_env: db "WOODY_TELEMETRY=", 0
+
+; t_telemetry_record (telemetry.h). packer 가 magic 으로 찾아 id 를 채움
+align 8
+telemetry_record:
+    dd TELEMETRY_MAGIC
+    dw TELEMETRY_VERSION
+    dw TSC_POINTS
+    dq 0                        ; id
+telemetry_features: dd 0
+telemetry_kernel: dd 0
+telemetry_tsc: times TSC_POINTS dq 0
+%endif
+
+; packer 가 덮어쓰는 t_stub_params (payload.h) 자리, 뒤에 kernel 들이 붙음
+align 8
+params:
+oep: dq 0x1122334455667788      ; Placeholder
+stub_vaddr: dq 0
+key: times 32 db 0
+nonce: times 16 db 0
+region_count: dd 0
+cipher: dd 0
+aes_rounds: dd 0
+filter: dd 0
+round_keys: times 240 db 0
+kernel_count: dd 0
+    dd 0
+kernels: times MAX_KERNELS * KERNEL_SIZE db 0
+regions: times MAX_REGIONS * REGION_SIZE db 0
+block_shift: dd 0
+state_offset: dd 0
+hot_offset: dd 0
+hot_count: dd 0
+lazy: dd 0
+max_threads: dd 0
+huge_pages: dd 0
+    dd 0
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   uring.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/19 10:42:08 by insub             #+#    #+#             */
+/*   Updated: 2026/01/19 17:31:55 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "uring.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+static int sys_setup(unsigned entries, struct io_uring_params *params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int sys_enter(int fd, unsigned submit, unsigned wait, unsigned flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, submit, wait, flags, NULL, 0);
+}
+
+// 커널이 io_uring 을 막았거나 (ENOSYS, io_uring_disabled, seccomp) 메모리가 없으면 -1
+int uring_init(t_uring *ring, unsigned entries)
+{
+    struct io_uring_params params;
+
+    memset(&params, 0, sizeof(params));
+    *ring = (t_uring){ .fd = -1 };
+    ring->fd = sys_setup(entries, &params);
+    if (ring->fd < 0)
+        return -1;
+    ring->entries = params.sq_entries;
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (ring->cq_ring_size > ring->sq_ring_size)
+            ring->sq_ring_size = ring->cq_ring_size;
+        ring->cq_ring_size = 0;
+    }
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED)
+        goto fail;
+    ring->cq_ring = ring->sq_ring;
+    if (ring->cq_ring_size)
+    {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED)
+            goto fail;
+    }
+    ring->sqes = mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe),
+                      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+        goto fail;
+
+    char *sq = ring->sq_ring;
+    char *cq = ring->cq_ring;
+    ring->sq_head = (unsigned *)(sq + params.sq_off.head);
+    ring->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    ring->sq_mask = (unsigned *)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)(sq + params.sq_off.array);
+    ring->cq_head = (unsigned *)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+    return 0;
+
+fail:
+    if (ring->sqes == MAP_FAILED)
+        ring->sqes = NULL;
+    if (ring->cq_ring == MAP_FAILED || ring->cq_ring == ring->sq_ring)
+        ring->cq_ring = NULL;
+    if (ring->sq_ring == MAP_FAILED)
+        ring->sq_ring = NULL;
+    uring_exit(ring);
+    return -1;
+}
+
+void uring_exit(t_uring *ring)
+{
+    if (ring->sqes)
+        munmap(ring->sqes, ring->entries * sizeof(struct io_uring_sqe));
+    if (ring->cq_ring && ring->cq_ring != ring->sq_ring)
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    if (ring->sq_ring)
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    if (ring->fd >= 0)
+        close(ring->fd);
+    *ring = (t_uring){ .fd = -1 };
+}
+
+int uring_register(t_uring *ring, unsigned opcode, void *arg, unsigned count)
+{
+    return (int)syscall(__NR_io_uring_register, ring->fd, opcode, arg, count);
+}
+
+// 지금 더 채울 수 있는 sqe 수 (link 묶음은 한 번의 enter 에 다 들어가야 하므로 미리 확인)
+unsigned uring_space(const t_uring *ring)
+{
+    unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+
+    return ring->entries - (*ring->sq_tail + ring->queued - head);
+}
+
+// 0 으로 채운 sqe. ring 이 차 있으면 NULL
+struct io_uring_sqe *uring_get_sqe(t_uring *ring)
+{
+    if (uring_space(ring) == 0)
+        return NULL;
+
+    unsigned            index = (*ring->sq_tail + ring->queued) & *ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+
+    ring->sq_array[index] = index;
+    ring->queued++;
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+// 채운 sqe 를 넘기고 cqe 가 wait 개 이상 쌓일 때까지 기다림
+int uring_submit(t_uring *ring, unsigned wait)
+{
+    __atomic_store_n(ring->sq_tail, *ring->sq_tail + ring->queued, __ATOMIC_RELEASE);
+    ring->queued = 0;
+    while (TRUE)
+    {
+        // 커널이 아직 가져가지 않은 sqe (EINTR 로 돌아온 경우 일부만 넘어갔을 수 있음)
+        unsigned submit = *ring->sq_tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+        if (submit == 0 && wait == 0)
+            return 0;
+        if (sys_enter(ring->fd, submit, wait, wait ? IORING_ENTER_GETEVENTS : 0) >= 0)
+            return 0;
+        if (errno != EINTR)
+            return -1;
+    }
+}
+
+// 끝난 요청 하나를 꺼냄. 없으면 FALSE
+int uring_peek(t_uring *ring, struct io_uring_cqe *cqe)
+{
+    unsigned head = *ring->cq_head;
+
+    if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE))
+        return FALSE;
+    *cqe = ring->cqes[head & *ring->cq_mask];
+    __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+    return TRUE;
+}
@@ -0,0 +1,436 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watch.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/29 15:02:44 by insub             #+#    #+#             */
+/*   Updated: 2026/01/29 15:02:44 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "watch.h"
+#include "pack.h"
+#include "repack.h"
+#include "print_utils.h"
+#include <dirent.h>
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+
+# define WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR)
+
+typedef struct s_watch_worker
+{
+    pthread_t   thread;
+    t_watch     *watch;
+    int         id;
+}   t_watch_worker;
+
+static volatile sig_atomic_t g_stop;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    g_stop = TRUE;
+}
+
+static uint64_t now_ms(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static int has_suffix(const char *name, const char *suffix)
+{
+    size_t len = strlen(name);
+    size_t n = strlen(suffix);
+
+    return len >= n && strcmp(name + len - n, suffix) == 0;
+}
+
+// 이 mode 가 만든 출력 / manifest, 숨김 파일과 임시 파일은 보지 않음 (다시 pack 하면 끝이 없음)
+static int is_ignored(const char *name)
+{
+    return name[0] == '.' || has_suffix(name, ".woody") || has_suffix(name, REPACK_SUFFIX)
+        || has_suffix(name, ".tmp");
+}
+
+static char *join_path(const char *dir, const char *name)
+{
+    char *path = malloc(strlen(dir) + strlen(name) + 2);
+
+    if (path)
+        sprintf(path, "%s/%s", dir, name);
+    return path;
+}
+
+// 실행 파일 / 공유 객체만 (.o 같은 ET_REL 은 build 중에 계속 생기므로 FAIL 로 찍지 않고 건너뜀)
+static int is_packable(const char *path)
+{
+    Elf64_Ehdr  ehdr;
+    struct stat st;
+    int         fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+        return FALSE;
+    int ok = fstat(fd, &st) == 0 && S_ISREG(st.st_mode)
+        && read(fd, &ehdr, sizeof(ehdr)) == sizeof(ehdr)
+        && memcmp(ehdr.e_ident, ELFMAG, SELFMAG) == 0 && ehdr.e_ident[EI_CLASS] == ELFCLASS64
+        && (ehdr.e_type == ET_EXEC || ehdr.e_type == ET_DYN) && ehdr.e_entry != 0;
+    close(fd);
+    return ok;
+}
+
+// 쓰기가 끝날 때마다 deadline 을 뒤로 미룸 (링커가 여러 번 열고 닫아도 한 번만 pack)
+static void add_pending(t_watch *watch, const char *path)
+{
+    uint64_t deadline = now_ms() + watch->debounce;
+
+    for (size_t i = 0; i < watch->pending_count; i++)
+    {
+        if (strcmp(watch->pending[i].path, path) == 0)
+        {
+            watch->pending[i].deadline = deadline;
+            return;
+        }
+    }
+    if (watch->pending_count == watch->pending_cap)
+    {
+        size_t      cap = watch->pending_cap ? watch->pending_cap * 2 : 64;
+        t_pending   *grown = realloc(watch->pending, cap * sizeof(*grown));
+        if (!grown)
+            return;
+        watch->pending = grown;
+        watch->pending_cap = cap;
+    }
+    char *copy = strdup(path);
+    if (copy)
+        watch->pending[watch->pending_count++] = (t_pending){ copy, deadline };
+}
+
+static const char *find_dir(const t_watch *watch, int wd)
+{
+    for (size_t i = 0; i < watch->dir_count; i++)
+        if (watch->dirs[i].wd == wd)
+            return watch->dirs[i].path;
+    return NULL;
+}
+
+static void remember_dir(t_watch *watch, int wd, const char *path)
+{
+    char *copy = strdup(path);
+
+    if (!copy)
+        return;
+    for (size_t i = 0; i < watch->dir_count; i++)
+    {
+        if (watch->dirs[i].wd == wd)
+        {
+            free(watch->dirs[i].path);
+            watch->dirs[i].path = copy;
+            return;
+        }
+    }
+    if (watch->dir_count == watch->dir_cap)
+    {
+        size_t      cap = watch->dir_cap ? watch->dir_cap * 2 : 64;
+        t_watch_dir *grown = realloc(watch->dirs, cap * sizeof(*grown));
+        if (!grown)
+        {
+            free(copy);
+            return;
+        }
+        watch->dirs = grown;
+        watch->dir_cap = cap;
+    }
+    watch->dirs[watch->dir_count++] = (t_watch_dir){ wd, copy };
+}
+
+static void forget_dir(t_watch *watch, int wd)
+{
+    for (size_t i = 0; i < watch->dir_count; i++)
+    {
+        if (watch->dirs[i].wd == wd)
+        {
+            free(watch->dirs[i].path);
+            watch->dirs[i] = watch->dirs[--watch->dir_count];
+            return;
+        }
+    }
+}
+
+// path 와 그 아래 디렉터리를 모두 watch. 새로 생긴 디렉터리는 (watch 를 걸기 전에 이미 들어온
+// 파일이 있을 수 있으므로) scan 해서 안의 파일도 pending 에 넣음
+static void add_dir(t_watch *watch, const char *path, int scan)
+{
+    char            real[PATH_MAX];
+    struct dirent   *ent;
+
+    if (watch->out_real && realpath(path, real) && strcmp(real, watch->out_real) == 0)
+        return;
+    if (watch->cache_real && realpath(path, real) && strcmp(real, watch->cache_real) == 0)
+        return;
+    int wd = inotify_add_watch(watch->fd, path, WATCH_EVENTS);
+    if (wd < 0)
+    {
+        fprintf(stderr, "watch: %s: %s\n", path, strerror(errno));
+        return;
+    }
+    remember_dir(watch, wd, path);
+
+    DIR *d = opendir(path);
+    if (!d)
+        return;
+    while ((ent = readdir(d)))
+    {
+        struct stat st;
+        if (is_ignored(ent->d_name))
+            continue;
+        char *child = join_path(path, ent->d_name);
+        if (!child)
+            break;
+        int type = ent->d_type;
+        if (type == DT_UNKNOWN && lstat(child, &st) == 0)
+            type = S_ISDIR(st.st_mode) ? DT_DIR : S_ISREG(st.st_mode) ? DT_REG : DT_UNKNOWN;
+        if (type == DT_DIR)
+            add_dir(watch, child, scan);
+        else if (type == DT_REG && scan)
+            add_pending(watch, child);
+        free(child);
+    }
+    closedir(d);
+}
+
+static void read_events(t_watch *watch)
+{
+    char    buffer[16384] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t len;
+
+    while ((len = read(watch->fd, buffer, sizeof(buffer))) > 0)
+    {
+        for (char *p = buffer; p < buffer + len; )
+        {
+            const struct inotify_event *ev = (const struct inotify_event *)p;
+            const char *dir = find_dir(watch, ev->wd);
+
+            p += sizeof(*ev) + ev->len;
+            if (ev->mask & IN_Q_OVERFLOW)
+                fprintf(stderr, "watch: event queue overflowed, some files were missed\n");
+            if (ev->mask & IN_IGNORED)
+                forget_dir(watch, ev->wd);
+            if (!dir || ev->len == 0 || is_ignored(ev->name))
+                continue;
+            char *path = join_path(dir, ev->name);
+            if (!path)
+                continue;
+            if ((ev->mask & IN_ISDIR) && (ev->mask & (IN_CREATE | IN_MOVED_TO)))
+                add_dir(watch, path, TRUE);
+            else if (!(ev->mask & IN_ISDIR) && (ev->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)))
+                add_pending(watch, path);
+            free(path);
+        }
+    }
+}
+
+// lock 을 잡고 부름
+static int is_busy(const t_watch *watch, const char *path)
+{
+    for (size_t i = 0; i < watch->count; i++)
+        if (strcmp(watch->queue[(watch->head + i) % WATCH_QUEUE], path) == 0)
+            return TRUE;
+    for (int i = 0; i < watch->workers; i++)
+        if (watch->active[i] && strcmp(watch->active[i], path) == 0)
+            return TRUE;
+    return FALSE;
+}
+
+// 조용해진 파일을 queue 로 넘김. 같은 파일을 pack 중이거나 queue 가 차 있으면 다음에.
+// 반환: 다음 deadline 까지 ms (-1 이면 기다릴 것 없음)
+static int dispatch(t_watch *watch)
+{
+    uint64_t    now = now_ms();
+    uint64_t    next = UINT64_MAX;
+
+    pthread_mutex_lock(&watch->lock);
+    for (size_t i = 0; i < watch->pending_count; )
+    {
+        t_pending *p = &watch->pending[i];
+        if (p->deadline <= now && (watch->count == WATCH_QUEUE || is_busy(watch, p->path)))
+            p->deadline = now + watch->debounce;
+        if (p->deadline > now)
+        {
+            next = p->deadline < next ? p->deadline : next;
+            i++;
+            continue;
+        }
+        if (is_packable(p->path))
+        {
+            watch->queue[(watch->head + watch->count++) % WATCH_QUEUE] = p->path;
+            pthread_cond_signal(&watch->ready);
+        }
+        else
+            free(p->path);
+        *p = watch->pending[--watch->pending_count];
+    }
+    pthread_mutex_unlock(&watch->lock);
+    return next == UINT64_MAX ? -1 : (int)(next - now);
+}
+
+static int pack_one(const t_watch *watch, const char *input)
+{
+    struct timespec start;
+    struct timespec end;
+    char            *output = default_output(input, watch->out_dir);
+    int             result;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    result = output ? pack_file(input, output, watch->config)
+                    : print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("%s %s -> %s (%.0f ms)\n",
+        result < 0 ? "FAIL" : result == PACK_CACHED ? "cached" : "packed", input,
+        output ? output : "?", (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+    fflush(stdout);
+    free(output);
+    return result;
+}
+
+// worker 는 끝날 때까지 살아 있음 (thread, heap 에 남긴 buffer 를 job 마다 다시 만들지 않음)
+static void *watch_worker(void *arg)
+{
+    t_watch_worker  *self = arg;
+    t_watch         *watch = self->watch;
+
+    pthread_mutex_lock(&watch->lock);
+    while (TRUE)
+    {
+        while (watch->count == 0 && !watch->stop)
+            pthread_cond_wait(&watch->ready, &watch->lock);
+        if (watch->count == 0)
+            break;
+        char *input = watch->queue[watch->head];
+        watch->head = (watch->head + 1) % WATCH_QUEUE;
+        watch->count--;
+        watch->active[self->id] = input;
+        pthread_mutex_unlock(&watch->lock);
+
+        int result = pack_one(watch, input);
+
+        pthread_mutex_lock(&watch->lock);
+        watch->active[self->id] = NULL;
+        watch->packed += result >= 0;
+        watch->failed += result < 0;
+        free(input);
+    }
+    pthread_mutex_unlock(&watch->lock);
+    return NULL;
+}
+
+static void free_watch(t_watch *watch)
+{
+    for (size_t i = 0; i < watch->dir_count; i++)
+        free(watch->dirs[i].path);
+    for (size_t i = 0; i < watch->pending_count; i++)
+        free(watch->pending[i].path);
+    free(watch->dirs);
+    free(watch->pending);
+    free(watch->active);
+    free(watch->out_real);
+    free(watch->cache_real);
+    if (watch->fd >= 0)
+        close(watch->fd);
+    pthread_mutex_destroy(&watch->lock);
+    pthread_cond_destroy(&watch->ready);
+}
+
+// SIGINT / SIGTERM 이 올 때까지 dir 아래에 새로 써진 ELF 를 pack. 시그널은 ppoll 안에서만 받음
+// (worker 들은 막힌 mask 를 물려받음). 끝낼 때는 queue 에 남은 job 까지 마침
+int run_watch(const char *dir, const t_batch *batch, const t_pack_config *config, int debounce_ms)
+{
+    t_pack_config   quiet = *config;
+    t_watch         watch = { .fd = -1, .out_dir = batch->out_dir, .debounce = debounce_ms,
+                              .config = &quiet, .lock = PTHREAD_MUTEX_INITIALIZER,
+                              .ready = PTHREAD_COND_INITIALIZER };
+    t_watch_worker  workers[BATCH_MAX_WORKERS];
+    sigset_t        block;
+    sigset_t        old;
+
+    quiet.quiet = TRUE;
+    set_debug(FALSE);
+    warm_heap();
+    if (batch->out_dir)
+        watch.out_real = realpath(batch->out_dir, NULL);
+    if (config->cache_dir)
+        watch.cache_real = realpath(config->cache_dir, NULL);
+    watch.workers = batch->workers ? batch->workers : cpu_count();
+    if (watch.workers > BATCH_MAX_WORKERS)
+        watch.workers = BATCH_MAX_WORKERS;
+    watch.active = calloc(watch.workers, sizeof(*watch.active));
+    watch.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (!watch.active || watch.fd < 0)
+    {
+        int ret = print_error(watch.fd < 0 ? FILE_NOT_FOUND : MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        free_watch(&watch);
+        return ret;
+    }
+    add_dir(&watch, dir, FALSE);
+    if (watch.dir_count == 0)
+    {
+        free_watch(&watch);
+        return print_error(FILE_NOT_FOUND, ERRNO_FALSE);
+    }
+
+    sigemptyset(&block);
+    sigaddset(&block, SIGINT);
+    sigaddset(&block, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &block, &old);
+    struct sigaction sa = { .sa_handler = on_signal };
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    int started = 0;
+    while (started < watch.workers)
+    {
+        workers[started] = (t_watch_worker){ .watch = &watch, .id = started };
+        if (pthread_create(&workers[started].thread, NULL, watch_worker, &workers[started]) != 0)
+            break;
+        started++;
+    }
+    printf("watch: %s (%zu directories, %d workers)\n", dir, watch.dir_count, started);
+    fflush(stdout);
+
+    struct pollfd pfd = { .fd = watch.fd, .events = POLLIN };
+    while (!g_stop && started > 0)
+    {
+        int             timeout = dispatch(&watch);
+        struct timespec ts = { timeout / 1000, (timeout % 1000) * 1000000L };
+        int             ready = ppoll(&pfd, 1, timeout < 0 ? NULL : &ts, &old);
+
+        if (ready < 0 && errno != EINTR)
+            break;
+        if (ready > 0)
+            read_events(&watch);
+    }
+
+    pthread_mutex_lock(&watch.lock);
+    watch.stop = TRUE;
+    pthread_cond_broadcast(&watch.ready);
+    pthread_mutex_unlock(&watch.lock);
+    for (int i = 0; i < started; i++)
+        pthread_join(workers[i].thread, NULL);
+    printf("watch: %zu packed, %zu failed\n", watch.packed, watch.failed);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    free_watch(&watch);
+    return started > 0 ? 0 : print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+}
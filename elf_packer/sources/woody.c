@@ -0,0 +1,247 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   woody.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 14:37:09 by insub             #+#    #+#             */
+/*   Updated: 2026/02/02 14:37:09 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "main.h"
+#include "woody.h"
+#include "file.h"
+#include "output.h"
+#include "options.h"
+#include "pack.h"
+#include "stub_image.h"
+#include "arena.h"
+#include <errno.h>
+#include <string.h>
+
+#define PAGE_SIZE 0x1000
+
+// 옵션은 woody_woodpacker 와 같은 이름 (parse_pack_option). 오류는 stderr 대신 last 에 남김
+struct s_woody
+{
+    t_pack_config   config;
+    uint8_t         key[CACHE_KEY_SIZE];
+    char            *kernel;
+    t_last_error    last;
+    char            message[128];
+};
+
+t_woody *woody_create(void)
+{
+    t_woody *ctx = calloc(1, sizeof(*ctx));
+
+    if (!ctx)
+        return NULL;
+    ctx->config.cipher = CIPHER_CHACHA20;
+    ctx->config.quiet = TRUE;
+    set_debug(FALSE);   // 진행 상황은 stdout 으로 가므로 라이브러리에서는 끔
+    return ctx;
+}
+
+void woody_destroy(t_woody *ctx)
+{
+    if (!ctx)
+        return;
+    free(ctx->kernel);
+    free(ctx);
+}
+
+void woody_free_buffer(t_woody_buffer *output)
+{
+    free(output->data);
+    *output = (t_woody_buffer){0};
+}
+
+const char *woody_error(const t_woody *ctx)
+{
+    return ctx->message;
+}
+
+static void begin(t_woody *ctx)
+{
+    ctx->last = (t_last_error){0};
+    ctx->message[0] = '\0';
+    capture_errors(&ctx->last);
+}
+
+static int end(t_woody *ctx, int ret)
+{
+    capture_errors(NULL);
+    if (ret < 0 && !ctx->last.set)
+        ctx->last = (t_last_error){ TRUE, MEMORY_ALLOCATION_FAILED, 0 };
+    if (ret < 0 && ctx->last.err_no)
+        snprintf(ctx->message, sizeof(ctx->message), "%s (%s)",
+            error_message(ctx->last.error), strerror(ctx->last.err_no));
+    else if (ret < 0)
+        snprintf(ctx->message, sizeof(ctx->message), "%s", error_message(ctx->last.error));
+    return ret < 0 ? -1 : 0;
+}
+
+// 파일 시스템을 쓰는 옵션 (--stream, --cache, --cache-size, --incremental) 은 받지 않음.
+// 틀린 옵션이면 -1 이고 그 전 설정이 그대로 남음
+int woody_option(t_woody *ctx, const char *name, const char *value)
+{
+    t_pack_config   saved = ctx->config;
+    int             used;
+
+    begin(ctx);
+    if (strcmp(name, "--stream") == 0 || strcmp(name, "--cache") == 0
+        || strcmp(name, "--cache-size") == 0 || strcmp(name, "--incremental") == 0)
+        return end(ctx, print_error(WRONG_ARGS, ERRNO_FALSE));
+    used = parse_pack_option(name, value, &ctx->config, ctx->key);
+    if (used <= 0 || (used == 1 && value))
+    {
+        ctx->config = saved;
+        return end(ctx, print_error(WRONG_ARGS, ERRNO_FALSE));
+    }
+    if (strcmp(name, "--kernel") == 0)
+    {
+        char *kernel = strdup(value);
+        if (!kernel)
+        {
+            ctx->config = saved;
+            return end(ctx, print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE));
+        }
+        free(ctx->kernel);
+        ctx->kernel = kernel;
+        ctx->config.kernel = kernel;
+    }
+    return end(ctx, 0);
+}
+
+// input 을 복사한 buffer 에서 packing. 헤더와 제자리 region 은 그 buffer 에서 바뀜
+static int pack_memory(t_woody *ctx, const void *input, size_t size,
+                       t_file *file, t_output *out, t_stub_image *stub)
+{
+    *file = (t_file){ .fd = -1 };
+    *out = (t_output){ .fd = -1 };
+    if (size == 0)
+        return print_error(INVALID_ELF, ERRNO_FALSE);
+    file->buffer = malloc(size);
+    if (!file->buffer)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    memcpy(file->buffer, input, size);
+    file->size = size;
+    return pack_image(file, &ctx->config, out, stub);
+}
+
+// 출력 = packing 한 buffer + 0 으로 채운 padding + stub (output->data 는 woody_free_buffer 로).
+// --layout cave 면 stub 이 buffer 안의 padding 을 덮고, extend 면 buffer 끝을 stub 뒤로 옮김
+int woody_pack(t_woody *ctx, const void *input, size_t size, t_woody_buffer *output)
+{
+    t_file          file;
+    t_output        out;
+    t_stub_image    stub;
+    int             ret;
+
+    *output = (t_woody_buffer){0};
+    begin(ctx);
+    ret = pack_memory(ctx, input, size, &file, &out, &stub);
+    if (ret == 0)
+    {
+        size_t  total = out.stub_offset + out.stub_size;
+        char    *data;
+
+        if (total < file.size)
+            total = file.size;
+        if (out.trailer_to)
+            total = out.trailer_to + file.size - out.trailer;
+        data = realloc(file.buffer, total);
+        if (data)
+        {
+            if (out.stub_offset > file.size)
+                memset(data + file.size, 0, out.stub_offset - file.size);
+            // --layout extend: 원본 끝을 stub 뒤로 옮기고 그 사이는 0
+            if (out.trailer_to)
+            {
+                memmove(data + out.trailer_to, data + out.trailer, file.size - out.trailer);
+                memset(data + out.trailer, 0, out.trailer_to - out.trailer);
+            }
+            memcpy(data + out.stub_offset, out.stub, out.stub_size);
+            *output = (t_woody_buffer){ (unsigned char *)data, total };
+            file.buffer = NULL;
+        }
+        else
+            ret = print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+        free_stub(&stub);
+    }
+    close_file(&file);
+    arena_reset(arena_current());
+    return end(ctx, ret);
+}
+
+static int write_stream(int fd, const void *data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t n = write(fd, data, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+        data = (const char *)data + n;
+        size -= n;
+    }
+    return 0;
+}
+
+static int write_zero(int fd, uint64_t size)
+{
+    static const char   zero[PAGE_SIZE];
+    int                 ret = 0;
+
+    while (ret == 0 && size > 0)
+    {
+        size_t n = size < sizeof(zero) ? size : sizeof(zero);
+
+        ret = write_stream(fd, zero, n);
+        size -= n;
+    }
+    return ret;
+}
+
+// fd 의 현재 위치부터 앞에서 뒤로 씀 (pipe / socket 도 됨). 출력 전체를 메모리에 모으지 않음
+int woody_pack_fd(t_woody *ctx, const void *input, size_t size, int fd)
+{
+    t_file          file;
+    t_output        out;
+    t_stub_image    stub;
+    int             ret;
+
+    begin(ctx);
+    ret = pack_memory(ctx, input, size, &file, &out, &stub);
+    if (ret == 0)
+    {
+        uint64_t    pos = out.stub_offset < file.size ? out.stub_offset : file.size;
+        uint64_t    end = out.stub_offset + out.stub_size;
+
+        if (out.trailer_to)
+            pos = out.trailer;
+        ret = write_stream(fd, file.buffer, pos);
+        // stub 앞 padding (--layout extend / phdr 는 한 페이지를 넘을 수 있음)
+        if (ret == 0)
+            ret = write_zero(fd, out.stub_offset - pos);
+        if (ret == 0)
+            ret = write_stream(fd, out.stub, out.stub_size);
+        // --layout extend: stub 뒤로 옮긴 원본 끝. cave: stub 뒤의 원본
+        if (ret == 0 && out.trailer_to)
+        {
+            ret = write_zero(fd, out.trailer_to - end);
+            if (ret == 0)
+                ret = write_stream(fd, file.buffer + out.trailer, file.size - out.trailer);
+        }
+        else if (ret == 0 && end < file.size)
+            ret = write_stream(fd, file.buffer + end, file.size - end);
+        free_stub(&stub);
+    }
+    close_file(&file);
+    arena_reset(arena_current());
+    return end(ctx, ret);
+}
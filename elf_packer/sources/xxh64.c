@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   xxh64.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/27 16:41:19 by insub             #+#    #+#             */
+/*   Updated: 2026/01/27 16:41:19 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "xxh64.h"
+#include <string.h>
+
+#define P1 0x9E3779B185EBCA87ULL
+#define P2 0xC2B2AE3D27D4EB4FULL
+#define P3 0x165667B19E3779F9ULL
+#define P4 0x85EBCA77C2B2AE63ULL
+#define P5 0x27D4EB2F165667C5ULL
+#define ROTL64(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+
+static uint64_t read64(const uint8_t *p)
+{
+    uint64_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t read32(const uint8_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint64_t round64(uint64_t acc, uint64_t input)
+{
+    acc += input * P2;
+    acc = ROTL64(acc, 31);
+    return acc * P1;
+}
+
+static uint64_t merge64(uint64_t acc, uint64_t val)
+{
+    acc ^= round64(0, val);
+    return acc * P1 + P4;
+}
+
+uint64_t xxh64(const void *data, size_t size, uint64_t seed)
+{
+    const uint8_t   *p = data;
+    const uint8_t   *end = p + size;
+    uint64_t        h;
+
+    if (size >= 32)
+    {
+        uint64_t v1 = seed + P1 + P2;
+        uint64_t v2 = seed + P2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - P1;
+
+        for (; p + 32 <= end; p += 32)
+        {
+            v1 = round64(v1, read64(p));
+            v2 = round64(v2, read64(p + 8));
+            v3 = round64(v3, read64(p + 16));
+            v4 = round64(v4, read64(p + 24));
+        }
+        h = ROTL64(v1, 1) + ROTL64(v2, 7) + ROTL64(v3, 12) + ROTL64(v4, 18);
+        h = merge64(h, v1);
+        h = merge64(h, v2);
+        h = merge64(h, v3);
+        h = merge64(h, v4);
+    }
+    else
+        h = seed + P5;
+    h += (uint64_t)size;
+
+    for (; p + 8 <= end; p += 8)
+        h = ROTL64(h ^ round64(0, read64(p)), 27) * P1 + P4;
+    if (p + 4 <= end)
+    {
+        h = ROTL64(h ^ (uint64_t)read32(p) * P1, 23) * P2 + P3;
+        p += 4;
+    }
+    for (; p < end; p++)
+        h = ROTL64(h ^ *p * P5, 11) * P1;
+
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
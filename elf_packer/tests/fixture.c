@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fixture.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/19 10:04:51 by insub             #+#    #+#             */
+/*   Updated: 2026/02/19 10:04:51 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// make test 의 fixture: packing 한 뒤에도 출력과 exit code 가 원본과 같아야 함.
+// 실행 region 에 call (BCJ 가 바꾸는 E8) 과 분기가 고루 있도록 작은 계산을 몇 개 돌림
+
+#include <stdio.h>
+#include <string.h>
+
+#define SIEVE_SIZE 10000
+
+__attribute__((noinline)) static unsigned crc32(const char *data, size_t size)
+{
+    unsigned crc = 0xffffffff;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        crc ^= (unsigned char)data[i];
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+__attribute__((noinline)) static int count_primes(int limit)
+{
+    static char composite[SIEVE_SIZE];
+    int         count = 0;
+
+    for (int i = 2; i < limit; i++)
+    {
+        if (composite[i])
+            continue;
+        count++;
+        for (int j = i * 2; j < limit; j += i)
+            composite[j] = 1;
+    }
+    return count;
+}
+
+__attribute__((noinline)) static unsigned long fib(int n)
+{
+    return n < 2 ? (unsigned long)n : fib(n - 1) + fib(n - 2);
+}
+
+int main(int argc, char **argv)
+{
+    const char *word = argc > 1 ? argv[1] : "woody";
+
+    printf("crc32(%s) = %08x\n", word, crc32(word, strlen(word)));
+    printf("primes below %d = %d\n", SIEVE_SIZE, count_primes(SIEVE_SIZE));
+    printf("fib(24) = %lu\n", fib(24));
+    return 42;
+}
@@ -0,0 +1,456 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   woody_test.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/19 10:04:51 by insub             #+#    #+#             */
+/*   Updated: 2026/02/19 15:37:12 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// woody_test (make test): packing 결과가 실제로 도는지와 압축 경로의 경계 조건
+//
+// 1) 이 CPU 에서 도는 내장 kernel 마다 (--kernel, AES 는 128 / 256 둘 다) fixture 를 그대로,
+//    --compress --bcj 로, --lazy 로 packing 해서 실행하고 stdout 과 exit code 를 원본과 비교
+// 2) C 압축기 (lz4.c, bcj.c) 로 만든 것을 stub 의 lz4_decompress (stub_bench.bin, woody_kbench 와
+//    같은 variant) 로 풀어서 비교. 빈 입력, 압축 안 되는 입력, block 크기와 딱 같은 입력 등.
+//    src 와 dst 는 PROT_NONE 페이지 바로 앞에서 끝나므로 넘어서 읽거나 쓰면 SIGSEGV
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "print_utils.h"
+#include "payload.h"
+#include "stub_image.h"
+#include "lz4.h"
+#include "bcj.h"
+#include "woody.h"
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/random.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+# define BENCH_MAGIC 0x42594457     // stub.inc 와 같은 값 ("WDYB")
+# define PAGE_SIZE 0x1000
+# define OUTPUT_MAX 4096            // fixture 의 stdout
+# define STUB_MESSAGE "inskim\n"    // stub.s 의 msg: stub 이 원본보다 먼저 찍음
+
+typedef enum e_fill
+{
+    FILL_ZERO,
+    FILL_RANDOM,
+    FILL_CODE,      // 이 실행 파일을 반복 (실제 x86 code 에 가까운 압축률)
+    FILL_CALLS,     // E8 만 (BCJ 가 모든 위치를 call 로 봄)
+    FILL_CALL_END,  // code 뒤 마지막 5 bytes 가 call (BCJ 의 끝 경계)
+}   t_fill;
+
+typedef struct s_case
+{
+    const char  *name;
+    size_t      size;
+    t_fill      fill;
+}   t_case;
+
+static const t_case g_cases[] = {
+    { "empty", 0, FILL_ZERO },
+    { "1 byte", 1, FILL_RANDOM },
+    { "mf limit", LZ4_MF_LIMIT, FILL_CODE },
+    { "mf limit + 1", LZ4_MF_LIMIT + 1, FILL_CODE },
+    { "zeros", 64 << 10, FILL_ZERO },
+    { "incompressible", 64 << 10, FILL_RANDOM },
+    { "lazy block", 1 << LAZY_DEFAULT_SHIFT, FILL_CODE },
+    { "parallel block", 1 << PARALLEL_SHIFT, FILL_CODE },
+    { "incompressible block", 1 << PARALLEL_SHIFT, FILL_RANDOM },
+    { "calls", 4096, FILL_CALLS },
+    { "call at end", 4096 + 3, FILL_CALL_END },
+};
+
+// fixture 를 packing 할 때의 옵션 (kernel / cipher 말고)
+static const char *g_modes[][3] = {
+    { NULL },
+    { "--compress", "--bcj", NULL },
+    { "--lazy", NULL },
+};
+
+typedef struct s_test
+{
+    const char  *work;      // packing 한 fixture 를 쓸 디렉터리
+    int         passed;
+    int         failed;
+    int         skipped;
+}   t_test;
+
+// size bytes 가 PROT_NONE 페이지 바로 앞에서 끝나는 buffer
+typedef struct s_guarded
+{
+    void        *base;
+    size_t      len;
+    uint8_t     *data;
+}   t_guarded;
+
+static int usage(void)
+{
+    fprintf(stderr, "Usage: woody_test --stub <stub_bench.bin> --work <dir> <fixture>\n");
+    return 1;
+}
+
+static void report(t_test *test, int ok, const char *what, const char *detail)
+{
+    printf("%-4s %s%s%s\n", ok ? "ok" : "FAIL", what, detail ? ": " : "", detail ? detail : "");
+    if (ok)
+        test->passed++;
+    else
+        test->failed++;
+}
+
+static int map_guarded(t_guarded *buffer, size_t size)
+{
+    size_t pages = (size + PAGE_SIZE - 1) / PAGE_SIZE;
+
+    buffer->len = (pages + 1) * PAGE_SIZE;
+    buffer->base = mmap(NULL, buffer->len, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer->base == MAP_FAILED)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    if (mprotect((char *)buffer->base + pages * PAGE_SIZE, PAGE_SIZE, PROT_NONE) < 0)
+    {
+        munmap(buffer->base, buffer->len);
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    }
+    buffer->data = (uint8_t *)buffer->base + pages * PAGE_SIZE - size;
+    return 0;
+}
+
+// 읽기 전용으로 통째로 (debug 출력이 없는 open_file)
+static const unsigned char *map_file(const char *path, size_t *size)
+{
+    int         fd = open(path, O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    void        *data = MAP_FAILED;
+
+    if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0)
+        data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (fd >= 0)
+        close(fd);
+    if (data == MAP_FAILED)
+    {
+        print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+        return NULL;
+    }
+    *size = st.st_size;
+    return data;
+}
+
+static int fill(uint8_t *buffer, size_t size, t_fill kind)
+{
+    const unsigned char *self;
+    size_t              self_size;
+
+    memset(buffer, kind == FILL_CALLS ? 0xe8 : 0, size);
+    if (kind == FILL_RANDOM)
+    {
+        for (size_t done = 0; done < size; )
+        {
+            ssize_t n = getrandom(buffer + done, size - done, 0);
+            if (n < 0 && errno != EINTR)
+                return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+            done += n > 0 ? n : 0;
+        }
+    }
+    if (kind != FILL_CODE && kind != FILL_CALL_END)
+        return 0;
+    if (!(self = map_file("/proc/self/exe", &self_size)))
+        return -1;
+    for (size_t done = 0; done < size; done += self_size)
+        memcpy(buffer + done, self, size - done < self_size ? size - done : self_size);
+    munmap((void *)self, self_size);
+    if (kind == FILL_CALL_END && size >= 5)
+        memcpy(buffer + size - 5, "\xe8\x10\x00\x00\x00", 5);
+    return 0;
+}
+
+// lz4_decompress 는 stub 내부 규약: rsi = src, rcx = src 크기, rdi = dst, rdx = dst 크기, eax = filter
+// rbx, rbp 는 보존, 나머지 범용 레지스터와 xmm0-3 을 씀
+static void call_lz4(void *entry, uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size,
+                     uint32_t filter)
+{
+    __asm__ volatile ("call *%[entry]"
+        : "+D"(dst), "+S"(src), "+d"(dst_size), "+c"(src_size), "+a"(filter)
+        : [entry] "r"(entry)
+        : "r8", "r9", "r10", "r11", "xmm0", "xmm1", "xmm2", "xmm3", "memory", "cc");
+}
+
+// 원본 -> (BCJ) -> lz4_compress -> stub 의 lz4_decompress -> 원본과 같은지
+static int round_trip(void *entry, const t_case *c, uint32_t filter, const uint8_t *plain)
+{
+    uint8_t     *encoded = malloc(c->size ? c->size : 1);
+    uint8_t     *compressed = malloc(LZ4_COMPRESS_BOUND(c->size));
+    size_t      packed = 0;
+    t_guarded   src;
+    t_guarded   dst;
+    int         ok;
+
+    if (encoded && compressed)
+    {
+        memcpy(encoded, plain, c->size);
+        if (filter == FILTER_BCJ)
+            bcj_x86_encode(encoded, c->size);
+        packed = lz4_compress(encoded, c->size, compressed);
+    }
+    free(encoded);
+    if (packed == 0 || map_guarded(&src, packed) < 0)
+    {
+        free(compressed);
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    }
+    memcpy(src.data, compressed, packed);
+    free(compressed);
+    if (map_guarded(&dst, c->size) < 0)
+    {
+        munmap(src.base, src.len);
+        return -1;
+    }
+    call_lz4(entry, dst.data, c->size, src.data, packed, filter);
+    ok = memcmp(dst.data, plain, c->size) == 0;
+    munmap(src.base, src.len);
+    munmap(dst.base, dst.len);
+    return ok;
+}
+
+// stub_bench.bin 의 표에서 lz4_decompress 를 찾아 case 마다 필터 없이 / BCJ 로
+static int test_lz4(t_test *test, const char *path)
+{
+    size_t              len;
+    const unsigned char *bin = map_file(path, &len);
+    void                *code;
+    char                what[128];
+
+    if (!bin)
+        return -1;
+    if (len < 8 || *(uint32_t *)bin != BENCH_MAGIC || *(uint32_t *)(bin + 4) >= len)
+    {
+        munmap((void *)bin, len);
+        fprintf(stderr, "woody_test: %s: not a stub built with -DBENCH\n", path);
+        return -1;
+    }
+    // stub 이 쓰는 것과 같은 RWX page
+    code = mmap(NULL, len, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED)
+    {
+        munmap((void *)bin, len);
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    }
+    memcpy(code, bin, len);
+    for (size_t i = 0; i < sizeof(g_cases) / sizeof(*g_cases); i++)
+    {
+        const t_case    *c = &g_cases[i];
+        uint8_t         *plain = malloc(c->size ? c->size : 1);
+
+        if (!plain || fill(plain, c->size, c->fill) < 0)
+        {
+            free(plain);
+            munmap(code, len);
+            munmap((void *)bin, len);
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        }
+        for (uint32_t filter = FILTER_NONE; filter <= FILTER_BCJ; filter++)
+        {
+            int ok = round_trip((uint8_t *)code + *(uint32_t *)(bin + 4), c, filter, plain);
+
+            snprintf(what, sizeof(what), "%s %s (%zu bytes)",
+                filter == FILTER_BCJ ? "lz4+bcj" : "lz4", c->name, c->size);
+            if (ok < 0)
+                ok = FALSE;
+            report(test, ok, what, NULL);
+        }
+        free(plain);
+    }
+    munmap(code, len);
+    munmap((void *)bin, len);
+    return 0;
+}
+
+// path 를 실행해서 stdout 을 output 에 받고 exit code 를 돌려줌 (signal 이면 128 + 번호)
+static int run(const char *path, char *output, size_t size)
+{
+    int     fds[2];
+    size_t  done = 0;
+    int     status;
+    pid_t   pid;
+
+    if (pipe(fds) < 0)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    pid = fork();
+    if (pid == 0)
+    {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execl(path, path, "packed", (char *)NULL);
+        _exit(127);
+    }
+    close(fds[1]);
+    while (pid > 0 && done + 1 < size)
+    {
+        ssize_t n = read(fds[0], output + done, size - 1 - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        done += n;
+    }
+    output[done] = '\0';
+    close(fds[0]);
+    if (pid < 0 || waitpid(pid, &status, 0) < 0)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+static int write_file(const char *path, const t_woody_buffer *data)
+{
+    int fd;
+    int ok;
+
+    unlink(path);   // 전에 실행한 것이 남아 있어도 ETXTBSY 없이
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0755);
+    if (fd < 0)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    ok = write(fd, data->data, data->size) == (ssize_t)data->size;
+    close(fd);
+    return ok ? 0 : print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+}
+
+// kernel / cipher / mode 하나로 packing 해서 원본과 같은 결과가 나오는지
+static void test_pack(t_test *test, const char *kernel, const char *cipher, size_t m,
+                      const void *fixture, size_t size, const char *expect, int expect_code)
+{
+    t_woody         *ctx = woody_create();
+    t_woody_buffer  packed = {0};
+    char            what[256];
+    char            path[PATH_MAX];
+    char            output[OUTPUT_MAX];
+    char            detail[64];
+    const char      **mode = g_modes[m];
+    int             len;
+    int             code;
+
+    len = snprintf(what, sizeof(what), "pack --kernel %s --cipher %s", kernel, cipher);
+    for (int i = 0; mode[i]; i++)
+        len += snprintf(what + len, sizeof(what) - len, " %s", mode[i]);
+    if (!ctx || woody_option(ctx, "--kernel", kernel) < 0 || woody_option(ctx, "--cipher", cipher) < 0)
+    {
+        report(test, FALSE, what, ctx ? woody_error(ctx) : "woody_create");
+        woody_destroy(ctx);
+        return;
+    }
+    for (int i = 0; mode[i]; i++)
+    {
+        if (woody_option(ctx, mode[i], NULL) < 0)
+        {
+            report(test, FALSE, what, woody_error(ctx));
+            woody_destroy(ctx);
+            return;
+        }
+    }
+    if (woody_pack(ctx, fixture, size, &packed) < 0)
+    {
+        report(test, FALSE, what, woody_error(ctx));
+        woody_destroy(ctx);
+        return;
+    }
+    snprintf(path, sizeof(path), "%s/fixture.%s.%s.%zu", test->work, kernel, cipher, m);
+    code = write_file(path, &packed) < 0 ? -1 : run(path, output, sizeof(output));
+    snprintf(detail, sizeof(detail), "exit %d, expected %d", code, expect_code);
+    if (code != expect_code)
+        report(test, FALSE, what, detail);
+    else
+        report(test, strcmp(output, expect) == 0, what, strcmp(output, expect) ? "output differs" : NULL);
+    woody_free_buffer(&packed);
+    woody_destroy(ctx);
+}
+
+static int cpu_features(void)
+{
+    int features = 0;
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("aes"))
+        features |= FEAT_AESNI;
+    if (__builtin_cpu_supports("avx2"))
+        features |= FEAT_AVX2;
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        features |= FEAT_AVX512;
+    if (__builtin_cpu_supports("vaes"))
+        features |= FEAT_VAES;
+    return features;
+}
+
+// 원본을 한 번 돌려 기대값 (앞에 stub 의 출력) 을 받고, 내장 kernel 마다 (이 CPU 에서 못 도는 것은 skip) 모든 mode
+static int test_kernels(t_test *test, const char *fixture)
+{
+    static const char   *aes_ciphers[] = { "aes128", "aes256", NULL };
+    static const char   *chacha_ciphers[] = { "chacha20", NULL };
+    char                expect[OUTPUT_MAX];
+    int                 expect_code;
+    int                 features = cpu_features();
+    size_t              size;
+    const unsigned char *elf = map_file(fixture, &size);
+    const char          *name;
+    const unsigned char *code;
+    size_t              len;
+    int                 aes;
+    uint32_t            needs;
+
+    if (!elf)
+        return -1;
+    strcpy(expect, STUB_MESSAGE);
+    expect_code = run(fixture, expect + strlen(STUB_MESSAGE), sizeof(expect) - strlen(STUB_MESSAGE));
+    for (size_t i = 0; (name = kernel_bin(i, &aes, &needs, &code, &len)); i++)
+    {
+        if ((needs & features) != needs)
+        {
+            printf("skip pack --kernel %s: not supported by this CPU\n", name);
+            test->skipped++;
+            continue;
+        }
+        for (const char **cipher = aes ? aes_ciphers : chacha_ciphers; *cipher; cipher++)
+            for (size_t m = 0; m < sizeof(g_modes) / sizeof(*g_modes); m++)
+                test_pack(test, name, *cipher, m, elf, size, expect, expect_code);
+    }
+    munmap((void *)elf, size);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    t_test      test = {0};
+    const char  *stub = NULL;
+    const char  *fixture = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--stub") == 0 && i + 1 < argc)
+            stub = argv[++i];
+        else if (strcmp(argv[i], "--work") == 0 && i + 1 < argc)
+            test.work = argv[++i];
+        else if (argv[i][0] != '-' && !fixture)
+            fixture = argv[i];
+        else
+            return usage();
+    }
+    if (!stub || !test.work || !fixture)
+        return usage();
+    if (mkdir(test.work, 0755) < 0 && errno != EEXIST)
+    {
+        print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+        return 1;
+    }
+    if (test_lz4(&test, stub) < 0 || test_kernels(&test, fixture) < 0)
+        return 1;
+    printf("\n%d passed, %d failed, %d skipped\n", test.passed, test.failed, test.skipped);
+    return test.failed ? 1 : 0;
+}
@@ -0,0 +1,25 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_corpus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/11 09:48:33 by insub             #+#    #+#             */
+/*   Updated: 2026/02/11 09:48:33 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// make bench 의 합성 binary: 실행 region 에 PAD 파일 (임의 bytes) 을 그대로 넣고 main 에서 바로 끝남.
+// 크기만 다르게 해서 stub 이 region 크기에 따라 얼마나 늘어나는지 봄
+
+#ifndef PAD
+# error "PAD must name the file to embed in .text"
+#endif
+
+__asm__(".text\n.balign 4096\n.incbin \"" PAD "\"\n");
+
+int main(void)
+{
+    return 0;
+}
@@ -0,0 +1,317 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   woody_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/11 10:22:07 by insub             #+#    #+#             */
+/*   Updated: 2026/02/11 17:40:52 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// woody_bench: 원본과 packed 의 exec 부터 exit 까지를 비교 (make bench)
+//
+// 입력마다 woody_woodpacker 로 pack 한 뒤 원본과 packed 를 번갈아 vfork + execve 로 실행하고
+// wait4 의 rusage 로 minor / major page fault 와 최대 RSS 를 모음. cold 실행은 매번 직전에
+// 실행 파일을 posix_fadvise(DONTNEED) 로 page cache 에서 내림 (공유 library 는 그대로)
+//
+// 입력은 곧바로 끝나는 것이어야 함 (make bench 의 합성 binary, /usr/bin/true, --arg --version 등)
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "print_utils.h"
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+# define BENCH_RUNS 2000
+# define BENCH_COLD_RUNS 200
+
+extern char **environ;
+
+typedef struct s_sample
+{
+    uint64_t    ns;         // vfork 부터 wait4 가 돌아올 때까지
+    long        minflt;
+    long        majflt;
+    long        maxrss;     // KB
+    int         status;
+}   t_sample;
+
+typedef struct s_variant
+{
+    const char  *path;
+    int         fd;         // cold 실행 때 page cache 에서 내릴 파일
+    off_t       size;
+    t_sample    *warm;
+    t_sample    *cold;
+}   t_variant;
+
+typedef struct s_bench
+{
+    int         runs;       // -n
+    int         cold;       // --cold
+    const char  *arg;       // --arg: 실행할 때 넘길 인자 하나
+    const char  *packer;    // --packer
+    const char  *work;      // --work: packed 출력을 둘 디렉터리
+    char        **pack;     // -- 뒤: packer 에 그대로 넘길 옵션
+    int         pack_count;
+    int         null_fd;
+}   t_bench;
+
+static int usage(void)
+{
+    fprintf(stderr, "Usage: woody_bench [-n <runs>] [--cold <runs>] [--arg <arg>] [--packer <path>] [--work <dir>] <elf>... [-- <pack options>]\n");
+    return 1;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+// stdout / stderr 는 /dev/null. 실행 못 하면 status 127
+static int run_once(const t_bench *bench, const t_variant *variant, int cold, t_sample *sample)
+{
+    char            *argv[] = { (char *)variant->path, (char *)bench->arg, NULL };
+    struct rusage   usage;
+    int             status;
+    pid_t           pid;
+
+    if (cold)
+        posix_fadvise(variant->fd, 0, 0, POSIX_FADV_DONTNEED);
+    uint64_t start = now_ns();
+    pid = vfork();
+    if (pid == 0)
+    {
+        dup2(bench->null_fd, 0);
+        dup2(bench->null_fd, 1);
+        dup2(bench->null_fd, 2);
+        execve(variant->path, argv, environ);
+        _exit(127);
+    }
+    if (pid < 0)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    while (wait4(pid, &status, 0, &usage) < 0)
+        if (errno != EINTR)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    *sample = (t_sample){ now_ns() - start, usage.ru_minflt, usage.ru_majflt, usage.ru_maxrss, status };
+    return 0;
+}
+
+// packer [pack options] -o output input. 출력은 cold 실행 전에 내릴 수 있게 disk 에 씀
+static int pack_input(const t_bench *bench, const char *input, const char *output)
+{
+    char    *argv[bench->pack_count + 5];
+    int     argc = 0;
+    int     status;
+    pid_t   pid;
+
+    argv[argc++] = (char *)bench->packer;
+    for (int i = 0; i < bench->pack_count; i++)
+        argv[argc++] = bench->pack[i];
+    argv[argc++] = "-o";
+    argv[argc++] = (char *)output;
+    argv[argc++] = (char *)input;
+    argv[argc] = NULL;
+    pid = fork();
+    if (pid == 0)
+    {
+        dup2(bench->null_fd, 1);
+        execv(bench->packer, argv);
+        _exit(127);
+    }
+    if (pid < 0 || waitpid(pid, &status, 0) < 0)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        fprintf(stderr, "woody_bench: %s: pack failed\n", input);
+        return -1;
+    }
+    return 0;
+}
+
+// 막 만든 파일은 dirty 라서 DONTNEED 가 못 내림. 먼저 disk 에 씀
+static int open_variant(t_variant *variant, const char *path, const t_bench *bench)
+{
+    struct stat st;
+
+    *variant = (t_variant){ .path = path };
+    variant->fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (variant->fd < 0 || fstat(variant->fd, &st) < 0 || fdatasync(variant->fd) < 0)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    variant->size = st.st_size;
+    variant->warm = malloc(bench->runs * sizeof(t_sample));
+    variant->cold = malloc(bench->cold * sizeof(t_sample));
+    if (!variant->warm || !variant->cold)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    return 0;
+}
+
+static void close_variant(t_variant *variant)
+{
+    if (variant->fd >= 0)
+        close(variant->fd);
+    free(variant->warm);
+    free(variant->cold);
+}
+
+static int compare_sample(const void *a, const void *b)
+{
+    uint64_t x = ((const t_sample *)a)->ns;
+    uint64_t y = ((const t_sample *)b)->ns;
+
+    return (x > y) - (x < y);
+}
+
+// p50 / p99 는 시간, page fault 와 RSS 는 평균. 돌려주는 값은 p50 (ns)
+static uint64_t print_row(const char *label, t_sample *samples, int count, double *rss)
+{
+    double  minflt = 0;
+    double  majflt = 0;
+
+    *rss = 0;
+    if (count == 0)
+        return 0;
+    qsort(samples, count, sizeof(*samples), compare_sample);
+    for (int i = 0; i < count; i++)
+    {
+        minflt += samples[i].minflt;
+        majflt += samples[i].majflt;
+        *rss += samples[i].maxrss;
+    }
+    *rss /= count;
+    printf("  %-15s %6d %10.1f %10.1f %9.1f %8.2f %9.0f\n", label, count,
+        samples[count / 2].ns / 1e3, samples[(size_t)count * 99 / 100].ns / 1e3,
+        minflt / count, majflt / count, *rss);
+    return samples[count / 2].ns;
+}
+
+static void report(const t_bench *bench, const char *input, t_variant *original, t_variant *packed)
+{
+    double      rss[4];
+    uint64_t    p50[4];
+
+    printf("%s (%ld -> %ld bytes)\n", input, (long)original->size, (long)packed->size);
+    printf("  %-15s %6s %10s %10s %9s %8s %9s\n", "", "runs", "p50 us", "p99 us", "minflt", "majflt", "rss KB");
+    p50[0] = print_row("original warm", original->warm, bench->runs, &rss[0]);
+    p50[1] = print_row("packed   warm", packed->warm, bench->runs, &rss[1]);
+    p50[2] = print_row("original cold", original->cold, bench->cold, &rss[2]);
+    p50[3] = print_row("packed   cold", packed->cold, bench->cold, &rss[3]);
+    printf("  packed / original: warm p50 x%.2f", p50[0] ? (double)p50[1] / p50[0] : 0.0);
+    if (bench->cold)
+        printf(", cold p50 x%.2f", p50[2] ? (double)p50[3] / p50[2] : 0.0);
+    printf(", rss %+.0f KB\n\n", rss[1] - rss[0]);
+}
+
+// 원본과 packed 를 번갈아 실행 (둘 다 같은 시점의 부하 / 주파수를 받도록)
+static int bench_input(const t_bench *bench, const char *input)
+{
+    char        output[PATH_MAX];
+    const char  *name = strrchr(input, '/') ? strrchr(input, '/') + 1 : input;
+    t_variant   original;
+    t_variant   packed = { .fd = -1 };
+    int         exit_code = -1;
+
+    if (snprintf(output, sizeof(output), "%s/%s.woody", bench->work, name) >= (int)sizeof(output))
+        return print_error(FILE_NOT_FOUND, ERRNO_FALSE);
+    if (pack_input(bench, input, output) < 0)
+        return -1;
+    if (open_variant(&original, input, bench) < 0 || open_variant(&packed, output, bench) < 0)
+        goto done;
+    for (int i = 0; i < bench->runs; i++)
+        if (run_once(bench, &original, FALSE, &original.warm[i]) < 0
+            || run_once(bench, &packed, FALSE, &packed.warm[i]) < 0)
+            goto done;
+    for (int i = 0; i < bench->cold; i++)
+        if (run_once(bench, &original, TRUE, &original.cold[i]) < 0
+            || run_once(bench, &packed, TRUE, &packed.cold[i]) < 0)
+            goto done;
+    // packed 가 원본과 다르게 끝나면 시간을 비교하는 의미가 없음
+    if (bench->runs && original.warm[0].status != packed.warm[0].status)
+        fprintf(stderr, "woody_bench: %s: exit status differs (original 0x%x, packed 0x%x)\n",
+            input, original.warm[0].status, packed.warm[0].status);
+    report(bench, input, &original, &packed);
+    exit_code = 0;
+done:
+    close_variant(&original);
+    close_variant(&packed);
+    return exit_code;
+}
+
+static int parse_runs(const char *str, int *runs)
+{
+    char    *end;
+    long    value = strtol(str, &end, 10);
+
+    if (*str == '\0' || *end != '\0' || value < 0 || value > 1000000)
+        return FALSE;
+    *runs = value;
+    return TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+    t_bench bench = { .runs = BENCH_RUNS, .cold = BENCH_COLD_RUNS, .packer = "./woody_woodpacker",
+                      .work = "." };
+    char    **inputs = malloc(argc * sizeof(*inputs));
+    int     count = 0;
+    int     exit_code = 0;
+
+    if (!inputs)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    for (int i = 1; i < argc; i++)
+    {
+        int ok = TRUE;
+        if (strcmp(argv[i], "--") == 0)
+        {
+            bench.pack = &argv[i + 1];
+            bench.pack_count = argc - i - 1;
+            break;
+        }
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            ok = parse_runs(argv[++i], &bench.runs);
+        else if (strcmp(argv[i], "--cold") == 0 && i + 1 < argc)
+            ok = parse_runs(argv[++i], &bench.cold);
+        else if (strcmp(argv[i], "--arg") == 0 && i + 1 < argc)
+            bench.arg = argv[++i];
+        else if (strcmp(argv[i], "--packer") == 0 && i + 1 < argc)
+            bench.packer = argv[++i];
+        else if (strcmp(argv[i], "--work") == 0 && i + 1 < argc)
+            bench.work = argv[++i];
+        else if (argv[i][0] == '-')
+            ok = FALSE;
+        else
+            inputs[count++] = argv[i];
+        if (!ok)
+        {
+            free(inputs);
+            return usage();
+        }
+    }
+    if (count == 0)
+    {
+        free(inputs);
+        return usage();
+    }
+    bench.null_fd = open("/dev/null", O_RDWR | O_CLOEXEC);
+    if (bench.null_fd < 0 || (mkdir(bench.work, 0755) < 0 && errno != EEXIST))
+    {
+        free(inputs);
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    }
+    for (int i = 0; i < count; i++)
+        if (bench_input(&bench, inputs[i]) < 0)
+            exit_code = 1;
+    close(bench.null_fd);
+    free(inputs);
+    return exit_code;
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   woody_client.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/31 10:14:22 by insub             #+#    #+#             */
+/*   Updated: 2026/01/31 10:14:22 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// woody_client: woody_woodpacker 와 같은 명령줄을 떠 있는 woody_woodpacker --serve 에 넘김.
+// server 는 WOODY_SOCKET 에서 찾고, 없거나 붙지 못하면 옆의 woody_woodpacker 를 그대로 exec
+//
+// 열리는 일반 파일인 인자는 fd 로 넘기고 (server 는 어느 인자가 입력인지 알고 골라 씀),
+// cwd 도 fd 로 넘겨서 상대 경로 (-o, --out-dir, --cache ...) 를 server 가 같은 자리로 풂
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "print_utils.h"
+#include "pack.h"
+#include "serve.h"
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+static int connect_server(void)
+{
+    const char          *path = getenv("WOODY_SOCKET");
+    struct sockaddr_un  addr = { .sun_family = AF_UNIX };
+    int                 fd;
+
+    if (!path || strlen(path) >= sizeof(addr.sun_path))
+        return -1;
+    strcpy(addr.sun_path, path);
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd >= 0 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// server 가 없으면 같은 디렉터리의 woody_woodpacker (없으면 PATH) 로 직접 pack
+static int run_local(char *argv[])
+{
+    char    self[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", self, sizeof(self) - sizeof("woody_woodpacker"));
+
+    if (len > 0)
+    {
+        self[len] = '\0';
+        char *slash = strrchr(self, '/');
+        strcpy(slash + 1, "woody_woodpacker");
+        argv[0] = self;
+        execv(self, argv);
+    }
+    argv[0] = "woody_woodpacker";
+    execvp(argv[0], argv);
+    return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+}
+
+static int write_full(int fd, const void *buffer, size_t size)
+{
+    size_t done = 0;
+
+    while (done < size)
+    {
+        ssize_t n = write(fd, (const char *)buffer + done, size - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FALSE;
+        done += n;
+    }
+    return TRUE;
+}
+
+static int read_full(int fd, void *buffer, size_t size)
+{
+    size_t done = 0;
+
+    while (done < size)
+    {
+        ssize_t n = read(fd, (char *)buffer + done, size - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FALSE;
+        done += n;
+    }
+    return TRUE;
+}
+
+// 헤더와 fd ([cwd, 입력...]) 를 sendmsg 한 번에, argv 와 fd 마다 argv 번호는 뒤에 이어서
+static int send_request(int sock, int argc, char *argv[])
+{
+    int             fds[SERVE_MAX_FDS];
+    uint32_t        args[SERVE_MAX_FDS];
+    size_t          count = 0;
+    size_t          size = 0;
+    struct stat     st;
+
+    fds[count++] = open(".", O_PATH | O_DIRECTORY | O_CLOEXEC);
+    if (fds[0] < 0)
+        return FALSE;
+    for (int i = 1; i < argc && count < SERVE_MAX_FDS; i++)
+    {
+        if (argv[i][0] == '-')
+            continue;
+        int fd = open(argv[i], O_RDONLY | O_NONBLOCK | O_NOCTTY | O_CLOEXEC);
+        if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+        {
+            args[count] = i;
+            fds[count++] = fd;
+        }
+        else if (fd >= 0)
+            close(fd);
+    }
+    for (int i = 0; i < argc; i++)
+        size += strlen(argv[i]) + 1;
+
+    char *body = malloc(size + (count - 1) * sizeof(uint32_t));
+    int sent = body != NULL && size + (count - 1) * sizeof(uint32_t) <= SERVE_MAX_REQUEST;
+    if (sent)
+    {
+        size = 0;
+        for (int i = 0; i < argc; i++)
+        {
+            strcpy(body + size, argv[i]);
+            size += strlen(argv[i]) + 1;
+        }
+        memcpy(body + size, args + 1, (count - 1) * sizeof(uint32_t));
+        size += (count - 1) * sizeof(uint32_t);
+
+        t_serve_request req = { SERVE_MAGIC, argc, size, count };
+        char            control[CMSG_SPACE(SERVE_MAX_FDS * sizeof(int))] = {0};
+        struct iovec    iov = { .iov_base = &req, .iov_len = sizeof(req) };
+        struct msghdr   msg = { .msg_iov = &iov, .msg_iovlen = 1, .msg_control = control,
+                                .msg_controllen = CMSG_SPACE(count * sizeof(int)) };
+        struct cmsghdr  *c = CMSG_FIRSTHDR(&msg);
+
+        c->cmsg_level = SOL_SOCKET;
+        c->cmsg_type = SCM_RIGHTS;
+        c->cmsg_len = CMSG_LEN(count * sizeof(int));
+        memcpy(CMSG_DATA(c), fds, count * sizeof(int));
+        sent = sendmsg(sock, &msg, MSG_NOSIGNAL) == sizeof(req) && write_full(sock, body, size);
+    }
+    free(body);
+    for (size_t i = 0; i < count; i++)
+        close(fds[i]);
+    return sent;
+}
+
+int main(int argc, char *argv[])
+{
+    int             sock = connect_server();
+    int             exit_code = 0;
+    t_serve_reply   answer = {0};
+
+    if (sock < 0)
+        return run_local(argv);
+    if (send_request(sock, argc, argv) == FALSE)
+    {
+        close(sock);
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    }
+    // 입력마다 끝난 순서대로 결과와 시간이 오고 마지막에 SERVE_DONE
+    while (read_full(sock, &answer, sizeof(answer)) && answer.index != SERVE_DONE)
+    {
+        if (answer.index >= (uint32_t)argc)
+            continue;
+        printf("%s %s (%.1f ms, queued %.1f ms)\n",
+            answer.result < 0 ? "FAIL" : answer.result == PACK_CACHED ? "cached" : "packed",
+            argv[answer.index], answer.packed_us / 1e3, answer.queued_us / 1e3);
+        if (answer.result < 0)
+            exit_code = -1;
+    }
+    close(sock);
+    if (answer.index != SERVE_DONE)
+        return print_error(FILE_NOT_FOUND, ERRNO_FALSE);
+    if (answer.result < 0)
+        return print_error(WRONG_ARGS, ERRNO_FALSE);
+    return exit_code;
+}
@@ -0,0 +1,493 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   woody_kbench.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/13 11:17:42 by insub             #+#    #+#             */
+/*   Updated: 2026/02/13 18:26:09 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// woody_kbench: 복호화 kernel 과 stub 의 lz4_decompress 를 packed ELF 없이 따로 잼
+//
+// binary_patch/binary_inline_execution 처럼 RWX page 에 machine code 를 올려 바로 call 함.
+// kernel 은 woody_woodpacker 에 들어 있는 것 (이름) 이나 nasm 으로 만든 flat binary (.bin 경로),
+// lz4 는 stub.s 를 -DBENCH 로 만든 stub_bench.bin (--stub). 크기마다 합성 buffer 에 여러 번 돌려
+// 중간값으로 GB/s, TSC cycles/byte, perf_event_open 의 core cycles/byte 와 IPC 를 찍음
+// 첫 실행 결과는 C 구현 (chacha20.c / aes.c / 원본 data) 과 비교해서 틀리면 MISMATCH
+
+#define _GNU_SOURCE
+#include "main.h"
+#include "print_utils.h"
+#include "payload.h"
+#include "stub_image.h"
+#include "chacha20.h"
+#include "aes.h"
+#include "lz4.h"
+#include "bcj.h"
+#include "stats.h"
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/random.h>
+#include <sys/stat.h>
+#include <x86intrin.h>
+
+# define BENCH_MAGIC 0x42594457     // stub.inc 와 같은 값 ("WDYB")
+# define MAX_SIZES 16
+# define BENCH_NS 200000000         // --runs 가 없으면 크기마다 이만큼 돌림 (5..10000 번)
+# define MIN_RUNS 5
+# define MAX_RUNS 10000
+# define BUFFER_ALIGN 64            // kernel 은 64 bytes 정렬된 buffer 를 받음
+
+typedef void (*t_kernel_fn)(void *buffer, size_t size, uint32_t counter, const t_stub_params *params);
+
+typedef struct s_target
+{
+    const char          *name;
+    const unsigned char *code;
+    size_t              len;
+    int                 aes;        // 어느 C 구현과 비교할지
+    int                 lz4;        // TRUE: code 는 stub_bench.bin, entry 는 lz4_decompress
+    uint32_t            entry;
+    int                 filter;     // lz4: FILTER_*
+}   t_target;
+
+typedef struct s_kbench
+{
+    size_t          sizes[MAX_SIZES];
+    int             size_count;
+    int             runs;           // 0 이면 크기에서 정함
+    t_cipher        cipher;         // .bin kernel 의 cipher
+    t_stub_params   *params;
+    t_aes           aes;
+}   t_kbench;
+
+typedef struct s_result
+{
+    uint64_t    ns;
+    uint64_t    tsc;
+    uint64_t    counters[COUNTER_COUNT];
+}   t_result;
+
+static int usage(void)
+{
+    fprintf(stderr, "Usage: woody_kbench [--size <n>[K|M|G]]... [--runs <n>] [--cipher chacha20|aes128|aes256] [--stub <stub_bench.bin>] [kernel name | kernel.bin]...\n");
+    return 1;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static int cpu_features(void)
+{
+    int features = 0;
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("aes"))
+        features |= FEAT_AESNI;
+    if (__builtin_cpu_supports("avx2"))
+        features |= FEAT_AVX2;
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        features |= FEAT_AVX512;
+    if (__builtin_cpu_supports("vaes"))
+        features |= FEAT_VAES;
+    return features;
+}
+
+static void *map_buffer(size_t size)
+{
+    void *buffer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    return buffer == MAP_FAILED ? NULL : buffer;
+}
+
+// stub 이 쓰는 것과 같은 RWX page
+static void *map_code(const t_target *target)
+{
+    size_t  size = (target->len + 4095) & ~4095UL;
+    void    *code = mmap(NULL, size, PROT_READ | PROT_WRITE | PROT_EXEC,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (code == MAP_FAILED)
+        return NULL;
+    memcpy(code, target->code, target->len);
+    return code;
+}
+
+// lz4_decompress 는 stub 내부 규약: rsi = src, rcx = src 크기, rdi = dst, rdx = dst 크기, eax = filter
+// rbx, rbp 는 보존, 나머지 범용 레지스터와 xmm0-3 을 씀
+static void call_lz4(void *entry, uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size,
+                     uint32_t filter)
+{
+    __asm__ volatile ("call *%[entry]"
+        : "+D"(dst), "+S"(src), "+d"(dst_size), "+c"(src_size), "+a"(filter)
+        : [entry] "r"(entry)
+        : "r8", "r9", "r10", "r11", "xmm0", "xmm1", "xmm2", "xmm3", "memory", "cc");
+}
+
+// 읽기 전용으로 통째로 (debug 출력이 없는 open_file)
+static const unsigned char *map_file(const char *path, size_t *size)
+{
+    int         fd = open(path, O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    void        *data = MAP_FAILED;
+
+    if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0)
+        data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (fd >= 0)
+        close(fd);
+    if (data == MAP_FAILED)
+    {
+        print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+        return NULL;
+    }
+    *size = st.st_size;
+    return data;
+}
+
+// 실제 x86 code 에 가까운 압축률이 나오도록 이 실행 파일을 반복해서 채움
+static int fill_code(uint8_t *buffer, size_t size)
+{
+    size_t              self_size;
+    const unsigned char *self = map_file("/proc/self/exe", &self_size);
+
+    if (!self)
+        return -1;
+    for (size_t done = 0; done < size; )
+    {
+        size_t n = size - done < self_size ? size - done : self_size;
+        memcpy(buffer + done, self, n);
+        done += n;
+    }
+    munmap((void *)self, self_size);
+    return 0;
+}
+
+static int fill_random(uint8_t *buffer, size_t size)
+{
+    for (size_t done = 0; done < size; )
+    {
+        ssize_t n = getrandom(buffer + done, size - done, 0);
+        if (n < 0 && errno != EINTR)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        done += n > 0 ? n : 0;
+    }
+    return 0;
+}
+
+static int compare_result(const void *a, const void *b)
+{
+    uint64_t x = ((const t_result *)a)->tsc;
+    uint64_t y = ((const t_result *)b)->tsc;
+
+    return (x > y) - (x < y);
+}
+
+static void print_result(const t_target *target, size_t size, size_t runs, const t_result *r, int ok)
+{
+    printf("%-24s %9zuK %6zu %9.2f %9.3f", target->name, size >> 10, runs,
+        r->ns ? (double)size / r->ns : 0.0, (double)r->tsc / size);
+    if (stats_available(COUNTER_CYCLES))
+        printf(" %9.3f", (double)r->counters[COUNTER_CYCLES] / size);
+    else
+        printf(" %9s", "-");
+    if (stats_available(COUNTER_CYCLES) && stats_available(COUNTER_INSTRUCTIONS)
+        && r->counters[COUNTER_CYCLES])
+        printf(" %6.2f", (double)r->counters[COUNTER_INSTRUCTIONS] / r->counters[COUNTER_CYCLES]);
+    else
+        printf(" %6s", "-");
+    if (stats_available(COUNTER_CACHE_MISSES))
+        printf(" %10.2f", r->counters[COUNTER_CACHE_MISSES] * 1024.0 / size);
+    else
+        printf(" %10s", "-");
+    printf("  %s\n", ok ? "ok" : "MISMATCH");
+}
+
+// 한 번 실행 (lz4 면 src -> buffer, 아니면 buffer 제자리)
+static void run_target(const t_kbench *bench, const t_target *target, void *code, uint8_t *buffer,
+                       size_t size, const uint8_t *src, size_t src_size, t_result *result)
+{
+    uint64_t before[COUNTER_COUNT];
+    uint64_t after[COUNTER_COUNT];
+
+    stats_read(before);
+    uint64_t start = now_ns();
+    _mm_lfence();
+    uint64_t tsc = __rdtsc();
+    _mm_lfence();
+    if (target->lz4)
+        call_lz4((uint8_t *)code + target->entry, buffer, size, src, src_size, target->filter);
+    else
+        ((t_kernel_fn)code)(buffer, size, 0, bench->params);
+    _mm_lfence();
+    result->tsc = __rdtsc() - tsc;
+    result->ns = now_ns() - start;
+    stats_read(after);
+    for (int i = 0; i < COUNTER_COUNT; i++)
+        result->counters[i] = after[i] - before[i];
+}
+
+// lz4 는 압축해 둔 src 를 buffer 에 풀고 원본과 비교, kernel 은 C 구현으로 다시 xor 해서 원본과 비교
+static int bench_size(const t_kbench *bench, const t_target *target, void *code, size_t size)
+{
+    uint8_t     *plain = map_buffer(size);
+    uint8_t     *buffer = map_buffer(size);
+    uint8_t     *src = NULL;
+    size_t      src_size = 0;
+    size_t      max = bench->runs ? (size_t)bench->runs : MAX_RUNS;
+    size_t      runs = 0;
+    t_result    *results = malloc(max * sizeof(*results));
+    int         ok;
+
+    if (!plain || !buffer || !results
+        || (target->lz4 ? fill_code(plain, size) : fill_random(plain, size)) < 0)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    if (target->lz4)
+    {
+        src = map_buffer(LZ4_COMPRESS_BOUND(size));
+        if (!src)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        memcpy(buffer, plain, size);
+        if (target->filter == FILTER_BCJ)
+            bcj_x86_encode(buffer, size);
+        src_size = lz4_compress(buffer, size, src);
+        if (src_size == 0)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_FALSE);
+    }
+
+    memcpy(buffer, plain, size);
+    run_target(bench, target, code, buffer, size, src, src_size, &results[0]);
+    if (target->lz4)
+        ok = memcmp(buffer, plain, size) == 0;
+    else
+    {
+        if (target->aes)
+            aes_ctr_xor(&bench->aes, (const uint8_t *)&bench->params->nonce[1], 0, buffer, size);
+        else
+            chacha20_xor(bench->params->key, &bench->params->nonce[1], 0, buffer, size);
+        ok = memcmp(buffer, plain, size) == 0;
+    }
+    // 복호화는 같은 buffer 에 몇 번을 해도 걸리는 시간은 같음
+    for (uint64_t start = now_ns(); runs < max; runs++)
+    {
+        if (!bench->runs && runs >= MIN_RUNS && now_ns() - start > BENCH_NS)
+            break;
+        run_target(bench, target, code, buffer, size, src, src_size, &results[runs]);
+    }
+    qsort(results, runs, sizeof(*results), compare_result);
+    print_result(target, size, runs, &results[runs / 2], ok);
+    munmap(plain, size);
+    munmap(buffer, size);
+    if (src)
+        munmap(src, LZ4_COMPRESS_BOUND(size));
+    free(results);
+    return ok ? 0 : -1;
+}
+
+static int bench_target(const t_kbench *bench, const t_target *target)
+{
+    void    *code = map_code(target);
+    int     exit_code = 0;
+
+    if (!code)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    for (int i = 0; i < bench->size_count; i++)
+        if (bench_size(bench, target, code, bench->sizes[i]) < 0)
+            exit_code = -1;
+    munmap(code, (target->len + 4095) & ~4095UL);
+    return exit_code;
+}
+
+// only 가 NULL 이면 이 CPU 에서 돌 수 있는 내장 kernel 전부
+static int bench_builtin(const t_kbench *bench, const char *only)
+{
+    int                 features = cpu_features();
+    int                 found = FALSE;
+    int                 exit_code = 0;
+    t_target            target = {0};
+    uint32_t            needs;
+
+    for (size_t i = 0; (target.name = kernel_bin(i, &target.aes, &needs, &target.code, &target.len)); i++)
+    {
+        if (only ? strcmp(only, target.name) != 0 : (needs & features) != needs)
+            continue;
+        found = TRUE;
+        if ((needs & features) != needs)
+        {
+            fprintf(stderr, "woody_kbench: %s: not supported by this CPU\n", target.name);
+            return -1;
+        }
+        if (bench_target(bench, &target) < 0)
+            exit_code = -1;
+    }
+    if (!found && only)
+    {
+        fprintf(stderr, "woody_kbench: %s: no such kernel\n", only);
+        return -1;
+    }
+    return exit_code;
+}
+
+static int load_target(t_target *target, const char *path)
+{
+    target->name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    target->code = map_file(path, &target->len);
+    return target->code ? 0 : -1;
+}
+
+// stub_bench.bin 의 표에서 lz4_decompress 를 찾아 필터 없이 / BCJ 로 한 번씩
+static int bench_stub(const t_kbench *bench, const char *path)
+{
+    t_target    target = { .lz4 = TRUE };
+    int         exit_code = 0;
+
+    if (load_target(&target, path) < 0)
+        return -1;
+    if (target.len < 8 || *(uint32_t *)target.code != BENCH_MAGIC
+        || *(uint32_t *)(target.code + 4) >= target.len)
+    {
+        munmap((void *)target.code, target.len);
+        fprintf(stderr, "woody_kbench: %s: not a stub built with -DBENCH\n", path);
+        return -1;
+    }
+    target.entry = *(uint32_t *)(target.code + 4);
+    target.name = "lz4";
+    exit_code = bench_target(bench, &target);
+    target.name = "lz4+bcj";
+    target.filter = FILTER_BCJ;
+    if (bench_target(bench, &target) < 0)
+        exit_code = -1;
+    munmap((void *)target.code, target.len);
+    return exit_code;
+}
+
+static int bench_file(const t_kbench *bench, const char *path)
+{
+    t_target    target = { .aes = bench->cipher != CIPHER_CHACHA20 };
+    int         exit_code;
+
+    if (load_target(&target, path) < 0)
+        return -1;
+    exit_code = bench_target(bench, &target);
+    munmap((void *)target.code, target.len);
+    return exit_code;
+}
+
+static int parse_size(const char *str, size_t *size)
+{
+    char        *end;
+    uint64_t    value = strtoull(str, &end, 10);
+
+    if (*end == 'K' || *end == 'k')
+        value <<= 10;
+    else if (*end == 'M' || *end == 'm')
+        value <<= 20;
+    else if (*end == 'G' || *end == 'g')
+        value <<= 30;
+    else if (*end != '\0')
+        return FALSE;
+    if (*end != '\0' && end[1] != '\0')
+        return FALSE;
+    // kernel 은 64 bytes 단위로 처리
+    *size = (value + BUFFER_ALIGN - 1) & ~(uint64_t)(BUFFER_ALIGN - 1);
+    return *str != '\0' && value >= 1024;
+}
+
+// key / nonce 와 AES key schedule 을 같이 채운 params (ChaCha20 kernel 은 key 만, AES kernel 은
+// round_keys 만 봄). --cipher 가 chacha20 이면 AES kernel 은 AES-256 으로
+static int setup_params(t_kbench *bench)
+{
+    t_stub_params *params = map_buffer(sizeof(t_stub_params));
+
+    if (!params || fill_random((uint8_t *)params->key, sizeof(params->key)) < 0
+        || fill_random((uint8_t *)&params->nonce[1], 12) < 0)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    params->cipher = bench->cipher;
+    aes_expand_key(&bench->aes, (const uint8_t *)params->key,
+                   bench->cipher == CIPHER_AES128_CTR ? 128 : 256);
+    params->aes_rounds = bench->aes.rounds;
+    memcpy(params->round_keys, bench->aes.round_keys, sizeof(params->round_keys));
+    bench->params = params;
+    return 0;
+}
+
+static int parse_option(t_kbench *bench, const char *name, const char *value, const char **stub)
+{
+    if (strcmp(name, "--size") == 0)
+        return bench->size_count < MAX_SIZES && parse_size(value, &bench->sizes[bench->size_count++]);
+    if (strcmp(name, "--runs") == 0)
+        return (bench->runs = atoi(value)) > 0;
+    if (strcmp(name, "--stub") == 0)
+        return (*stub = value) != NULL;
+    if (strcmp(name, "--cipher") != 0)
+        return FALSE;
+    if (strcmp(value, "chacha20") == 0)
+        bench->cipher = CIPHER_CHACHA20;
+    else if (strcmp(value, "aes128") == 0)
+        bench->cipher = CIPHER_AES128_CTR;
+    else if (strcmp(value, "aes256") == 0)
+        bench->cipher = CIPHER_AES256_CTR;
+    else
+        return FALSE;
+    return TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+    t_kbench    bench = { .cipher = CIPHER_CHACHA20 };
+    const char  *stub = NULL;
+    const char  **targets = malloc(argc * sizeof(*targets));
+    int         count = 0;
+    int         exit_code = 0;
+
+    if (!targets)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    for (int i = 1; i < argc; i++)
+    {
+        if (argv[i][0] != '-')
+            targets[count++] = argv[i];
+        else if (i + 1 == argc || !parse_option(&bench, argv[i], argv[i + 1], &stub))
+        {
+            free(targets);
+            return usage();
+        }
+        else
+            i++;
+    }
+    if (bench.size_count == 0)
+    {
+        size_t defaults[] = { 4 << 10, 64 << 10, 1 << 20, 16 << 20 };
+        memcpy(bench.sizes, defaults, sizeof(defaults));
+        bench.size_count = 4;
+    }
+    if (setup_params(&bench) < 0)
+    {
+        free(targets);
+        return 1;
+    }
+    printf("%-24s %10s %6s %9s %9s %9s %6s %10s\n", "kernel", "size", "runs", "GB/s",
+        "tsc/B", "cycles/B", "IPC", "miss/KB");
+    // 이름이면 내장 kernel, 경로 (.bin) 면 파일. 아무것도 없으면 이 CPU 에서 도는 내장 kernel 전부
+    for (int i = 0; i < count; i++)
+    {
+        if (strchr(targets[i], '/') || strstr(targets[i], ".bin"))
+            exit_code |= bench_file(&bench, targets[i]);
+        else
+            exit_code |= bench_builtin(&bench, targets[i]);
+    }
+    if (count == 0)
+        exit_code |= bench_builtin(&bench, NULL);
+    if (stub)
+        exit_code |= bench_stub(&bench, stub);
+    free(targets);
+    return exit_code ? 1 : 0;
+}
@@ -0,0 +1,324 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   woody_profile.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/14 10:12:40 by insub             #+#    #+#             */
+/*   Updated: 2026/01/14 16:48:05 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// woody_profile: 프로그램을 ptrace 로 실행하면서 packer 가 암호화하는 실행 region 의
+// 페이지를 처음 건드린 순서대로 기록 (woody_woodpacker --profile 의 입력)
+//
+// exec 직후 region 페이지를 모두 PROT_NONE 으로 바꾸고, SIGSEGV 가 날 때마다 그 페이지를
+// 기록한 뒤 원래 권한으로 돌려서 같은 명령을 다시 실행시킴. mprotect 는 tracee 안에서
+// 직접 부름 (exec 직후의 rip 에 syscall 명령을 잠깐 써 넣고 한 step 실행)
+
+#include "main.h"
+#include "file.h"
+#include "elf_parser.h"
+#include "payload.h"
+#include "print_utils.h"
+#include "profile.h"
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/ptrace.h>
+#include <sys/syscall.h>
+#include <sys/user.h>
+#include <sys/wait.h>
+
+#ifndef PAGE_SIZE                   // sys/user.h 에도 있음
+# define PAGE_SIZE 0x1000
+#endif
+#define PAGE_DOWN(x) ((x) & ~(uint64_t)(PAGE_SIZE - 1))
+#define PAGE_UP(x) PAGE_DOWN((x) + PAGE_SIZE - 1)
+
+typedef struct s_range
+{
+    uint64_t    start;      // 페이지 정렬된 link 주소
+    uint64_t    end;
+    int         prot;
+}   t_range;
+
+typedef struct s_tracer
+{
+    pid_t       pid;        // 처음 exec 하는 프로세스
+    int         ready;      // exec 후 보호를 걸었으면 TRUE (자식의 fault 는 그 전엔 남의 것)
+    uint64_t    bias;       // load bias (PIE)
+    uint64_t    site;       // syscall 을 써 넣을 자리 (exec 직후 rip, 이 페이지는 보호 안 함)
+    t_range     ranges[MAX_REGIONS];
+    int         range_count;
+    uint8_t     *seen;      // range 들을 이어 붙인 페이지 번호 -> 기록했으면 1
+    t_profile   profile;
+    size_t      cap;
+}   t_tracer;
+
+static int usage(void)
+{
+    fprintf(stderr, "Usage: woody_profile <profile_out> <program> [args...]\n");
+    return 1;
+}
+
+// woody_woodpacker 와 같은 기준의 region (find_exec_range) 을 페이지 단위로
+static int load_ranges(const char *path, t_tracer *tracer)
+{
+    t_file  file;
+
+    if (open_file(path, &file) < 0)
+        return -1;
+    // parse_elf 는 debug 출력이 tracee 출력과 섞이므로 필요한 것만
+    t_elf elf = {0};
+    elf.ehdr = (Elf64_Ehdr *)file.buffer;
+    elf.phdrs = (Elf64_Phdr *)(file.buffer + elf.ehdr->e_phoff);
+    elf.shdrs = (Elf64_Shdr *)(file.buffer + elf.ehdr->e_shoff);
+    tracer->profile.entry = elf.ehdr->e_entry;
+    for (int i = 0; i < elf.ehdr->e_phnum && tracer->range_count < MAX_REGIONS; i++)
+    {
+        Elf64_Phdr  *phdr = &elf.phdrs[i];
+        uint64_t    start;
+        uint64_t    end;
+
+        if (phdr->p_type != PT_LOAD || !(phdr->p_flags & PF_X)
+            || !find_exec_range(elf, phdr, &start, &end))
+            continue;
+        t_range *range = &tracer->ranges[tracer->range_count++];
+        range->start = PAGE_DOWN(phdr->p_vaddr + (start - phdr->p_offset));
+        range->end = PAGE_UP(phdr->p_vaddr + (end - phdr->p_offset));
+        range->prot = ((phdr->p_flags & PF_R) ? PROT_READ : 0)
+                    | ((phdr->p_flags & PF_W) ? PROT_WRITE : 0) | PROT_EXEC;
+    }
+    close_file(&file);
+    if (tracer->range_count == 0)
+        return print_error(INVALID_ELF, ERRNO_FALSE);
+
+    size_t pages = 0;
+    for (int i = 0; i < tracer->range_count; i++)
+        pages += (tracer->ranges[i].end - tracer->ranges[i].start) / PAGE_SIZE;
+    tracer->seen = calloc(pages, 1);
+    if (!tracer->seen)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    return 0;
+}
+
+// tracee (멈춘 상태) 안에서 syscall 하나를 실행하고 반환값을 돌려줌
+static long inject_syscall(pid_t tid, uint64_t site, long nr, long a1, long a2, long a3)
+{
+    struct user_regs_struct saved;
+    struct user_regs_struct regs;
+    int                     status;
+
+    if (ptrace(PTRACE_GETREGS, tid, 0, &saved) < 0)
+        return -errno;
+    errno = 0;
+    long word = ptrace(PTRACE_PEEKTEXT, tid, site, 0);
+    if (errno)
+        return -errno;
+
+    regs = saved;
+    regs.rip = site;
+    regs.rax = nr;
+    regs.orig_rax = -1;         // syscall 재시작 처리를 받지 않도록
+    regs.rdi = a1;
+    regs.rsi = a2;
+    regs.rdx = a3;
+    ptrace(PTRACE_POKETEXT, tid, site, (word & ~0xffffL) | 0x050f);    // syscall
+    ptrace(PTRACE_SETREGS, tid, 0, &regs);
+    ptrace(PTRACE_SINGLESTEP, tid, 0, 0);
+    if (waitpid(tid, &status, __WALL) < 0 || !WIFSTOPPED(status))
+        return -ESRCH;
+    ptrace(PTRACE_GETREGS, tid, 0, &regs);
+    ptrace(PTRACE_POKETEXT, tid, site, word);
+    ptrace(PTRACE_SETREGS, tid, 0, &saved);
+    return (long)regs.rax;
+}
+
+// AT_ENTRY - e_entry
+static int read_bias(t_tracer *tracer)
+{
+    char        path[64];
+    uint64_t    aux[2];
+
+    snprintf(path, sizeof(path), "/proc/%d/auxv", tracer->pid);
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    while (fread(aux, sizeof(aux), 1, fp) == 1 && aux[0] != AT_NULL)
+    {
+        if (aux[0] == AT_ENTRY)
+        {
+            tracer->bias = aux[1] - tracer->profile.entry;
+            fclose(fp);
+            return 0;
+        }
+    }
+    fclose(fp);
+    return print_error(INVALID_ELF, ERRNO_FALSE);
+}
+
+static void record_page(t_tracer *tracer, uint64_t page)
+{
+    size_t index = 0;
+
+    for (int i = 0; i < tracer->range_count; i++)
+    {
+        t_range *range = &tracer->ranges[i];
+        if (page >= range->start && page < range->end)
+        {
+            index += (page - range->start) / PAGE_SIZE;
+            break;
+        }
+        index += (range->end - range->start) / PAGE_SIZE;
+    }
+    if (tracer->seen[index])
+        return;
+    tracer->seen[index] = 1;
+    if (tracer->profile.count == tracer->cap)
+    {
+        size_t      cap = tracer->cap ? tracer->cap * 2 : 256;
+        uint64_t    *pages = realloc(tracer->profile.pages, cap * sizeof(*pages));
+        if (!pages)
+            return;
+        tracer->profile.pages = pages;
+        tracer->cap = cap;
+    }
+    tracer->profile.pages[tracer->profile.count++] = page;
+}
+
+// 처음 exec 직후: region 페이지를 모두 PROT_NONE 으로 (syscall 을 쓸 페이지는 빼고 기록)
+static int protect_ranges(t_tracer *tracer)
+{
+    struct user_regs_struct regs;
+
+    if (read_bias(tracer) < 0 || ptrace(PTRACE_GETREGS, tracer->pid, 0, &regs) < 0)
+        return -1;
+    tracer->site = regs.rip;
+    uint64_t site_page = PAGE_DOWN(tracer->site - tracer->bias);
+    for (int i = 0; i < tracer->range_count; i++)
+    {
+        t_range     *range = &tracer->ranges[i];
+        uint64_t    start = range->start;
+        uint64_t    end = range->end;
+
+        if (site_page >= start && site_page < end)
+        {
+            record_page(tracer, site_page);
+            inject_syscall(tracer->pid, tracer->site, SYS_mprotect, start + tracer->bias,
+                site_page - start, PROT_NONE);
+            start = site_page + PAGE_SIZE;
+        }
+        if (start < end && inject_syscall(tracer->pid, tracer->site, SYS_mprotect,
+                start + tracer->bias, end - start, PROT_NONE) < 0)
+            return print_error(INVALID_ELF, ERRNO_FALSE);
+    }
+    tracer->ready = TRUE;
+    return 0;
+}
+
+// region 페이지의 접근 fault 면 기록하고 권한을 돌려줌 (TRUE). 아니면 FALSE (signal 전달)
+static int handle_fault(t_tracer *tracer, pid_t tid)
+{
+    siginfo_t info;
+
+    if (!tracer->ready || ptrace(PTRACE_GETSIGINFO, tid, 0, &info) < 0
+        || info.si_code != SEGV_ACCERR)
+        return FALSE;
+    uint64_t page = PAGE_DOWN((uint64_t)info.si_addr - tracer->bias);
+    for (int i = 0; i < tracer->range_count; i++)
+    {
+        t_range *range = &tracer->ranges[i];
+        if (page < range->start || page >= range->end)
+            continue;
+        record_page(tracer, page);
+        return inject_syscall(tid, tracer->site, SYS_mprotect, page + tracer->bias,
+            PAGE_SIZE, range->prot) == 0;
+    }
+    return FALSE;
+}
+
+// 처음 exec 이후의 모든 thread / 자식 프로세스를 따라가며 (fork 된 자식도 PROT_NONE 을 물려받음)
+// 자식이 다른 프로그램을 exec 하면 놓아 줌. 처음 프로세스의 종료 코드를 돌려줌
+static int trace(t_tracer *tracer)
+{
+    int status;
+    int exit_code = 0;
+    pid_t tid;
+
+    while ((tid = waitpid(-1, &status, __WALL)) > 0)
+    {
+        if (WIFEXITED(status) || WIFSIGNALED(status))
+        {
+            if (tid == tracer->pid)
+                exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+            continue;
+        }
+        int sig = WSTOPSIG(status);
+        int event = status >> 16;
+        if (event == PTRACE_EVENT_EXEC && tid != tracer->pid)
+        {
+            ptrace(PTRACE_DETACH, tid, 0, 0);
+            continue;
+        }
+        else if (event || sig == SIGTRAP || sig == SIGSTOP)
+            sig = 0;    // 새 thread / 자식의 첫 SIGSTOP, ptrace event
+        else if (sig == SIGSEGV && handle_fault(tracer, tid))
+            sig = 0;
+        ptrace(PTRACE_CONT, tid, 0, sig);
+    }
+    return exit_code;
+}
+
+int main(int argc, char *argv[])
+{
+    t_tracer    tracer = {0};
+    int         status;
+
+    if (argc < 3)
+        return usage();
+    if (load_ranges(argv[2], &tracer) < 0)
+        return 1;
+
+    // exec 가 끝나면 SIGTRAP 으로 멈춤. event stop 이 아닌 signal stop 이라 syscall 을
+    // 넣을 수 있음 (exec event stop 에서는 singlestep 이 명령 실행 전에 trap 을 냄)
+    tracer.pid = fork();
+    if (tracer.pid < 0)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    if (tracer.pid == 0)
+    {
+        ptrace(PTRACE_TRACEME, 0, 0, 0);
+        execv(argv[2], &argv[2]);
+        perror("execv");
+        _exit(127);
+    }
+    if (waitpid(tracer.pid, &status, __WALL) < 0 || !WIFSTOPPED(status)
+        || WSTOPSIG(status) != SIGTRAP || protect_ranges(&tracer) < 0)
+    {
+        kill(tracer.pid, SIGKILL);
+        free(tracer.seen);
+        return 1;
+    }
+    ptrace(PTRACE_SETOPTIONS, tracer.pid, 0, PTRACE_O_TRACEEXEC | PTRACE_O_TRACECLONE
+        | PTRACE_O_TRACEFORK | PTRACE_O_TRACEVFORK | PTRACE_O_EXITKILL);
+    ptrace(PTRACE_CONT, tracer.pid, 0, 0);
+
+    int exit_code = trace(&tracer);
+    free(tracer.seen);
+    if (exit_code < 0 || !tracer.ready)
+    {
+        free_profile(&tracer.profile);
+        return 1;
+    }
+    size_t total = 0;
+    for (int i = 0; i < tracer.range_count; i++)
+        total += (tracer.ranges[i].end - tracer.ranges[i].start) / PAGE_SIZE;
+    fprintf(stderr, "woody_profile: %zu of %zu text pages touched (exit %d)\n",
+        tracer.profile.count, total, exit_code);
+    if (save_profile(argv[1], &tracer.profile) < 0)
+        exit_code = 1;
+    free_profile(&tracer.profile);
+    return exit_code;
+}
@@ -0,0 +1,317 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   woody_telemetry.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: insub <insub@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 13:05:48 by insub             #+#    #+#             */
+/*   Updated: 2026/02/09 15:31:04 by insub            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// woody_telemetry: --telemetry 로 pack 한 binary 들이 WOODY_TELEMETRY 로 남긴 record 를 모아서
+// binary (id) 별로 시작 단계마다 p50 / p90 / p99 / max 와 OEP 까지 걸린 cycles 의 histogram 을 찍음
+//
+// record 파일은 여러 host / 실행에서 이어 붙인 것이어도 됨. fd 로 받아 다른 출력과 섞였으면
+// magic 을 찾아 다시 맞춤. --name 으로 packed binary 를 주면 그 안의 id 로 이름을 붙임
+
+#include "main.h"
+#include "print_utils.h"
+#include "telemetry.h"
+#include <errno.h>
+#include <string.h>
+
+# define HISTOGRAM_BUCKETS 64
+# define BAR_WIDTH 40
+
+typedef struct s_binary
+{
+    uint64_t            id;
+    const char          *name;  // --name 으로 준 파일 (없으면 NULL)
+    t_telemetry_record  *runs;
+    size_t              count;
+    size_t              capacity;
+}   t_binary;
+
+typedef struct s_report
+{
+    t_binary    *binaries;
+    size_t      count;
+    size_t      capacity;
+    size_t      skipped;    // TSC 가 거꾸로 간 record (다른 CPU 로 옮겨졌고 TSC 가 안 맞는 경우 등)
+    double      mhz;        // --tsc-mhz: 0 이면 cycles 로 찍음
+}   t_report;
+
+static const char *g_phase_names[TSC_POINTS] = { "total", "kernel", "unpack", "hot", "oep" };
+
+static int usage(void)
+{
+    fprintf(stderr, "Usage: woody_telemetry [--tsc-mhz <n>] [--name <packed binary>]... <records|->...\n");
+    return 1;
+}
+
+static int is_header(const unsigned char *data)
+{
+    const t_telemetry_record *record = (const t_telemetry_record *)data;
+
+    return record->magic == TELEMETRY_MAGIC && record->version == TELEMETRY_VERSION
+        && record->points == TSC_POINTS;
+}
+
+// 파일 전체 (- 면 stdin). 실패하면 NULL
+static unsigned char *read_all(const char *path, size_t *size)
+{
+    int             fd = strcmp(path, "-") == 0 ? 0 : open(path, O_RDONLY | O_CLOEXEC);
+    unsigned char   *data = NULL;
+    size_t          capacity = 0;
+    ssize_t         n;
+
+    *size = 0;
+    if (fd < 0)
+        return NULL;
+    while (TRUE)
+    {
+        if (*size == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 1 << 16;
+            unsigned char *bigger = realloc(data, capacity);
+            if (!bigger)
+            {
+                n = -1;
+                break;
+            }
+            data = bigger;
+        }
+        n = read(fd, data + *size, capacity - *size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        *size += n;
+    }
+    if (fd != 0)
+        close(fd);
+    if (n != 0)
+    {
+        free(data);
+        return NULL;
+    }
+    return data;
+}
+
+static t_binary *find_binary(t_report *report, uint64_t id)
+{
+    for (size_t i = 0; i < report->count; i++)
+        if (report->binaries[i].id == id)
+            return &report->binaries[i];
+    if (report->count == report->capacity)
+    {
+        size_t capacity = report->capacity ? report->capacity * 2 : 16;
+        t_binary *bigger = realloc(report->binaries, capacity * sizeof(*bigger));
+        if (!bigger)
+            return NULL;
+        report->binaries = bigger;
+        report->capacity = capacity;
+    }
+    report->binaries[report->count] = (t_binary){ .id = id };
+    return &report->binaries[report->count++];
+}
+
+static int add_run(t_report *report, const t_telemetry_record *record)
+{
+    t_binary *binary = find_binary(report, record->id);
+
+    if (!binary)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    for (int i = 1; i < TSC_POINTS; i++)
+    {
+        if (record->tsc[i] < record->tsc[i - 1])
+        {
+            report->skipped++;
+            return 0;
+        }
+    }
+    if (binary->count == binary->capacity)
+    {
+        size_t capacity = binary->capacity ? binary->capacity * 2 : 256;
+        t_telemetry_record *bigger = realloc(binary->runs, capacity * sizeof(*bigger));
+        if (!bigger)
+            return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+        binary->runs = bigger;
+        binary->capacity = capacity;
+    }
+    binary->runs[binary->count++] = *record;
+    return 0;
+}
+
+// record 가 아닌 bytes 는 건너뛰고 다음 magic 부터
+static int load_records(t_report *report, const char *path)
+{
+    size_t          size;
+    unsigned char   *data = read_all(path, &size);
+    size_t          i = 0;
+
+    if (!data)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    while (i + sizeof(t_telemetry_record) <= size)
+    {
+        if (!is_header(data + i))
+        {
+            i++;
+            continue;
+        }
+        t_telemetry_record record;
+        memcpy(&record, data + i, sizeof(record));
+        if (add_run(report, &record) < 0)
+        {
+            free(data);
+            return -1;
+        }
+        i += sizeof(record);
+    }
+    free(data);
+    return 0;
+}
+
+// packed binary 의 dispatcher 안에 있는 record template 에서 id 를 읽어 이름을 붙임
+static int load_name(t_report *report, const char *path)
+{
+    size_t          size;
+    unsigned char   *data = read_all(path, &size);
+
+    if (!data)
+        return print_error(FILE_NOT_FOUND, ERRNO_TRUE);
+    for (size_t i = 0; i + sizeof(t_telemetry_record) <= size; i += 8)
+    {
+        if (is_header(data + i))
+        {
+            t_binary *binary = find_binary(report, ((t_telemetry_record *)(data + i))->id);
+            free(data);
+            if (!binary)
+                return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+            binary->name = path;
+            return 0;
+        }
+    }
+    free(data);
+    fprintf(stderr, "woody_telemetry: %s: not packed with --telemetry\n", path);
+    return -1;
+}
+
+// 0: OEP - 진입, 나머지: 앞 지점부터 그 지점까지
+static uint64_t phase_cycles(const t_telemetry_record *record, int phase)
+{
+    if (phase == 0)
+        return record->tsc[TSC_OEP] - record->tsc[TSC_ENTRY];
+    return record->tsc[phase] - record->tsc[phase - 1];
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void print_value(const t_report *report, uint64_t cycles)
+{
+    if (report->mhz > 0)
+        printf(" %12.1f", cycles / report->mhz);
+    else
+        printf(" %12lu", cycles);
+}
+
+static void print_histogram(const t_report *report, const uint64_t *sorted, size_t count)
+{
+    size_t  buckets[HISTOGRAM_BUCKETS] = {0};
+    int     first = HISTOGRAM_BUCKETS;
+    int     last = 0;
+    size_t  most = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        int bucket = sorted[i] ? 63 - __builtin_clzll(sorted[i]) : 0;
+        buckets[bucket]++;
+        first = bucket < first ? bucket : first;
+        last = bucket > last ? bucket : last;
+    }
+    for (int i = first; i <= last; i++)
+        most = buckets[i] > most ? buckets[i] : most;
+    printf("  total %s\n", report->mhz > 0 ? "(us)" : "(cycles)");
+    for (int i = first; i <= last; i++)
+    {
+        printf("   >=");
+        print_value(report, 1UL << i);
+        printf(" %8zu  ", buckets[i]);
+        for (size_t j = 0; j < (buckets[i] * BAR_WIDTH + most - 1) / most; j++)
+            putchar('#');
+        putchar('\n');
+    }
+}
+
+static int print_binary(const t_report *report, const t_binary *binary)
+{
+    uint64_t *values = malloc(binary->count * sizeof(*values));
+
+    if (!values)
+        return print_error(MEMORY_ALLOCATION_FAILED, ERRNO_TRUE);
+    printf("%016lx  %s  %zu runs\n", binary->id, binary->name ? binary->name : "-", binary->count);
+    printf("  %-8s %12s %12s %12s %12s  %s\n", "phase", "p50", "p90", "p99", "max",
+        report->mhz > 0 ? "(us)" : "(cycles)");
+    for (int phase = 1; phase <= TSC_POINTS; phase++)
+    {
+        int p = phase % TSC_POINTS;     // total 을 마지막에
+        for (size_t i = 0; i < binary->count; i++)
+            values[i] = phase_cycles(&binary->runs[i], p);
+        qsort(values, binary->count, sizeof(*values), compare_u64);
+        printf("  %-8s", g_phase_names[p]);
+        print_value(report, values[binary->count * 50 / 100]);
+        print_value(report, values[binary->count * 90 / 100]);
+        print_value(report, values[binary->count * 99 / 100]);
+        print_value(report, values[binary->count - 1]);
+        putchar('\n');
+    }
+    print_histogram(report, values, binary->count);
+    putchar('\n');
+    free(values);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    t_report    report = {0};
+    int         exit_code = 0;
+    int         inputs = 0;
+
+    for (int i = 1; i < argc && exit_code == 0; i++)
+    {
+        if (strcmp(argv[i], "--tsc-mhz") == 0 && i + 1 < argc)
+        {
+            report.mhz = strtod(argv[++i], NULL);
+            if (report.mhz <= 0)
+                return usage();
+        }
+        else if (strcmp(argv[i], "--name") == 0 && i + 1 < argc)
+            exit_code = load_name(&report, argv[++i]);
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
+            return usage();
+        else
+        {
+            exit_code = load_records(&report, argv[i]);
+            inputs++;
+        }
+    }
+    if (exit_code == 0 && inputs == 0)
+        return usage();
+    for (size_t i = 0; i < report.count && exit_code == 0; i++)
+        if (report.binaries[i].count)
+            exit_code = print_binary(&report, &report.binaries[i]);
+    if (report.skipped)
+        fprintf(stderr, "woody_telemetry: %zu records skipped (TSC went backwards)\n", report.skipped);
+    for (size_t i = 0; i < report.count; i++)
+        free(report.binaries[i].runs);
+    free(report.binaries);
+    return exit_code < 0 ? 1 : 0;
+}